@@ -47,10 +47,60 @@ void NetCDFFile::Create(const char *file, int format) {
     	throw Exc(nc_strerror(retval));	
 }
     
+// The file is created in memory, and it is got with ExtractMemory()
+void NetCDFFile::CreateInMemory(int format, size_t initialsize) {
+	Close();
+	
+	if ((retval = nc_create_mem("memory.nc", NC_CLOBBER | format, initialsize, &ncid)))
+       throw Exc(nc_strerror(retval)); 
+    fileid = ncid;
+    inMemory = true;
+    
+    allowGroups = format == NC_NETCDF4;
+ 
+    ChangeGroupRoot();
+    
+	if ((retval = nc_enddef(ncid)))
+    	throw Exc(nc_strerror(retval));	
+}
+
+// Opens read only a file image in memory, classic or NetCDF-4, without copying it.
+// data has to be kept unchanged until the file is closed
+void NetCDFFile::OpenMemory(const void *data, size_t size) {
+	Close();
+	
+	if ((retval = nc_open_mem("memory.nc", NC_NOWRITE, size, const_cast<void *>(data), &ncid)))
+       throw Exc(nc_strerror(retval)); 
+    fileid = ncid;
+ 
+  	int format;
+	if ((retval = nc_inq_format(ncid, &format)))
+    	throw Exc(nc_strerror(retval));
+    
+    allowGroups = format == NC_FORMAT_NETCDF4 || format == NC_FORMAT_NETCDF4_CLASSIC;
+	
+	ChangeGroupRoot();
+}
+
+// Closes a file created with CreateInMemory() and returns its contents
+NetCDFMemory NetCDFFile::ExtractMemory() {
+	if (!IsOpened() || !inMemory)
+		throw Exc("File was not created in memory");
+	
+	NC_memio mem;
+	if ((retval = nc_close_memio(fileid, &mem)))
+		throw Exc(nc_strerror(retval)); 
+	fileid = ncid = -1;
+	inMemory = false;
+	
+	return NetCDFMemory(mem);
+}
+
 void NetCDFFile::Close() {
 	if (IsOpened() && (retval = nc_close(fileid)))
        throw Exc(nc_strerror(retval)); 
 	fileid = ncid = -1;
+	inMemory = false;
 }
 
 String NetCDFFile::GetFileFormat() {
@@ -67,6 +117,52 @@ String NetCDFFile::GetFileFormat() {
     default:						return F("Unknown format %d", format);
     }
 }
+
+NC_io_stats NetCDFFile::GetIOStats() {
+	NC_io_stats stats;
+	if ((retval = nc_inq_io_stats(fileid, &stats)))
+    	throw Exc(nc_strerror(retval)); 
+	return stats;
+}
+
+void NetCDFFile::ResetIOStats() {
+	if ((retval = nc_reset_io_stats(fileid)))
+    	throw Exc(nc_strerror(retval)); 
+}
+
+// Classic files only. The record count is written to the file when a record is
+// started, if nrecs records were added or msecs passed since it was last written.
+// Both 0 go back to the default
+void NetCDFFile::SetNumrecsSync(size_t nrecs, int msecs) {
+	if ((retval = nc_set_numrecs_sync(fileid, nrecs, msecs)))
+    	throw Exc(nc_strerror(retval)); 
+}
+
+// Classic files only. Re-reads just the record count of a file that another
+// process appends to, so that the new records can be read without reopening it
+size_t NetCDFFile::RefreshNumRecs() {
+	size_t nrecs;
+	if ((retval = nc_refresh_numrecs(fileid, &nrecs)))
+    	throw Exc(nc_strerror(retval)); 
+	return nrecs;
+}
+
+// Polls the record count until there are at least n records, or timeout ms
+// passed (negative waits for ever). Returns the count, less than n on timeout
+size_t NetCDFFile::WaitForRecords(size_t n, int timeout) {
+	int start = msecs();
+	int delay = 1;
+	for (;;) {
+		size_t nrecs = RefreshNumRecs();
+		if (nrecs >= n)
+			return nrecs;
+		int elapsed = msecs(start);
+		if (timeout >= 0 && elapsed >= timeout)
+			return nrecs;
+		Sleep(timeout >= 0 ? min(delay, timeout - elapsed) : delay);
+		delay = min(2*delay, 100);
+	}
+}
 	
 String NetCDFFile::GetAttributeString(const char *name) {
 	size_t att_len;
@@ -303,6 +399,57 @@ void NetCDFFile::GetVariableData(int id, nc_type &type, Vector<int> &dims) {
 	}
 }
 
+Vector<String> NetCDFFile::GetDimensionNames(const char *name) {
+	lastvarid = GetId(name);
+	int ndim;
+	if ((retval = nc_inq_varndims(ncid, lastvarid, &ndim)))
+      	throw Exc(nc_strerror(retval));
+
+	Vector<int> dimids(ndim);    
+	if ((retval = nc_inq_vardimid(ncid, lastvarid, dimids.begin())))
+      	throw Exc(nc_strerror(retval));
+	
+	Vector<String> ret(ndim);
+	char dim_name[NC_MAX_NAME + 1];
+	for (int i = 0; i < ndim; ++i) {
+		if ((retval = nc_inq_dimname(ncid, dimids[i], dim_name)))
+	  		throw Exc(nc_strerror(retval));
+	  	ret[i] = dim_name;
+	}
+	return ret;
+}
+
+size_t NetCDFFile::GetDimension(const char *dim) {
+	int dimid;
+	if ((retval = nc_inq_dimid(ncid, dim, &dimid)))
+		throw Exc(F(t_("%s (%s)"), nc_strerror(retval), dim)); 
+	size_t len;
+	if ((retval = nc_inq_dimlen(ncid, dimid, &len)))
+		throw Exc(nc_strerror(retval));
+	return len;
+}
+
+void NetCDFFile::GetHyperslab(const char *name, const size_t *start, const size_t *count, double *data, const ptrdiff_t *imap) {
+	lastvarid = GetId(name);
+	if ((retval = imap ? nc_get_varm_double(ncid, lastvarid, start, count, NULL, imap, data)
+					   : nc_get_vara_double(ncid, lastvarid, start, count, data)))
+		throw Exc(nc_strerror(retval));
+}
+
+void NetCDFFile::GetHyperslab(const char *name, const size_t *start, const size_t *count, float *data, const ptrdiff_t *imap) {
+	lastvarid = GetId(name);
+	if ((retval = imap ? nc_get_varm_float(ncid, lastvarid, start, count, NULL, imap, data)
+					   : nc_get_vara_float(ncid, lastvarid, start, count, data)))
+		throw Exc(nc_strerror(retval));
+}
+
+void NetCDFFile::GetHyperslab(const char *name, const size_t *start, const size_t *count, int *data, const ptrdiff_t *imap) {
+	lastvarid = GetId(name);
+	if ((retval = imap ? nc_get_varm_int(ncid, lastvarid, start, count, NULL, imap, data)
+					   : nc_get_vara_int(ncid, lastvarid, start, count, data)))
+		throw Exc(nc_strerror(retval));
+}
+
 void NetCDFFile::GetVariableData0(int id, nc_type &type, Vector<int> &dims) {
 	lastvarid = id;
 	int ndim, natts;
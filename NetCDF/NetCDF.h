@@ -9,9 +9,46 @@
 
 #include <plugin/NetCDF/include/config.h>
 #include <plugin/NetCDF/include/netcdf.h>
+#include <plugin/NetCDF/include/netcdf_mem.h>
 
 namespace Upp {
 
+// The image of an in-memory file, as handed by nc_close_memio(). It is taken over
+// without a copy and freed with free(), as the library allocates it with malloc()
+class NetCDFMemory : public Moveable<NetCDFMemory>, NoCopy {
+public:
+	NetCDFMemory()							{}
+	NetCDFMemory(NC_memio &mem)				{Attach(mem);}
+	NetCDFMemory(NetCDFMemory&& m)			{Set0(m.memory, m.size); m.memory = nullptr; m.size = 0;}
+	~NetCDFMemory()							{Clear();}
+	
+	NetCDFMemory &operator=(NetCDFMemory&& m) {
+		if (this != &m) {
+			Set0(m.memory, m.size);
+			m.memory = nullptr; 
+			m.size = 0;
+		}
+		return *this;
+	}
+	
+	void Attach(NC_memio &mem)				{Set0(mem.memory, mem.size); mem.memory = nullptr; mem.size = 0;}
+	NC_memio Detach()						{NC_memio mem = {size, memory, 0}; memory = nullptr; size = 0; return mem;}
+	void Clear()							{free(memory); memory = nullptr; size = 0;}
+	
+	const char *Get() const					{return (const char *)memory;}
+	const char *operator~() const			{return Get();}
+	size_t GetCount() const					{return size;}
+	bool IsEmpty() const					{return size == 0;}
+	
+	String ToString() const					{return String(Get(), (int)size);}	// Copies the data
+
+private:
+	void *memory = nullptr;
+	size_t size = 0;
+	
+	void Set0(void *_memory, size_t _size)	{Clear(); memory = _memory; size = _size;}
+};
+
 class NetCDFFile {
 public:
 	NetCDFFile()				{}
@@ -20,10 +57,18 @@ public:
 	
 	void Create(const char *file, int format = 0);		
 	void Open(const char *file);
+	void CreateInMemory(int format = 0, size_t initialsize = 0);
+	void OpenMemory(const void *data, size_t size);
+	NetCDFMemory ExtractMemory();
 	bool IsOpened();
 	void Close();
 
 	String GetFileFormat();
+	NC_io_stats GetIOStats();
+	void ResetIOStats();
+	void SetNumrecsSync(size_t nrecs, int msecs = 0);
+	size_t RefreshNumRecs();
+	size_t WaitForRecords(size_t n, int timeout = -1);
 
 	const Vector<String> &ListGroups() const;
 	Vector<String> ListGlobalAttributes();
@@ -39,6 +84,13 @@ public:
 	int GetId(const char *name);
 	
 	void GetVariableData(const char *name, nc_type &type, Vector<int> &dims);
+	Vector<String> GetDimensionNames(const char *name);
+	size_t GetDimension(const char *dim);
+	
+	// Reads the hyperslab start, count. With imap, data is laid out with those strides, in elements
+	void GetHyperslab(const char *name, const size_t *start, const size_t *count, double *data, const ptrdiff_t *imap = nullptr);
+	void GetHyperslab(const char *name, const size_t *start, const size_t *count, float *data, const ptrdiff_t *imap = nullptr);
+	void GetHyperslab(const char *name, const size_t *start, const size_t *count, int *data, const ptrdiff_t *imap = nullptr);
 	
 	String GetVariableString(const char *name);
 	void GetInt(const char *name, Eigen::MatrixXi &data);
@@ -152,6 +204,7 @@ private:
 	Vector<String> groupNames;
 	Vector<int> groupPathIds;
 	bool allowGroups = false;
+	bool inMemory = false;
 	
 	String GetAttributeString0(const char *name, int len);
 	void GetVariableData(int id, nc_type &type, Vector<int> &dims);
@@ -161,6 +214,73 @@ private:
 	String ToString0();
 };
 
+// A set of files, like daily files, seen as one. Their variables are concatenated 
+// along a dimension, and the rest of their layout has to be the same.
+// Files are opened when read, and at most GetMaxOpen() are kept open
+class NetCDFAggregate {
+public:
+	NetCDFAggregate()			{}
+	NetCDFAggregate(const Vector<String> &files, const char *dim)	{Open(files, dim);}
+	NetCDFAggregate(const char *pattern, const char *dim)			{Open(pattern, dim);}
+	
+	void Open(const Vector<String> &files, const char *dim);
+	void Open(const char *pattern, const char *dim);
+	bool IsOpened() const		{return !files.IsEmpty();}
+	void Close();
+	
+	NetCDFAggregate &SetMaxOpen(int n);
+	int GetMaxOpen() const		{return maxOpen;}
+	
+	int GetFileCount() const					{return files.size();}
+	const String &GetFileName(int i) const	{return files[i].name;}
+	size_t GetLength() const;
+	
+	Vector<String> ListVariables() const		{return clone(vars.GetKeys());}
+	bool ExistVar(const char *name) const		{return vars.Find(name) >= 0;}
+	nc_type GetType(const char *name) const	{return GetVar(name).type;}
+	const Vector<String> &GetDimensionNames(const char *name) const	{return GetVar(name).dimnames;}
+	const Vector<size_t> &GetDimensions(const char *name) const		{return GetVar(name).dims;}
+	
+	void GetDouble(const char *name, const Vector<size_t> &start, const Vector<size_t> &count, Vector<double> &data);
+	void GetFloat(const char *name, const Vector<size_t> &start, const Vector<size_t> &count, Vector<float> &data);
+	void GetInt(const char *name, const Vector<size_t> &start, const Vector<size_t> &count, Vector<int> &data);
+	void GetDouble(const char *name, Vector<double> &data);
+	
+private:
+	struct Var : Moveable<Var> {
+		nc_type type;
+		Vector<String> dimnames;
+		Vector<size_t> dims;
+		int agg = -1;			// Index of the dimension of the aggregation, -1 if none
+	};
+	struct File : Moveable<File> {
+		String name;
+		size_t begin, len;		// Range along the dimension of the aggregation
+	};
+	struct Handle {
+		NetCDFFile cdf;
+		int file = -1;
+		bool busy = false;
+		int64 used = 0;
+	};
+	
+	String dim;
+	Vector<File> files;
+	VectorMap<String, Var> vars;
+	
+	int maxOpen = 16;
+	Array<Handle> pool;
+	int64 tick = 0;
+	Mutex mutex;
+	ConditionVariable cv;
+	
+	const Var &GetVar(const char *name) const;
+	Handle &Acquire(int file);
+	void Release(Handle &h);
+	template <class T>
+	void Read(const char *name, const Vector<size_t> &start, const Vector<size_t> &count, Vector<T> &data);
+};
+
 }
 	
 #endif
@@ -0,0 +1,282 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2021 - 2024, the Anboto author and contributors
+#include <Core/Core.h>
+#include <Eigen/Eigen.h>
+
+#include "NetCDF.h"
+
+
+namespace Upp {
+
+void NetCDFAggregate::Open(const Vector<String> &_files, const char *_dim) {
+	Close();
+
+	if (_files.IsEmpty())
+		throw Exc(t_("No files to aggregate"));
+
+	dim = _dim;
+	size_t begin = 0;
+	for (int i = 0; i < _files.size(); ++i) {
+		File &f = files.Add();
+		f.name = _files[i];
+	}
+	try {
+		for (int i = 0; i < files.size(); ++i) {
+			File &f = files[i];
+			Handle &h = Acquire(i);
+			NetCDFFile &cdf = h.cdf;
+
+			f.begin = begin;
+			f.len = cdf.GetDimension(dim);
+			begin += f.len;
+
+			Vector<String> names = cdf.ListVariables();
+			if (i > 0 && names.size() != vars.size())
+				throw Exc(F(t_("'%s' has %d variables, and '%s' %d"), f.name, names.size(), files[0].name, vars.size()));
+			for (const String &name : names) {
+				nc_type type;
+				Vector<int> dims;
+				cdf.GetVariableData(name, type, dims);
+				Vector<String> dimnames = cdf.GetDimensionNames(name);
+				if (i == 0) {
+					Var &v = vars.Add(name);
+					v.type = type;
+					v.agg = FindIndex(dimnames, dim);
+					for (const String &d : dimnames)
+						v.dims << cdf.GetDimension(d);
+					v.dimnames = pick(dimnames);
+				} else {
+					int id = vars.Find(name);
+					if (id < 0)
+						throw Exc(F(t_("Variable '%s' of '%s' is not in '%s'"), name, f.name, files[0].name));
+					const Var &v = vars[id];
+					if (v.type != type)
+						throw Exc(F(t_("Variable '%s' is %s in '%s' and %s in '%s'"), name,
+									NetCDFFile::TypeName(type), f.name, NetCDFFile::TypeName(v.type), files[0].name));
+					if (!IsEqualRange(v.dimnames, dimnames))
+						throw Exc(F(t_("Variable '%s' has different dimensions in '%s' and '%s'"), name, f.name, files[0].name));
+					for (int d = 0; d < dimnames.size(); ++d)
+						if (d != v.agg && v.dims[d] != cdf.GetDimension(dimnames[d]))
+							throw Exc(F(t_("Dimension '%s' of '%s' has a different length in '%s' and '%s'"),
+										dimnames[d], name, f.name, files[0].name));
+				}
+			}
+			Release(h);
+		}
+	} catch (...) {
+		Close();
+		throw;
+	}
+	for (Var &v : vars)
+		if (v.agg >= 0)
+			v.dims[v.agg] = begin;
+}
+
+// pattern is a path with wildcards, like "data/day_*.nc". Files are taken in name order
+void NetCDFAggregate::Open(const char *pattern, const char *_dim) {
+	Vector<String> list;
+	String folder = GetFileFolder(pattern);
+	for (FindFile ff(pattern); ff; ff.Next())
+		if (ff.IsFile())
+			list << AppendFileName(folder, ff.GetName());
+	if (list.IsEmpty())
+		throw Exc(F(t_("No file matches '%s'"), pattern));
+	Sort(list);
+	Open(list, _dim);
+}
+
+void NetCDFAggregate::Close() {
+	Mutex::Lock __(mutex);
+	pool.Clear();
+	files.Clear();
+	vars.Clear();
+	dim.Clear();
+}
+
+NetCDFAggregate &NetCDFAggregate::SetMaxOpen(int n) {
+	Mutex::Lock __(mutex);
+	maxOpen = max(n, 1);
+	for (int i = pool.size() - 1; i >= 0 && pool.size() > maxOpen; --i)
+		if (!pool[i].busy)
+			pool.Remove(i);
+	return *this;
+}
+
+size_t NetCDFAggregate::GetLength() const {
+	return files.IsEmpty() ? 0 : files.Top().begin + files.Top().len;
+}
+
+const NetCDFAggregate::Var &NetCDFAggregate::GetVar(const char *name) const {
+	int id = vars.Find(name);
+	if (id < 0)
+		throw Exc(F(t_("Variable '%s' not found"), name));
+	return vars[id];
+}
+
+// Returns the file open and for the caller only. If the pool is full, the
+// least recently used handle is closed, waiting for one to be free if needed.
+// Files are opened with the mutex released, so other files can be opened meanwhile
+NetCDFAggregate::Handle &NetCDFAggregate::Acquire(int file) {
+	Mutex::Lock __(mutex);
+	for (;;) {
+		Handle *lru = nullptr;
+		bool inpool = false;
+		for (Handle &h : pool) {
+			if (h.file == file) {
+				inpool = true;
+				if (!h.busy) {
+					h.busy = true;
+					return h;
+				}
+			} else if (!h.busy && (!lru || h.used < lru->used))
+				lru = &h;
+		}
+		if (!inpool && (pool.size() < maxOpen || lru)) {
+			Handle &h = pool.size() < maxOpen ? pool.Add() : *lru;
+			h.file = -1;
+			h.busy = true;
+			mutex.Leave();
+			try {
+				h.cdf.Open(files[file].name);
+			} catch (...) {
+				mutex.Enter();
+				h.busy = false;
+				cv.Broadcast();
+				throw;
+			}
+			mutex.Enter();
+			h.file = file;
+			return h;
+		}
+		cv.Wait(mutex);
+	}
+}
+
+void NetCDFAggregate::Release(Handle &h) {
+	Mutex::Lock __(mutex);
+	h.busy = false;
+	h.used = ++tick;
+	cv.Broadcast();
+}
+
+// Each file is read once, straight into its place in data. Files are read in
+// parallel when the library is thread safe
+template <class T>
+void NetCDFAggregate::Read(const char *name, const Vector<size_t> &start, const Vector<size_t> &count, Vector<T> &data) {
+	const Var &v = GetVar(name);
+	int rank = v.dims.size();
+	if (start.size() != rank || count.size() != rank)
+		throw Exc(F(t_("Variable '%s' has %d dimensions"), name, rank));
+	size_t sz = 1;
+	for (int d = 0; d < rank; ++d) {
+		if (start[d] + count[d] > v.dims[d])
+			throw Exc(F(t_("Hyperslab out of the bounds of '%s'"), name));
+		sz *= count[d];
+	}
+	data.SetCount(int(sz));
+	if (sz == 0)
+		return;
+
+	struct Piece {
+		int file;
+		Buffer<size_t> start;
+		T *data;
+	};
+	Array<Piece> pieces;
+	if (v.agg < 0) {
+		Piece &p = pieces.Add();
+		p.file = 0;
+		p.start.Alloc(rank);
+		for (int d = 0; d < rank; ++d)
+			p.start[d] = start[d];
+		p.data = data.begin();
+	}
+
+	// Strides of data, in elements, for the files that are not a contiguous block of it
+	Buffer<ptrdiff_t> imap;
+	Buffer<size_t> counts(files.size()*max(rank, 1));
+	if (v.agg > 0) {
+		imap.Alloc(rank);
+		ptrdiff_t stride = 1;
+		for (int d = rank - 1; d >= 0; --d) {
+			imap[d] = stride;
+			stride *= ptrdiff_t(count[d]);
+		}
+	}
+	if (v.agg >= 0) {
+		size_t stride = 1;
+		for (int d = v.agg + 1; d < rank; ++d)
+			stride *= count[d];
+		size_t from = start[v.agg], to = from + count[v.agg];
+		for (int i = 0; i < files.size(); ++i) {
+			const File &f = files[i];
+			size_t b = max(from, f.begin), e = min(to, f.begin + f.len);
+			if (b >= e)
+				continue;
+			Piece &p = pieces.Add();
+			p.file = i;
+			p.start.Alloc(rank);
+			size_t *c = ~counts + i*rank;
+			for (int d = 0; d < rank; ++d) {
+				p.start[d] = start[d];
+				c[d] = count[d];
+			}
+			p.start[v.agg] = b - f.begin;
+			c[v.agg] = e - b;
+			p.data = data.begin() + (b - from)*stride;
+		}
+	}
+
+	auto ReadPiece = [&](const Piece &p) {
+		Handle &h = Acquire(p.file);
+		try {
+			h.cdf.GetHyperslab(name, p.start, v.agg >= 0 ? ~counts + p.file*rank : count.begin(),
+							   p.data, v.agg > 0 ? ~imap : nullptr);
+		} catch (...) {
+			Release(h);
+			throw;
+		}
+		Release(h);
+	};
+#ifdef flagNETCDF_THREADSAFE
+	if (pieces.size() > 1) {
+		CoWork co;
+		String error;
+		for (const Piece &p : pieces)
+			co & [&] {
+				try {
+					ReadPiece(p);
+				} catch (Exc err) {
+					CoWork::FinLock();
+					error = err;
+				}
+			};
+		co.Finish();
+		if (!error.IsEmpty())
+			throw Exc(error);
+		return;
+	}
+#endif
+	for (const Piece &p : pieces)
+		ReadPiece(p);
+}
+
+void NetCDFAggregate::GetDouble(const char *name, const Vector<size_t> &start, const Vector<size_t> &count, Vector<double> &data) {
+	Read(name, start, count, data);
+}
+
+void NetCDFAggregate::GetFloat(const char *name, const Vector<size_t> &start, const Vector<size_t> &count, Vector<float> &data) {
+	Read(name, start, count, data);
+}
+
+void NetCDFAggregate::GetInt(const char *name, const Vector<size_t> &start, const Vector<size_t> &count, Vector<int> &data) {
+	Read(name, start, count, data);
+}
+
+void NetCDFAggregate::GetDouble(const char *name, Vector<double> &data) {
+	const Vector<size_t> &dims = GetVar(name).dims;
+	Vector<size_t> start(dims.size(), 0);
+	Read(name, start, dims, data);
+}
+
+}
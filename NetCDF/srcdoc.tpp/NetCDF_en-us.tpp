@@ -11,6 +11,74 @@ access, and sharing of array`-oriented scientific data]&]
 files, at ][^https`:`/`/github`.com`/Unidata`/netcdf`-c`/releases`/tag`/v4`.10`.0^2 v
 ersion 4.10.0][2 .]&]
 [s0;2 &]
-[s0; [2 Two simple sample packages are included:]&]
+[s0; [2 These sample packages are included:]&]
 [s0;i150;O0; [2 examples/Hdf5`_demo`_cl.-|A basic demo and unitest.]&]
-[s0;i150;O0; [2 examples/Hdf5`_reader`_cl-|A basic command line reader.]]]
\ No newline at end of file
+[s0;i150;O0; [2 examples/Hdf5`_reader`_cl-|A basic command line reader.]&]
+[s0;i150;O0; [2 examples/NetCDF`_threads`_cl-|Thread safety stress test 
+and benchmark.]&]
+[s0;i150;O0; [2 examples/NetCDF`_bench`_cl-|I/O benchmark suite. Results 
+are written in JSON, to compare library versions.]&]
+[s0;2 &]
+[s0; [2 The C library is not thread safe by default. Building with 
+the ][*2 NETCDF`_THREADSAFE][2  flag adds locking so that the library 
+can be called from several threads: every classic file has its 
+own lock, so different classic files are read and written in parallel, 
+while NetCDF`-4 files share one lock, as HDF5 is not reentrant. 
+Data reads of classic files opened read only take no lock at all, 
+so many threads can read the same file at once.]&]
+[s0;2 &]
+[s0; [*2 GetIOStats()][2  returns the I/O counters of the open file 
+(nc`_inq`_io`_stats()): bytes read and written, calls to the operating 
+system, buffer cache hits and misses, chunks moved whole and time 
+spent converting data types. ][*2 ResetIOStats()][2  sets them to 
+zero.]&]
+[s0;2 &]
+[s0; [2 Appending records to a classic file only updates the record 
+count in memory, and it is written to the file by nc`_sync() and 
+Close(). Files shared with NC`_SHARE write it at every record. ][*2 SetNumrecsSync(nrecs, 
+msecs)][2  writes it instead, when a record is started, if nrecs 
+records were added or msecs milliseconds passed since it was last 
+written. The count leaves out the record being started, and its 
+records are handed to the system before it, so if the program dies 
+the file is valid and holds the records counted, whole if each record 
+is written whole before the next. SetNumrecsSync(0, 0) goes back 
+to the default.]&]
+[s0;2 &]
+[s0; [2 A program can follow a classic file that another one is appending 
+to, without opening it again. ][*2 RefreshNumRecs()][2  reads from 
+the file only its record count (nc`_refresh`_numrecs()), a few bytes, 
+and returns it, and the records counted can then be read as usual. 
+][*2 WaitForRecords(n, timeout)][2  calls it until there are n records 
+or timeout milliseconds passed. The rest of the header is not read 
+again, so the writer must only add records.]&]
+[s0;2 &]
+[s0; [2 To see which calls a program makes and how long they take, set 
+the ][*2 NCDISPATCHTRACE][2  environment variable to a file name: 
+the library then counts and times every call and writes, at exit, 
+the number of calls, latency histogram and bytes moved of each 
+function in JSON. With ][*2 NCDISPATCHTRACEFORMAT`=chrome][2  the 
+last 65536 calls are written instead, in Chrome trace format, to 
+be viewed in Perfetto. The same is available from code with nc`_set`_dispatch`_trace() 
+and nc`_dump`_dispatch`_trace().]&]
+[s0;2 &]
+[s0; [2 The library initializes its parts when they are first needed: 
+HDF5 and the filter plugin paths with the first NetCDF`-4 file, 
+and the .rc files with the first file opened or created. Programs 
+that only read classic files do not pay for HDF5 at start up.]&]
+[s0;2 &]
+[s0; [2 Files can also be handled in memory, without touching the disk. 
+][*2 OpenMemory(data, size)][2  opens read only a classic or NetCDF`-4 
+file image without copying it, so the data has to be kept until 
+the file is closed. ][*2 CreateInMemory()][2  creates a file in memory, 
+and ][*2 ExtractMemory()][2  closes it and returns its contents as 
+a ][*2 NetCDFMemory][2 , that takes the memory of the library without 
+a copy. Its ToString() copies it to a String.]]&]
+[s0;2 &]
+[s0; [*2 NetCDFAggregate][2  reads a set of files, like daily files, 
+as one. Open() takes a list of files or a pattern like `"data/day`_`*.nc`" 
+and the dimension along which their variables are concatenated. 
+The variables, their types and the rest of their dimensions have 
+to be the same in all files. A read of a hyperslab reads only the 
+files it covers, each once, straight into the result. Files are 
+opened when needed and at most SetMaxOpen() of them are kept open. 
+With ][*2 NETCDF`_THREADSAFE][2  the files are read in parallel.]]
\ No newline at end of file
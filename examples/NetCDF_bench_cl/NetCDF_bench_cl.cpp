@@ -0,0 +1,685 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2021 - 2024, the Anboto author and contributors
+#include <Core/Core.h>
+
+using namespace Upp;
+
+#include <NetCDF/NetCDF.h>
+
+// Benchmark suite of the NetCDF library.
+// It builds synthetic datasets and measures write and read throughput for
+// every file format and storage layout, the latency of single value reads and
+// metadata calls, the cost of opening files with large headers, the speed of
+// name lookups in headers of many names, the latency of opening small files,
+// by absolute and by relative path and from memory, the time of the first
+// read of a program, library initialization included, and the speed of
+// appending records one by one.
+// Results are written as JSON to stdout (or to the file given with -out), so
+// that runs of different library versions can be compared. Progress goes to
+// stderr.
+//
+// Options:
+//	-shape nt,ny,nx		Shape of the float variable, default 64,512,512 (64 MB)
+//	-chunk ct,cy,cx		Chunk shape of the chunked layouts, default 1,128,128
+//	-unlimited			Make the first dimension unlimited
+//	-reps n				Repetitions of each measure, the best is kept. Default 3
+//	-points n			Number of single value reads, default 2000
+//	-vars n				Number of variables in the large header files, default 2000
+//	-names n			Number of variables in the many names files, default 100000
+//	-opens n			Number of opens of the small files, default 2000
+//	-records n			Number of records appended, default 1000000
+//	-dir folder			Folder for the test files, default the temporary folder
+//	-out file			JSON output file
+//
+// Reads are done with the files in the OS cache, so they measure the library
+// and not the disk.
+
+struct Config {
+	int nt = 64, ny = 512, nx = 512;
+	int ct = 1, cy = 128, cx = 128;
+	bool unlimited = false;
+	int reps = 3;
+	int npoints = 2000;
+	int nvars = 2000;
+	int nnames = 100000;
+	int nopens = 2000;
+	int nrecords = 1000000;
+	String dir, out;
+};
+
+struct Layout {
+	const char *format;
+	int cmode;
+	bool chunked;
+	bool deflate;
+};
+
+static const Layout layouts[] = {
+	{"classic", 		0, 					false, false},
+	{"64bit_offset", 	NC_64BIT_OFFSET, 	false, false},
+	{"cdf5", 			NC_64BIT_DATA, 		false, false},
+	{"netcdf4", 		NC_NETCDF4, 		false, false},
+	{"netcdf4", 		NC_NETCDF4, 		true,  false},
+	{"netcdf4", 		NC_NETCDF4, 		true,  true},
+};
+
+static JsonArray results;
+
+static void Check(int retval) {
+	if (retval)
+		throw Exc(nc_strerror(retval));
+}
+
+static void Progress(const String &str) {
+	Cerr() << str << "\n";
+}
+
+static Json Describe(const Layout &l) {
+	return Json("format", l.format)
+			   ("storage", l.chunked ? "chunked" : "contiguous")
+			   ("compression", l.deflate ? "shuffle+deflate1" : "none");
+}
+
+static void Add(const char *test, const Json &layout, double seconds, double value, const char *unit) {
+	Json json;
+	json("test", test)("layout", layout)("seconds", seconds)("value", value)("unit", unit);
+	results << json;
+	Progress(Format("%-22s %s: %.4g %s", test, layout.ToString(), value, unit));
+}
+
+// Runs f() reps times and returns the best time in seconds
+template <class F>
+static double Best(int reps, F f) {
+	double best = DBL_MAX;
+	for (int i = 0; i < reps; ++i) {
+		TimeStop t;
+		f();
+		best = min(best, t.Seconds());
+	}
+	return best;
+}
+
+static String FileName(const Config &cfg, const char *name) {
+	return AppendFileName(cfg.dir, Format("bench_%s.nc", name));
+}
+
+static void FillData(const Config &cfg, Buffer<float> &data) {
+	size_t plane = (size_t)cfg.ny*cfg.nx;
+	data.Alloc(plane*cfg.nt);
+	for (int t = 0; t < cfg.nt; ++t)
+		for (int y = 0; y < cfg.ny; ++y)
+			for (int x = 0; x < cfg.nx; ++x)		// Smooth field, so it compresses as real data
+				data[t*plane + (size_t)y*cfg.nx + x] = float(100*sin(0.01*x + 0.02*y + 0.1*t) + 0.001*x*y);
+}
+
+static void WriteData(const Config &cfg, const Layout &l, const String &fn, const float *data) {
+	int ncid, dimids[3], varid, oldfill;
+	Check(nc_create(fn, l.cmode|NC_CLOBBER, &ncid));
+	try {
+		Check(nc_set_fill(ncid, NC_NOFILL, &oldfill));
+		Check(nc_def_dim(ncid, "t", cfg.unlimited ? NC_UNLIMITED : cfg.nt, &dimids[0]));
+		Check(nc_def_dim(ncid, "y", cfg.ny, &dimids[1]));
+		Check(nc_def_dim(ncid, "x", cfg.nx, &dimids[2]));
+		Check(nc_def_var(ncid, "data", NC_FLOAT, 3, dimids, &varid));
+		if (l.cmode == NC_NETCDF4) {
+			size_t chunks[3] = {(size_t)min(cfg.ct, cfg.nt), (size_t)min(cfg.cy, cfg.ny), (size_t)min(cfg.cx, cfg.nx)};
+			if (!l.chunked && cfg.unlimited)
+				throw Exc("Contiguous storage is not possible with an unlimited dimension");
+			Check(nc_def_var_chunking(ncid, varid, l.chunked ? NC_CHUNKED : NC_CONTIGUOUS, l.chunked ? chunks : NULL));
+			if (l.deflate)
+				Check(nc_def_var_deflate(ncid, varid, 1, 1, 1));
+		}
+		Check(nc_enddef(ncid));
+		size_t start[3] = {0, 0, 0}, count[3] = {(size_t)cfg.nt, (size_t)cfg.ny, (size_t)cfg.nx};
+		Check(nc_put_vara_float(ncid, varid, start, count, data));
+	} catch (...) {
+		nc_close(ncid);
+		throw;
+	}
+	Check(nc_close(ncid));
+}
+
+// Opens the file and reads the hyperslab start, count, stride. Returns the bytes read
+static size_t ReadData(const String &fn, const size_t *start, const size_t *count, const ptrdiff_t *stride, float *data) {
+	int ncid, varid;
+	Check(nc_open(fn, NC_NOWRITE, &ncid));
+	int ret = nc_inq_varid(ncid, "data", &varid);
+	if (!ret)
+		ret = nc_get_vars_float(ncid, varid, start, count, stride, data);
+	nc_close(ncid);
+	Check(ret);
+	return count[0]*count[1]*count[2]*sizeof(float);
+}
+
+// Opens the file for writing and writes the hyperslab start, count. Returns the bytes written
+static size_t WriteHyperslab(const String &fn, const size_t *start, const size_t *count, const float *data) {
+	int ncid, varid;
+	Check(nc_open(fn, NC_WRITE, &ncid));
+	int ret = nc_inq_varid(ncid, "data", &varid);
+	if (!ret)
+		ret = nc_put_vara_float(ncid, varid, start, count, data);
+	int ret2 = nc_close(ncid);
+	Check(ret ? ret : ret2);
+	return count[0]*count[1]*count[2]*sizeof(float);
+}
+
+static void BenchData(const Config &cfg, const Layout &l) {
+	String fn = FileName(cfg, Format("%s_%s%s", l.format, l.chunked ? "chunked" : "contiguous", l.deflate ? "_deflate" : ""));
+	Json layout = Describe(l);
+
+	Buffer<float> data, buf;
+	FillData(cfg, data);
+	size_t total = (size_t)cfg.nt*cfg.ny*cfg.nx;
+	buf.Alloc(total);
+	double mb = total*sizeof(float)/1024./1024.;
+
+	try {
+		WriteData(cfg, l, fn, data);
+	} catch (Exc err) {
+		Json json;
+		json("test", "write")("layout", layout)("skipped", err);
+		results << json;
+		Progress(Format("%s %s skipped: %s", l.format, layout.ToString(), err));
+		return;
+	}
+	double t = Best(cfg.reps, [&] {WriteData(cfg, l, fn, data);});
+	Add("write", layout, t, mb/t, "MB/s");
+	Add("file_size", layout, 0, GetFileLength(fn)/1024./1024., "MB");
+
+	size_t start[3] = {0, 0, 0}, count[3] = {(size_t)cfg.nt, (size_t)cfg.ny, (size_t)cfg.nx};
+	ptrdiff_t one[3] = {1, 1, 1};
+	t = Best(cfg.reps, [&] {ReadData(fn, start, count, one, buf);});
+	if (memcmp(~buf, ~data, total*sizeof(float)))
+		throw Exc(Format("Wrong data read from %s", fn));
+	Add("read_full", layout, t, mb/t, "MB/s");
+
+	// The central quarter of every plane
+	size_t hstart[3] = {0, (size_t)cfg.ny/4, (size_t)cfg.nx/4},
+		   hcount[3] = {(size_t)cfg.nt, (size_t)max(1, cfg.ny/2), (size_t)max(1, cfg.nx/2)};
+	size_t bytes = 0;
+	t = Best(cfg.reps, [&] {bytes = ReadData(fn, hstart, hcount, one, buf);});
+	Add("read_hyperslab", layout, t, bytes/1024./1024./t, "MB/s");
+
+	// The same values written back in place
+	t = Best(cfg.reps, [&] {bytes = WriteHyperslab(fn, hstart, hcount, buf);});
+	Add("write_hyperslab", layout, t, bytes/1024./1024./t, "MB/s");
+
+	// One of every 4x4 values
+	ptrdiff_t stride[3] = {1, 4, 4};
+	size_t scount[3] = {(size_t)cfg.nt, (size_t)(cfg.ny + 3)/4, (size_t)(cfg.nx + 3)/4};
+	t = Best(cfg.reps, [&] {bytes = ReadData(fn, start, scount, stride, buf);});
+	Add("read_strided", layout, t, bytes/1024./1024./t, "MB/s");
+
+	// Single values at random places, file already open
+	int ncid, varid;
+	Check(nc_open(fn, NC_NOWRITE, &ncid));
+	Check(nc_inq_varid(ncid, "data", &varid));
+	Vector<size_t> idx(3*cfg.npoints);
+	SeedRandom(123);
+	for (int i = 0; i < cfg.npoints; ++i) {
+		idx[3*i]   = Random(cfg.nt);
+		idx[3*i+1] = Random(cfg.ny);
+		idx[3*i+2] = Random(cfg.nx);
+	}
+	t = Best(cfg.reps, [&] {
+		float v;
+		for (int i = 0; i < cfg.npoints; ++i)
+			Check(nc_get_var1_float(ncid, varid, &idx[3*i], &v));
+	});
+	nc_close(ncid);
+	Add("read_point_latency", layout, t, 1e6*t/cfg.npoints, "us");
+
+	FileDelete(fn);
+}
+
+// A file with many variables, each with the usual CF attributes
+static void WriteHeader(const Config &cfg, const Layout &l, const String &fn) {
+	int ncid, dimid, oldfill;
+	Check(nc_create(fn, l.cmode|NC_CLOBBER, &ncid));
+	try {
+		Check(nc_set_fill(ncid, NC_NOFILL, &oldfill));
+		Check(nc_def_dim(ncid, "n", 4, &dimid));
+		double scale = 0.01, offset = 273.15;
+		for (int i = 0; i < cfg.nvars; ++i) {
+			int varid;
+			String name = Format("var_%05d", i);
+			String longname = "Long name of variable " + name;
+			Check(nc_def_var(ncid, name, NC_INT, 1, &dimid, &varid));
+			Check(nc_put_att_text(ncid, varid, "long_name", longname.GetCount(), longname));
+			Check(nc_put_att_text(ncid, varid, "units", 1, "K"));
+			Check(nc_put_att_double(ncid, varid, "scale_factor", NC_DOUBLE, 1, &scale));
+			Check(nc_put_att_double(ncid, varid, "add_offset", NC_DOUBLE, 1, &offset));
+		}
+		Check(nc_enddef(ncid));
+		int values[4] = {1, 2, 3, 4};
+		for (int i = 0; i < cfg.nvars; ++i)
+			Check(nc_put_var_int(ncid, i, values));
+	} catch (...) {
+		nc_close(ncid);
+		throw;
+	}
+	Check(nc_close(ncid));
+}
+
+static void BenchMetadata(const Config &cfg, const Layout &l) {
+	String fn = FileName(cfg, Format("%s_header", l.format));
+	Json layout = Describe(l);
+	layout("nvars", cfg.nvars);
+
+	try {
+		WriteHeader(cfg, l, fn);
+	} catch (Exc err) {
+		Json json;
+		json("test", "header")("layout", layout)("skipped", err);
+		results << json;
+		Progress(Format("%s header skipped: %s", l.format, err));
+		return;
+	}
+	Add("header_size", layout, 0, GetFileLength(fn)/1024., "KB");
+
+	const int nopen = 10;
+	double t = Best(cfg.reps, [&] {
+		for (int i = 0; i < nopen; ++i) {
+			int ncid;
+			Check(nc_open(fn, NC_NOWRITE, &ncid));
+			Check(nc_close(ncid));
+		}
+	});
+	Add("open_close", layout, t, 1e3*t/nopen, "ms");
+
+	int ncid;
+	Check(nc_open(fn, NC_NOWRITE, &ncid));
+
+	// Open and close the file in the loop so that lazy reads count as well
+	t = Best(cfg.reps, [&] {
+		int ncid;
+		Check(nc_open(fn, NC_NOWRITE, &ncid));
+		for (int i = 0; i < cfg.nvars; ++i) {
+			int varid;
+			Check(nc_inq_varid(ncid, Format("var_%05d", i), &varid));
+		}
+		Check(nc_close(ncid));
+	});
+	Add("open_inq_all_varids", layout, t, 1e3*t, "ms");
+
+	Vector<String> names;
+	for (int i = 0; i < cfg.nvars; ++i)
+		names << Format("var_%05d", i);
+
+	t = Best(cfg.reps, [&] {
+		for (int i = 0; i < cfg.nvars; ++i) {
+			int varid;
+			Check(nc_inq_varid(ncid, names[i], &varid));
+		}
+	});
+	Add("inq_varid", layout, t, 1e6*t/cfg.nvars, "us");
+
+	t = Best(cfg.reps, [&] {
+		char name[NC_MAX_NAME + 1];
+		nc_type type;
+		int ndims, dimids[NC_MAX_VAR_DIMS], natts;
+		for (int i = 0; i < cfg.nvars; ++i)
+			Check(nc_inq_var(ncid, i, name, &type, &ndims, dimids, &natts));
+	});
+	Add("inq_var", layout, t, 1e6*t/cfg.nvars, "us");
+
+	t = Best(cfg.reps, [&] {
+		double scale;
+		for (int i = 0; i < cfg.nvars; ++i)
+			Check(nc_get_att_double(ncid, i, "scale_factor", &scale));
+	});
+	Add("get_att_double", layout, t, 1e6*t/cfg.nvars, "us");
+
+	t = Best(cfg.reps, [&] {
+		size_t index = 2;
+		int v;
+		for (int i = 0; i < cfg.nvars; ++i)
+			Check(nc_get_var1_int(ncid, i, &index, &v));
+	});
+	Add("get_var1_int", layout, t, 1e6*t/cfg.nvars, "us");
+
+	nc_close(ncid);
+	FileDelete(fn);
+}
+
+// A header of many names and no data, where the cost is the name hash tables
+static void BenchNames(const Config &cfg, const Layout &l) {
+	String fn = FileName(cfg, Format("%s_names", l.format));
+	Json layout = Describe(l);
+	layout("nnames", cfg.nnames);
+
+	Vector<String> names, missing;
+	for (int i = 0; i < cfg.nnames; ++i) {
+		names << Format("variable_%06d", i);
+		missing << Format("variable_%06d_", i);
+	}
+
+	double t;
+	try {
+		int ncid, oldfill;
+		Check(nc_create(fn, l.cmode|NC_CLOBBER, &ncid));
+		TimeStop ts;
+		try {
+			Check(nc_set_fill(ncid, NC_NOFILL, &oldfill));
+			for (int i = 0; i < cfg.nnames; ++i) {
+				int varid;
+				Check(nc_def_var(ncid, names[i], NC_BYTE, 0, NULL, &varid));
+			}
+		} catch (...) {
+			nc_close(ncid);
+			throw;
+		}
+		t = ts.Seconds();
+		Check(nc_close(ncid));
+	} catch (Exc err) {
+		Json json;
+		json("test", "names")("layout", layout)("skipped", err);
+		results << json;
+		Progress(Format("%s names skipped: %s", l.format, err));
+		return;
+	}
+	Add("names_def_var", layout, t, 1e6*t/cfg.nnames, "us");
+
+	int ncid;
+	t = Best(cfg.reps, [&] {
+		Check(nc_open(fn, NC_NOWRITE, &ncid));
+		Check(nc_close(ncid));
+	});
+	Add("names_open", layout, t, 1e3*t, "ms");
+
+	Check(nc_open(fn, NC_NOWRITE, &ncid));
+	t = Best(cfg.reps, [&] {
+		for (int i = 0; i < cfg.nnames; ++i) {
+			int varid;
+			Check(nc_inq_varid(ncid, names[i], &varid));
+		}
+	});
+	Add("names_inq_varid", layout, t, 1e9*t/cfg.nnames, "ns");
+
+	// Names that are not there, and only differ from one that is at the end
+	t = Best(cfg.reps, [&] {
+		for (int i = 0; i < cfg.nnames; ++i) {
+			int varid;
+			if (nc_inq_varid(ncid, missing[i], &varid) != NC_ENOTVAR)
+				throw Exc(Format("%s found", missing[i]));
+		}
+	});
+	Add("names_inq_varid_missing", layout, t, 1e9*t/cfg.nnames, "ns");
+
+	nc_close(ncid);
+	FileDelete(fn);
+}
+
+// Appends cfg.nrecords small records, a time and 4 values, one at a time, as a
+// logger does. With NC_SHARE the record count is written to the header at every
+// record, unless nc_set_numrecs_sync() says otherwise. Returns the seconds
+static double Append(const Config &cfg, const Layout &l, const String &fn, int share, int syncrecs, int syncmsecs) {
+	int ncid, dimids[2], timeid, varid;
+	TimeStop ts;
+	Check(nc_create(fn, l.cmode|share|NC_CLOBBER, &ncid));
+	try {
+		Check(nc_def_dim(ncid, "time", NC_UNLIMITED, &dimids[0]));
+		Check(nc_def_dim(ncid, "n", 4, &dimids[1]));
+		Check(nc_def_var(ncid, "time", NC_DOUBLE, 1, dimids, &timeid));
+		Check(nc_def_var(ncid, "data", NC_FLOAT, 2, dimids, &varid));
+		Check(nc_enddef(ncid));
+		if (syncrecs >= 0)
+			Check(nc_set_numrecs_sync(ncid, syncrecs, syncmsecs));
+		for (int i = 0; i < cfg.nrecords; ++i) {
+			size_t start[2] = {(size_t)i, 0}, count[2] = {1, 4};
+			double time = i;
+			float data[4] = {float(i), float(i + 1), float(i + 2), float(i + 3)};
+			Check(nc_put_var1_double(ncid, timeid, start, &time));
+			Check(nc_put_vara_float(ncid, varid, start, count, data));
+		}
+	} catch (...) {
+		nc_close(ncid);
+		throw;
+	}
+	Check(nc_close(ncid));
+	return ts.Seconds();
+}
+
+static void BenchAppend(const Config &cfg, const Layout &l) {
+	String fn = FileName(cfg, Format("%s_append", l.format));
+	Json layout = Describe(l);
+	layout("nrecords", cfg.nrecords);
+
+	double t;
+	try {
+		t = Append(cfg, l, fn, 0, -1, 0);
+	} catch (Exc err) {
+		Json json;
+		json("test", "append")("layout", layout)("skipped", err);
+		results << json;
+		Progress(Format("%s append skipped: %s", l.format, err));
+		return;
+	}
+	Add("append", layout, t, cfg.nrecords/t, "records/s");
+
+	t = Append(cfg, l, fn, NC_SHARE, -1, 0);
+	Add("append_share", layout, t, cfg.nrecords/t, "records/s");
+
+	// The count written every 1000 records or second
+	t = Append(cfg, l, fn, NC_SHARE, 1000, 1000);
+	Add("append_share_deferred", layout, t, cfg.nrecords/t, "records/s");
+
+	// A reader following the file: the record count re-read, against opening it again
+	int ncid;
+	Check(nc_open(fn, NC_NOWRITE, &ncid));
+	t = Best(cfg.reps, [&] {
+		size_t nrecs;
+		for (int i = 0; i < cfg.nopens; ++i)
+			Check(nc_refresh_numrecs(ncid, &nrecs));
+	});
+	nc_close(ncid);
+	Add("follow_refresh", layout, t, 1e6*t/cfg.nopens, "us");
+
+	t = Best(cfg.reps, [&] {
+		for (int i = 0; i < cfg.nopens; ++i) {
+			int id, dimid;
+			size_t nrecs;
+			Check(nc_open(fn, NC_NOWRITE, &id));
+			Check(nc_inq_unlimdim(id, &dimid));
+			Check(nc_inq_dimlen(id, dimid, &nrecs));
+			Check(nc_close(id));
+		}
+	});
+	Add("follow_reopen", layout, t, 1e6*t/cfg.nopens, "us");
+
+	FileDelete(fn);
+}
+
+// A small file, of the kind that is opened by the thousand
+static void WriteSmall(const Layout &l, const String &fn) {
+	int ncid, dimid, varid;
+	Check(nc_create(fn, l.cmode|NC_CLOBBER, &ncid));
+	int ret = nc_def_dim(ncid, "n", 16, &dimid);
+	if (!ret)
+		ret = nc_def_var(ncid, "data", NC_FLOAT, 1, &dimid, &varid);
+	if (!ret)
+		ret = nc_put_att_text(ncid, NC_GLOBAL, "title", 5, "small");
+	nc_close(ncid);
+	Check(ret);
+}
+
+static void BenchOpen(const Config &cfg, const Layout &l) {
+	String fn = GetFullPath(FileName(cfg, Format("%s_small", l.format)));
+	Json layout = Describe(l);
+
+	try {
+		WriteSmall(l, fn);
+	} catch (Exc err) {
+		Json json;
+		json("test", "open_latency")("layout", layout)("skipped", err);
+		results << json;
+		Progress(Format("%s open skipped: %s", l.format, err));
+		return;
+	}
+	auto OpenClose = [&](const char *name) {
+		for (int i = 0; i < cfg.nopens; ++i) {
+			int ncid;
+			Check(nc_open(name, NC_NOWRITE, &ncid));
+			Check(nc_close(ncid));
+		}
+	};
+	// Absolute paths take the quick way through nc_open, relative ones the general
+	double t = Best(cfg.reps, [&] {OpenClose(fn);});
+	Add("open_latency", layout, t, 1e6*t/cfg.nopens, "us");
+
+	String cwd = GetCurrentDirectory();
+	if (ChangeCurrentDirectory(GetFileFolder(fn))) {
+		String name = GetFileName(fn);
+		t = Best(cfg.reps, [&] {OpenClose(name);});
+		ChangeCurrentDirectory(cwd);
+		Add("open_latency_relative", layout, t, 1e6*t/cfg.nopens, "us");
+	}
+
+	// The same file received in memory, opened without copying it
+	String image = LoadFile(fn);
+	t = Best(cfg.reps, [&] {
+		for (int i = 0; i < cfg.nopens; ++i) {
+			int ncid;
+			Check(nc_open_mem("memory.nc", NC_NOWRITE, image.GetCount(), (void *)~image, &ncid));
+			Check(nc_close(ncid));
+		}
+	});
+	Add("open_latency_memory", layout, t, 1e6*t/cfg.nopens, "us");
+
+	// The library is already initialized here, so the first read is timed in a new process
+	double best = DBL_MAX;
+	for (int i = 0; i < cfg.reps; ++i) {
+		String out;
+		if (Sys(Format("\"%s\" -coldstart \"%s\"", GetExeFilePath(), fn), out) != 0)
+			throw Exc(Format("Cold start run failed: %s", out));
+		best = min(best, ScanDouble(out));
+	}
+	Add("cold_start_read", layout, best/1e6, best, "us");
+	FileDelete(fn);
+}
+
+// Run by BenchOpen() in a new process. Prints the time in us of the first open
+// and read of the program
+static void ColdStart(const char *fn) {
+	int64 t0 = usecs();
+	int ncid, varid;
+	float data[16];
+	Check(nc_open(fn, NC_NOWRITE, &ncid));
+	int ret = nc_inq_varid(ncid, "data", &varid);
+	if (!ret)
+		ret = nc_get_var_float(ncid, varid, data);
+	nc_close(ncid);
+	Check(ret);
+	Cout() << usecs(t0);
+}
+
+static void ParseTriple(const String &arg, int &a, int &b, int &c) {
+	Vector<String> v = Split(arg, ',');
+	if (v.size() != 3)
+		throw Exc(Format("Wrong triple '%s'", arg));
+	a = ScanInt(v[0]);
+	b = ScanInt(v[1]);
+	c = ScanInt(v[2]);
+	if (IsNull(a) || IsNull(b) || IsNull(c) || a < 1 || b < 1 || c < 1)
+		throw Exc(Format("Wrong triple '%s'", arg));
+}
+
+static Config ParseCommandLine() {
+	Config cfg;
+	cfg.dir = GetTempDirectory();
+	const Vector<String> &cl = CommandLine();
+	for (int i = 0; i < cl.size(); ++i) {
+		auto Next = [&]() -> String {
+			if (i + 1 >= cl.size())
+				throw Exc(Format("Missing value for %s", cl[i]));
+			return cl[++i];
+		};
+		auto NextInt = [&]() -> int {
+			String s = Next();
+			int n = ScanInt(s);
+			if (IsNull(n) || n < 1)
+				throw Exc(Format("Wrong value '%s'", s));
+			return n;
+		};
+		if (cl[i] == "-shape")
+			ParseTriple(Next(), cfg.nt, cfg.ny, cfg.nx);
+		else if (cl[i] == "-chunk")
+			ParseTriple(Next(), cfg.ct, cfg.cy, cfg.cx);
+		else if (cl[i] == "-unlimited")
+			cfg.unlimited = true;
+		else if (cl[i] == "-reps")
+			cfg.reps = NextInt();
+		else if (cl[i] == "-points")
+			cfg.npoints = NextInt();
+		else if (cl[i] == "-vars")
+			cfg.nvars = NextInt();
+		else if (cl[i] == "-names")
+			cfg.nnames = NextInt();
+		else if (cl[i] == "-opens")
+			cfg.nopens = NextInt();
+		else if (cl[i] == "-records")
+			cfg.nrecords = NextInt();
+		else if (cl[i] == "-dir")
+			cfg.dir = Next();
+		else if (cl[i] == "-out")
+			cfg.out = Next();
+		else
+			throw Exc(Format("Unknown option '%s'", cl[i]));
+	}
+	return cfg;
+}
+
+CONSOLE_APP_MAIN
+{
+	try {
+		const Vector<String> &cl = CommandLine();
+		if (cl.size() == 2 && cl[0] == "-coldstart") {
+			ColdStart(cl[1]);
+			return;
+		}
+		Config cfg = ParseCommandLine();
+
+		Progress(Format("NetCDF benchmark. Library %s", nc_inq_libvers()));
+
+		for (const Layout &l : layouts)
+			BenchData(cfg, l);
+		for (const Layout &l : layouts)
+			if (!l.chunked)
+				BenchMetadata(cfg, l);
+		for (const Layout &l : layouts)
+			if (!l.chunked)
+				BenchNames(cfg, l);
+		for (const Layout &l : layouts)
+			if (!l.chunked)
+				BenchOpen(cfg, l);
+		for (const Layout &l : layouts)
+			if (l.cmode != NC_NETCDF4)
+				BenchAppend(cfg, l);
+
+		Json config;
+		config("shape", Format("%d,%d,%d", cfg.nt, cfg.ny, cfg.nx))
+			  ("chunk", Format("%d,%d,%d", cfg.ct, cfg.cy, cfg.cx))
+			  ("unlimited", cfg.unlimited)
+			  ("reps", cfg.reps)
+			  ("points", cfg.npoints)
+			  ("vars", cfg.nvars)
+			  ("names", cfg.nnames)
+			  ("opens", cfg.nopens)
+			  ("records", cfg.nrecords);
+		Json json;
+		json("benchmark", "NetCDF_bench_cl")
+			("library", nc_inq_libvers())
+			("date", Format("%", GetSysTime()))
+			("config", config)
+			("results", results);
+		String str = AsJSON(ParseJSON(json.ToString()), true);
+
+		if (IsNull(cfg.out))
+			Cout() << str << "\n";
+		else if (!SaveFile(cfg.out, str))
+			throw Exc(Format("Impossible to save %s", cfg.out));
+	} catch (Exc err) {
+		Cerr() << "\n" << F(t_("Problem found: %s"), err) << "\n";
+		SetExitCode(-1);
+	}
+}
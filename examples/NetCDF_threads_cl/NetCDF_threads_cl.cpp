@@ -0,0 +1,143 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2021 - 2024, the Anboto author and contributors
+#include <Core/Core.h>
+
+using namespace Upp;
+
+#include <NetCDF/NetCDF.h>
+
+// Stress test and benchmark of the thread-safe build (flag NETCDF_THREADSAFE).
+// Classic files have a lock each, so threads working on different files run
+// in parallel. NetCDF-4 files share a single lock, as HDF5 is not re-entrant,
+// so they are only checked for correctness.
+
+static const int nfiles = 8;
+static const int nvalues = 1000000;
+
+static double Value(int file, int i) {return file*10000000. + i;}
+
+static String FileName(int file, bool hdf5) {
+	return AppendFileName(GetExeFolder(), Format("threads_%d%s.nc", file, hdf5 ? "_hdf5" : ""));
+}
+
+static void CreateFiles(bool hdf5) {
+	for (int f = 0; f < nfiles; ++f) {
+		Vector<double> data(nvalues);
+		for (int i = 0; i < nvalues; ++i)
+			data[i] = Value(f, i);
+		NetCDFFile cdf;
+		cdf.Create(FileName(f, hdf5), hdf5 ? NC_NETCDF4 : 0);
+		cdf.Set("data", data).SetAttribute("file", f);
+	}
+}
+
+// Each task opens a file, checks its contents and closes it
+static bool ReadFile(int f, bool hdf5) {
+	NetCDFFile cdf(FileName(f, hdf5));
+	Vector<double> data;
+	cdf.GetDouble("data", data);
+	if (data.size() != nvalues || cdf.GetAttributeInt("file") != f)
+		return false;
+	for (int i = 0; i < nvalues; i += 997)
+		if (data[i] != Value(f, i))
+			return false;
+	return true;
+}
+
+// Runs ntasks ReadFile() on nthreads threads and returns the elapsed seconds
+static double Run(int nthreads, int ntasks, bool hdf5, Atomic &errors) {
+	Atomic next(0);
+	TimeStop t;
+	Array<Thread> threads;
+	for (int th = 0; th < nthreads; ++th)
+		threads.Add().Run([&] {
+			try {
+				for (int task; (task = next++) < ntasks;)
+					if (!ReadFile(task % nfiles, hdf5))
+						errors++;
+			} catch (Exc err) {
+				UppLog() << "\n" << err;
+				errors++;
+			}
+		});
+	for (Thread &th : threads)
+		th.Wait();
+	return t.Seconds();
+}
+
+// Many threads reading hyperslabs of the same classic file. Opened read-only,
+// these reads take no lock. Returns the elapsed seconds
+static double SharedFile(int nthreads, Atomic &errors) {
+	int ncid, varid;
+	if (nc_open(FileName(0, false), NC_NOWRITE, &ncid) || nc_inq_varid(ncid, "data", &varid)) {
+		errors++;
+		return 0;
+	}
+	TimeStop t;
+	Array<Thread> threads;
+	for (int th = 0; th < nthreads; ++th)
+		threads.Add().Run([&, th] {
+			Buffer<double> buf(1000);
+			for (int it = 0; it < 16000/nthreads; ++it) {
+				size_t start = (size_t)((th*7919 + it*104729) % (nvalues - 1000)), count = 1000;
+				if (nc_get_vara_double(ncid, varid, &start, &count, buf) || buf[0] != Value(0, (int)start) 
+					|| buf[999] != Value(0, (int)start + 999))
+					errors++;
+			}
+		});
+	for (Thread &th : threads)
+		th.Wait();
+	double ret = t.Seconds();
+	nc_close(ncid);
+	return ret;
+}
+
+CONSOLE_APP_MAIN
+{
+	StdLogSetup(LOG_COUT|LOG_FILE);
+	
+	try {
+		UppLog() << "\nNetCDF thread-safety test\n";
+#ifndef flagNETCDF_THREADSAFE
+		UppLog() << "\nWarning: built without NETCDF_THREADSAFE flag, results will be wrong\n";
+#endif
+		CreateFiles(false);
+		CreateFiles(true);
+		
+		int ncpu = CPU_Cores();
+		int ntasks = 16*nfiles;
+		Atomic errors(0);
+		
+		double t1 = Run(1, ntasks, false, errors);
+		UppLog() << Format("\nClassic, 1 thread:   %.3f s", t1);
+		for (int nth = 2; nth <= max(2*ncpu, 4); nth *= 2) {
+			double t = Run(nth, ntasks, false, errors);
+			UppLog() << Format("\nClassic, %d threads: %.3f s, speedup %.2f", nth, t, t1/t);
+		}
+		double t5 = Run(1, ntasks/4, true, errors);
+		double t5n = Run(max(ncpu, 4), ntasks/4, true, errors);
+		UppLog() << Format("\nNetCDF-4, 1 thread: %.3f s, %d threads: %.3f s (serialized)", t5, max(ncpu, 4), t5n);
+		
+		double s1 = SharedFile(1, errors);
+		double sn = SharedFile(max(ncpu, 4), errors);
+		UppLog() << Format("\nShared classic file, 1 thread: %.3f s, %d threads: %.3f s, speedup %.2f", 
+							s1, max(ncpu, 4), sn, s1/sn);
+		
+		for (int f = 0; f < nfiles; ++f) {
+			FileDelete(FileName(f, false));
+			FileDelete(FileName(f, true));
+		}
+		if (errors > 0)
+			throw Exc(Format("%d errors found", (int)errors));
+		
+		UppLog() << "\n\nAll tests OK\n";
+	} catch (Exc err) {
+		UppLog() << "\n" << F(t_("Problem found: %s"), err);
+		SetExitCode(-1);
+	}
+		
+	UppLog() << "\nProgram ended\n";
+	#ifdef flagDEBUG
+	ReadStdIn();
+	#endif
+}
@@ -167,6 +167,11 @@ are set when opening a binary file on Windows. */
 /* if true, Allow dynamically loaded plugins */
 #define ENABLE_PLUGINS 1
 
+/* if true, build the thread-safe library (U++ flag NETCDF_THREADSAFE) */
+#if defined(flagNETCDF_THREADSAFE)
+#define ENABLE_THREADSAFE 1
+#endif
+
 /* if true, run extra tests which may not work yet */
 /* #undef EXTRA_TESTS */
 
@@ -66,6 +66,7 @@ typedef struct NC_HDF5_FILE_INFO {
    hid_t hdfid;
    unsigned transientid; /* counter for transient ids */
    NCURI* uri; /* Parse of the incoming path, if url */
+   NC_io_stats stats; /* See nc_inq_io_stats() */
 #if defined(NETCDF_ENABLE_BYTERANGE)
    int byterange;
 #endif
@@ -157,6 +158,7 @@ int nc4_reform_coord_var(NC_GRP_INFO_T *grp, NC_VAR_INFO_T *coord_var, NC_DIM_IN
 /* In-memory functions */
 extern hid_t NC4_image_init(NC_FILE_INFO_T* h5);
 extern void NC4_image_finalize(void*);
+extern void NC4_image_term(void);
 
 /* Create HDF5 dataset for dim without a coord var. */
 extern int nc4_create_dim_wo_var(NC_DIM_INFO_T *dim);
@@ -208,6 +210,22 @@ int NC4_hdf5_addfilter(NC_VAR_INFO_T* var, unsigned int id, size_t nparams, cons
 int NC4_hdf5_filter_freelist(NC_VAR_INFO_T* var);
 int NC4_hdf5_find_missing_filter(NC_VAR_INFO_T* var, unsigned int* idp);
 
+/* Threaded chunk filter pipeline (hdf5chunk.c) */
+int NC4_hdf5_put_chunks(NC_FILE_INFO_T* h5, NC_VAR_INFO_T* var, const hsize_t* fdims,
+                        const hsize_t* start, const hsize_t* count, const void* data,
+                        hid_t xfer_plistid, int* donep);
+int NC4_hdf5_get_chunks(NC_FILE_INFO_T* h5, NC_VAR_INFO_T* var, const hsize_t* fdims,
+                        const hsize_t* start, const hsize_t* count, void* data,
+                        hid_t xfer_plistid, int* donep);
+int NC4_hdf5_copy_chunks(int ncid_in, int varid_in, int ncid_out, int varid_out,
+                         int* donep);
+
+/* I/O statistics (hdf5file.c) */
+#define NC4_HDF5_STATS(h5) (&((NC_HDF5_FILE_INFO_T*)(h5)->format_file_info)->stats)
+int NC4_hdf5_inq_io_stats(int ncid, NC_io_stats* statsp);
+int NC4_hdf5_reset_io_stats(int ncid);
+void NC4_hdf5_chunk_finalize(void);
+
 /* Add an attribute to the attribute list. */
 int nc4_put_att(NC_GRP_INFO_T* grp, int varid, const char *name, nc_type file_type,
 		size_t len, const void *data, nc_type mem_type, int force);
@@ -228,5 +246,7 @@ int hdf5set_format_compatibility(hid_t fapl_id);
 extern int nc4_hdf5_initialized;
 extern void nc4_hdf5_initialize(void);
 extern void nc4_hdf5_finalize(void);
+/* Start HDF5 on first use; see hdf5dispatch.c */
+extern int NC_HDF5_startup(void);
 
 #endif /* _HDF5INTERNAL_ */
@@ -27,6 +27,10 @@ typedef struct NC {
 	void* dispatchdata; /*per-'file' data; points to e.g. NC3_INFO data*/
 	char* path;
 	int   mode; /* as provided to nc_open/nc_create */
+	struct NCmutex* lock; /* per-file lock of the thread-safe build; see nclock.h */
+	int concurrentreads; /* data reads need no lock; see nclock.h */
+	const struct NC_Dispatch* traced; /* dispatch table wrapped by the tracing layer; see nctrace.h */
+	int fd; /* descriptor nc_open read the magic number from, for the classic backend to reuse; -1 if none */
 } NC;
 
 /*
@@ -43,6 +43,13 @@
 struct ncio;
 typedef struct NC3_INFO NC3_INFO;
 
+/* Blocks holding the header objects of a file opened read only,
+   see v1hpg.c */
+typedef struct NC3_arena NC3_arena;
+
+extern void
+NC3_arena_free(NC3_arena *arena);
+
 /*
  *  The internal data types
  */
@@ -127,6 +134,9 @@ typedef struct NC_attrarray {
 extern void
 free_NC_attr(NC_attr *attrp);
 
+extern size_t
+ncx_len_NC_attrV(nc_type type, size_t nelems);
+
 extern NC_attr *
 new_x_NC_attr(
     NC_string *strp,
@@ -246,11 +256,18 @@ struct NC3_INFO {
 #else
     size_t recsize;  /* length of 'record' */
 #endif
+    /* When NCvnrecs() writes numrecs, see nc_set_numrecs_sync().
+       Both zero: only NC_sync() writes it. */
+    size_t nsync_recs;  /* after this many records added */
+    unsigned long long nsync_nsecs;  /* or this long after the last write */
+    size_t synced_numrecs;  /* numrecs in the file */
+    unsigned long long synced_nsecs;  /* NC_nanotime() of the last write */
     /* below gets xdr'd */
     size_t numrecs; /* number of 'records' allocated */
     NC_dimarray dims;
     NC_attrarray attrs;
     NC_vararray vars;
+    NC3_arena *arena; /* holds dims, attrs and vars if read only, else NULL */
 };
 
 #define NC_readonly(ncp)                        \
@@ -286,11 +303,25 @@ struct NC3_INFO {
 #define NC_doNsync(ncp)                         \
     fIsSet((ncp)->state, NC_NSYNC)
 
+/*
+ * numrecs is loaded and stored atomically: nc_refresh_numrecs() may
+ * change it while data reads that take no lock look at it (see
+ * NC_LOCKED_READ). Relaxed order is enough, the count is the only
+ * thing that changes.
+ */
+#if defined(_MSC_VER) && !defined(__clang__)
+#  define NC_get_numrecs(nc3i)                  \
+    (*(volatile size_t *)&(nc3i)->numrecs)
+
+#  define NC_set_numrecs(nc3i, nrecs)           \
+    {*(volatile size_t *)&(nc3i)->numrecs = (nrecs);}
+#else
 #  define NC_get_numrecs(nc3i)                  \
-    ((nc3i)->numrecs)
+    __atomic_load_n(&(nc3i)->numrecs, __ATOMIC_RELAXED)
 
 #  define NC_set_numrecs(nc3i, nrecs)           \
-    {(nc3i)->numrecs = (nrecs);}
+    {__atomic_store_n(&(nc3i)->numrecs, (size_t)(nrecs), __ATOMIC_RELAXED);}
+#endif
 
 #  define NC_increase_numrecs(nc3i, nrecs)                              \
     {if((nrecs) > (nc3i)->numrecs) ((nc3i)->numrecs = (nrecs));}
@@ -309,6 +340,9 @@ read_numrecs(NC3_INFO* ncp);
 extern int
 write_numrecs(NC3_INFO* ncp);
 
+extern int
+NC_numrecs_sync(NC3_INFO* ncp);
+
 extern int
 NC_sync(NC3_INFO* ncp);
 
@@ -209,6 +209,18 @@ typedef struct NC_FIELD_INFO
     void *format_field_info;  /**< Pointer to any binary format info for field. */
 } NC_FIELD_INFO_T;
 
+/** One member of a variable sized compound type that holds
+ * pointers: count strings, VLENs or variable sized compounds at
+ * offset. Members of nested compounds are listed with their offset
+ * in the outer one. */
+typedef struct NC_PTR_MEMBER
+{
+    size_t offset;              /**< Offset in bytes in the instance. */
+    size_t count;               /**< Number of values. */
+    nc_type nc_typeid;          /**< NC_STRING, or a user type. */
+    struct NC_TYPE_INFO *type;  /**< Type info, NULL for NC_STRING. */
+} NC_PTR_MEMBER;
+
 /** This is a struct to handle metadata for a user-defined enum
  * type. */
 typedef struct NC_ENUM_MEMBER_INFO
@@ -229,6 +241,8 @@ typedef struct NC_TYPE_INFO
     nc_type nc_type_class;       /**< NC_VLEN, NC_COMPOUND, NC_OPAQUE, NC_ENUM, NC_INT, NC_FLOAT, or NC_STRING. */
     void *format_type_info;      /**< dispatcher-specific type info. */
     int varsized; 	         /**< <! 1 if this type is (recursively) variable sized; 0 if fixed size */
+    size_t nptrs;                /**< Number of entries in ptrs. */
+    NC_PTR_MEMBER *ptrs;         /**< Variable sized compounds: the members to follow when copying or reclaiming instances, by offset. Built by the first NC_copy_data() or NC_reclaim_data() that needs it. */
 
     /** Information for each type or class */
     union {
@@ -254,6 +268,7 @@ typedef struct NC_GRP_INFO
     struct NC_FILE_INFO *nc4_info; /**< Pointer containing NC_FILE_INFO_T. */
     struct NC_GRP_INFO *parent;  /**< Pointer tp parent group. */
     int atts_read;               /**< True if atts have been read for this group. */
+    nc_bool_t lazy;              /**< True if the group's contents have not been read from the file yet. */
     NCindex* children;           /**< NCindex<struct NC_GRP_INFO*> */
     NCindex* dim;                /**< NCindex<NC_DIM_INFO_T> * */
     NCindex* att;                /**< NCindex<NC_ATT_INFO_T> * */
@@ -286,6 +301,7 @@ typedef struct NC_FILE_INFO
     int fill_mode;        /**< Fill mode for vars - Unused internally currently */
     nc_bool_t no_write;   /**< true if nc_open has mode NC_NOWRITE. */
     NC_GRP_INFO_T *root_grp; /**< Pointer to root group. */
+    int (*read_grp)(NC_GRP_INFO_T *grp); /**< Reads the contents of a lazy group; format dependent. */
     short next_nc_grpid;  /**< Next available group ID. */
     int next_typeid;      /**< Next available type ID. */
     int next_dimid;       /**< Next available dim ID. */
@@ -295,12 +311,14 @@ typedef struct NC_FILE_INFO
     NClist *alldims;   /**< List of all dims. */
     NClist *alltypes;  /**< List of all types. */
     NClist *allgroups; /**< List of all groups, including root group. */
+    struct NC4_arena *arena; /**< Blocks holding the groups, vars, dims and atts, and their names. */
     void *format_file_info; /**< Pointer to binary format info for file. */
     NC4_Provenance provenance; /**< File provenence info. */
     struct NC4_Memio
     {
         NC_memio memio; /**< What we sent to image_init and what comes back. */
         int locked;     /**< Do not copy and do not free. */
+        int copyonwrite; /**< Share the memory and copy only the pages written. */
         int persist;    /**< Should file be persisted out on close? */
         int inmemory;   /**< NC_INMEMORY flag was set. */
         int diskless;   /**< NC_DISKLESS flag was set => inmemory. */
@@ -330,6 +348,7 @@ extern int nc4_convert_type(const void *src, void *dest, const nc_type src_type,
 /* These functions do netcdf-4 things. */
 extern int nc4_reopen_dataset(NC_GRP_INFO_T *grp, NC_VAR_INFO_T *var);
 extern int nc4_read_atts(NC_GRP_INFO_T *grp, NC_VAR_INFO_T *var);
+extern int nc4_read_grp(NC_GRP_INFO_T *grp);
 
 /* Find items in the in-memory lists of metadata. */
 extern int nc4_find_nc_grp_h5(int ncid, NC **nc, NC_GRP_INFO_T **grp,
@@ -383,7 +402,8 @@ extern int nc4_type_free(NC_TYPE_INFO_T *type);
 extern int nc4_field_list_add(NC_TYPE_INFO_T* parent, const char *name,
                        size_t offset, nc_type xtype, int ndims,
                        const int *dim_sizesp);
-extern int nc4_att_list_add(NCindex *list, const char *name, NC_ATT_INFO_T **att);
+extern int nc4_att_list_add(NC_FILE_INFO_T *h5, NCindex *list, const char *name,
+                      NC_ATT_INFO_T **att);
 extern int nc4_att_list_del(NCindex *list, NC_ATT_INFO_T *att);
 extern int nc4_grp_list_add(NC_FILE_INFO_T *h5, NC_GRP_INFO_T *parent, char *name,
                      NC_GRP_INFO_T **grp);
@@ -392,6 +412,7 @@ extern int nc4_rec_grp_del(NC_GRP_INFO_T *grp);
 extern int nc4_enum_member_add(NC_TYPE_INFO_T *type, size_t size, const char *name,
                         const void *value);
 extern int nc4_att_free(NC_ATT_INFO_T *att);
+extern char *nc4_arena_strdup(NC_FILE_INFO_T *h5, const char *name);
 
 /* Check and normalize names. */
 extern int NC_check_name(const char *name);
@@ -7,10 +7,15 @@ See COPYRIGHT for license information.
 CRC32 and CRC64 implementations from Mark Adler
 */
 
+#include <stddef.h>
+
 #ifndef NCCRC_H
 #define NCCRC_H 1
 
 EXTERNL unsigned int NC_crc32(unsigned int crc, const void* buf, unsigned int len);
 EXTERNL unsigned long long NC_crc64(unsigned long long crc, void* buf, unsigned int len);
 
+/* Fast hash of the keys of the in-memory tables; not for checksums (dhash.c) */
+EXTERNL unsigned long long NC_hash64(const void* key, size_t len);
+
 #endif /*NCCRC_H*/
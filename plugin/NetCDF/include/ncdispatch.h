@@ -23,6 +23,7 @@
 #include "netcdf.h"
 #include "ncmodel.h"
 #include "nc.h"
+#include "nclock.h"
 #include "ncuri.h"
 #ifdef USE_PARALLEL
 #include "netcdf_par.h"
@@ -100,6 +101,15 @@ typedef struct NC_MPI_INFO {
 extern int NCDISPATCH_initialize(void);
 extern int NCDISPATCH_finalize(void);
 
+/* Subsystems that a program may never use (rc files, plugins, HDF5)
+   are initialized on first use: NC_once(&once,init) runs init() the
+   first time it is called with once, an int that starts as
+   NC_ONCE_INIT. Other threads wait until init() has returned; a call
+   from within init() itself returns at once. If init() fails, the
+   next call runs it again. */
+#define NC_ONCE_INIT 0
+extern int NC_once(int* oncep, int (*init)(void));
+
 extern const NC_Dispatch* NC3_dispatch_table;
 extern int NC3_initialize(void);
 extern int NC3_finalize(void);
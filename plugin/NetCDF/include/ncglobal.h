@@ -56,6 +56,7 @@ typedef struct NCglobalstate {
         size_t nelems;   /**< Number of slots in var chunk cache. */
         float preemption; /**< Chunk cache preemtion policy. */
     } chunkcache;
+    int chunkthreads; /**< Worker threads for the chunk filter pipeline; <= 1 => serial HDF5 pipeline */
 } NCglobalstate;
 
 /* Externally visible */
@@ -31,7 +31,11 @@ e.g. crc64 or such.  Needs some thought.
 /*! Hashmap-related structs.
   NOTES:
   1. 'data' is the an arbitrary uintptr_t integer or void* pointer.
-  2. hashkey is a crc32 hash of key
+  2. hashkey is a hash of key (NC_hash64() folded to 32 bits)
+  3. tags[i] mirrors table[i]: 0 if empty, 1 if deleted, else a
+     value derived from the hashkey. Probing scans the tags, that
+     are packed 16 per cache line, and only looks at an entry, and
+     its key, when its tag matches.
     
   WARNINGS:
   1. It is critical that |uintptr_t| == |void*|
@@ -46,7 +50,7 @@ e.g. crc64 or such.  Needs some thought.
 typedef struct NC_hentry {
     int flags;
     uintptr_t data;
-    nchashkey_t hashkey; /* Hash id (crc)*/
+    nchashkey_t hashkey; /* Hash id */
     size_t keysize;
     char* key; /* copy of the key string; kept as unsigned char */
 } NC_hentry;
@@ -59,6 +63,7 @@ typedef struct NC_hashmap {
   size_t alloc; /* allocated # of entries */
   size_t active; /* # of active entries */
   NC_hentry* table;
+  nchashkey_t* tags; /* |tags| == alloc */
 } NC_hashmap;
 
 /* defined in nchashmap.c */
@@ -0,0 +1,71 @@
+/* Copyright 2018, UCAR/Unidata and OPeNDAP, Inc.
+   See the COPYRIGHT file for more information. */
+#ifndef NCLOCK_H
+#define NCLOCK_H 1
+
+/*
+Locking for the thread-safe build (ENABLE_THREADSAFE).
+
+- The global lock protects the table of open files (NCList), the
+  global state object and the .rc tables. It is always the innermost
+  lock: code holding it must not take any other lock.
+- Every classic (netcdf-3, 64-bit offset, CDF-5) file has its own
+  lock, held for the duration of each dispatch call on that file, so
+  different classic files can be used from different threads at the
+  same time.
+- All other files (netCDF-4/HDF5, HDF4, user defined formats) share
+  the library lock, because HDF5 is not re-entrant. The library lock
+  also serializes library initialization and the plugin path registry.
+
+All locks are recursive because dispatch code calls back into the
+public API. Using an ncid in one thread while another closes it is
+still an error. In the default build the macros expand to nothing.
+
+Classic files opened read-only without NC_SHARE keep no mutable state
+on the data read path (see ncio.concurrent), so nc_get_var* calls on
+them take no lock at all and threads read the same file in parallel.
+Other calls still take the file lock; nc_sync() re-reads the header of
+such files and must not run while other threads read them.
+*/
+
+#include "nc.h"
+
+#ifdef ENABLE_THREADSAFE
+
+extern void NC_lock_global(void);
+extern void NC_unlock_global(void);
+extern void NC_lock_library(void);
+extern void NC_unlock_library(void);
+/* Give ncp its own lock if its dispatcher can run concurrently */
+extern int NC_lock_new(NC* ncp);
+extern void NC_lock_free(NC* ncp);
+/* Lock the file, or the library lock if the file has no lock of its own */
+extern void NC_lock(NC* ncp);
+/* Unlock the file and pass stat through */
+extern int NC_unlock(NC* ncp, int stat);
+
+#define NCLOCKGLOBAL() NC_lock_global()
+#define NCUNLOCKGLOBAL() NC_unlock_global()
+#define NCLOCKLIBRARY() NC_lock_library()
+#define NCUNLOCKLIBRARY() NC_unlock_library()
+#define NCLOCK(ncp) NC_lock(ncp)
+#define NCUNLOCK(ncp) ((void)NC_unlock((ncp),NC_NOERR))
+/* Evaluate a dispatch call with the file locked */
+#define NC_LOCKED(ncp,call) (NC_lock(ncp),NC_unlock((ncp),(call)))
+/* Same, for data reads, which need no lock if ncp->concurrentreads */
+#define NC_LOCKED_READ(ncp,call) ((ncp)->concurrentreads ? (call) : NC_LOCKED(ncp,call))
+
+#else /*!ENABLE_THREADSAFE*/
+
+#define NCLOCKGLOBAL()
+#define NCUNLOCKGLOBAL()
+#define NCLOCKLIBRARY()
+#define NCUNLOCKLIBRARY()
+#define NCLOCK(ncp)
+#define NCUNLOCK(ncp)
+#define NC_LOCKED(ncp,call) (call)
+#define NC_LOCKED_READ(ncp,call) (call)
+
+#endif /*ENABLE_THREADSAFE*/
+
+#endif /*NCLOCK_H*/
@@ -20,5 +20,7 @@ typedef struct NCmodel {
 
 /* Infer model implementation */
 EXTERNL int NC_infermodel(const char* path, int* omodep, int iscreate, int useparallel, void* params, NCmodel* model, char** newpathp);
+/* Quick path of NC_infermodel for absolute local paths; returns NC_EURL if not applicable */
+EXTERNL int NC_infermodel_local(const char* path, int* omodep, int useparallel, NCmodel* model, int* fdp);
 
 #endif /*NCINFERMODEL_H*/
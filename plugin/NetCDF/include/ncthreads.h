@@ -0,0 +1,56 @@
+/* Copyright 2018, UCAR/Unidata and OPeNDAP, Inc.
+   See the COPYRIGHT file for more information. */
+#ifndef NCTHREADS_H
+#define NCTHREADS_H 1
+
+#include "ncexternl.h"
+#include <stddef.h>
+
+/*
+Minimal portable threading support: a fixed size pool of worker
+threads that runs "parallel for" style jobs. The thread calling
+ncthreadpool_run takes part in the job, so a pool of n threads
+keeps n+1 cores busy.
+
+The task function is called from worker threads; it must not call
+into HDF5 or any other part of the library that is not thread-safe.
+*/
+
+#if defined(_CPLUSPLUS_) || defined(__CPLUSPLUS__)
+extern "C" {
+#endif
+
+typedef struct NCthreadpool NCthreadpool;
+typedef struct NCmutex NCmutex;
+
+/* Run task number "task" of a job; arg is shared by all tasks */
+typedef void (*NCtaskfcn)(void* arg, size_t task);
+
+/* Create a pool with nthreads workers */
+EXTERNL int ncthreadpool_new(int nthreads, NCthreadpool** poolp);
+/* Stop and join the workers and free the pool */
+EXTERNL void ncthreadpool_free(NCthreadpool*);
+/* Number of worker threads in the pool */
+EXTERNL int ncthreadpool_size(const NCthreadpool*);
+/* Run fcn(arg,0..ntasks-1) across the pool; returns when all tasks are done */
+EXTERNL int ncthreadpool_run(NCthreadpool*, size_t ntasks, NCtaskfcn fcn, void* arg);
+
+/* Recursive mutex: the owning thread may lock it again */
+EXTERNL int ncmutex_new(NCmutex** mutexp);
+EXTERNL void ncmutex_free(NCmutex*);
+EXTERNL void ncmutex_lock(NCmutex*);
+EXTERNL void ncmutex_unlock(NCmutex*);
+
+/* Scratch buffer of at least size bytes private to the calling thread.
+   It stays valid until the next call from the same thread and is freed
+   when the thread exits. Returns NULL if out of memory. */
+EXTERNL void* ncthreadbuffer(size_t size);
+
+/* Number of processors available to this process */
+EXTERNL int ncnumcpus(void);
+
+#if defined(_CPLUSPLUS_) || defined(__CPLUSPLUS__)
+}
+#endif
+
+#endif /*NCTHREADS_H*/
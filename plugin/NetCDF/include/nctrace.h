@@ -0,0 +1,78 @@
+/* Copyright 2018, UCAR/Unidata and OPeNDAP, Inc.
+   See the COPYRIGHT file for more information. */
+#ifndef NCTRACE_H
+#define NCTRACE_H 1
+
+/*
+Dispatch tracing (dtrace.c).
+
+While tracing is on (nc_set_dispatch_trace() or the NCDISPATCHTRACE
+environment variable) every file opened or created gets a copy of its
+dispatch table whose entries time the call, count it, and then call
+the real entry, which is kept in NC.traced. Files opened before
+tracing was switched on are not traced; switching it off makes the
+wrappers of traced files pass calls straight through.
+
+For each dispatch function the layer keeps the number of calls and
+errors, the total and maximum latency, a log2 latency histogram and
+the bytes of data moved. Every call is also stored in a ring buffer
+of the last NCTRACE_RING calls. All updates are lock free, so the
+wrappers may run from several threads at once.
+*/
+
+#include "nc.h"
+
+/* Number of calls kept in the ring buffer, a power of 2 */
+#define NCTRACE_RING (1<<16)
+/* Latency histogram buckets; bucket i counts calls of 2^i..2^(i+1)-1 ns */
+#define NCTRACE_BUCKETS 40
+
+/* Names of the environment variables read at initialization: the
+   file the trace is written to at exit, and its format ("json" or
+   "chrome") */
+#define NCENVDISPATCHTRACE "NCDISPATCHTRACE"
+#define NCENVDISPATCHTRACEFORMAT "NCDISPATCHTRACEFORMAT"
+
+/* Ids of the functions traced; create and open are recorded by dfile.c */
+enum NCtracefunc {
+    NCTRACE_create, NCTRACE_open, NCTRACE_redef, NCTRACE__enddef,
+    NCTRACE_sync, NCTRACE_abort, NCTRACE_close, NCTRACE_set_fill,
+    NCTRACE_inq_format, NCTRACE_inq_format_extended, NCTRACE_inq,
+    NCTRACE_inq_type, NCTRACE_def_dim, NCTRACE_inq_dimid, NCTRACE_inq_dim,
+    NCTRACE_inq_unlimdim, NCTRACE_rename_dim, NCTRACE_inq_att,
+    NCTRACE_inq_attid, NCTRACE_inq_attname, NCTRACE_rename_att,
+    NCTRACE_del_att, NCTRACE_get_att, NCTRACE_put_att, NCTRACE_def_var,
+    NCTRACE_inq_varid, NCTRACE_rename_var, NCTRACE_get_vara,
+    NCTRACE_put_vara, NCTRACE_get_vars, NCTRACE_put_vars, NCTRACE_get_varm,
+    NCTRACE_put_varm, NCTRACE_inq_var_all, NCTRACE_var_par_access,
+    NCTRACE_def_var_fill, NCTRACE_show_metadata, NCTRACE_inq_unlimdims,
+    NCTRACE_inq_ncid, NCTRACE_inq_grps, NCTRACE_inq_grpname,
+    NCTRACE_inq_grpname_full, NCTRACE_inq_grp_parent,
+    NCTRACE_inq_grp_full_ncid, NCTRACE_inq_varids, NCTRACE_inq_dimids,
+    NCTRACE_inq_typeids, NCTRACE_inq_type_equal, NCTRACE_def_grp,
+    NCTRACE_rename_grp, NCTRACE_inq_user_type, NCTRACE_inq_typeid,
+    NCTRACE_def_compound, NCTRACE_insert_compound,
+    NCTRACE_insert_array_compound, NCTRACE_inq_compound_field,
+    NCTRACE_inq_compound_fieldindex, NCTRACE_def_vlen,
+    NCTRACE_put_vlen_element, NCTRACE_get_vlen_element, NCTRACE_def_enum,
+    NCTRACE_insert_enum, NCTRACE_inq_enum_member, NCTRACE_inq_enum_ident,
+    NCTRACE_def_opaque, NCTRACE_def_var_deflate, NCTRACE_def_var_fletcher32,
+    NCTRACE_def_var_chunking, NCTRACE_def_var_endian, NCTRACE_def_var_filter,
+    NCTRACE_set_var_chunk_cache, NCTRACE_get_var_chunk_cache,
+    NCTRACE_inq_var_filter_ids, NCTRACE_inq_var_filter_info,
+    NCTRACE_def_var_quantize, NCTRACE_inq_var_quantize,
+    NCTRACE_inq_filter_avail,
+    NCTRACE_NFUNCS
+};
+
+/* Read the environment; called by NCDISPATCH_initialize() */
+extern int NC_trace_initialize(void);
+/* Non-zero while tracing is on */
+extern int NC_trace_on(void);
+/* Make ncp use the tracing copy of its dispatch table */
+extern void NC_trace_install(NC* ncp);
+/* Record a call of func on ncid that started at t0 (NC_nanotime()) */
+extern void NC_trace_record(int func, int ncid, unsigned long long t0,
+                            unsigned long long bytes, int stat);
+
+#endif /*NCTRACE_H*/
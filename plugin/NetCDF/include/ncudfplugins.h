@@ -24,6 +24,9 @@ extern "C" {
  * then dynamically loads the plugin libraries and calls their
  * initialization functions.
  * 
+ * Only the first call does anything; it is made by nc_open(),
+ * nc_create() and the user format functions, not at initialization.
+ *
  * @return NC_NOERR on success (even if no plugins are configured or
  *         some plugins fail to load), error code on critical failure.
  *
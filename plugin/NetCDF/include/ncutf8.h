@@ -6,6 +6,7 @@
 #ifndef NCUTF8_H
 #define NCUTF8_H 1
 
+#include <stddef.h>
 #include "ncexternl.h"
 
 /* Provide a wrapper around whatever utf8 library we use. */
@@ -32,6 +33,14 @@ EXTERNL int nc_utf8_validate(const unsigned char * name);
  */
 EXTERNL int nc_utf8_normalize(const unsigned char* str, unsigned char** normalp);
 
+/*
+ * Return 1 if the len bytes of str are all ASCII (< 0x80), else 0.
+ * An ASCII string is valid utf8 and is its own NFC normalization,
+ * so callers that only need to read the normalized name can use
+ * str as is, without nc_utf8_normalize() and its allocation.
+ */
+EXTERNL int nc_utf8_isascii(const unsigned char* str, size_t len);
+
 /*
  * Convert a normalized utf8 string to utf16. This is approximate
  * because it just does the truncation version of conversion for
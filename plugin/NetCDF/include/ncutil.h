@@ -98,6 +98,7 @@ EXTERNL int NC_joinwith(struct NClist* segments, const char* sep, const char* pr
 EXTERNL void NC_sortenvv(size_t n, char** envv);
 EXTERNL void NC_sortlist(struct NClist* l);
 EXTERNL void NC_freeenvv(size_t nkeys, char** keys);
+EXTERNL unsigned long long NC_nanotime(void);
 
 #if defined(__cplusplus)
 }
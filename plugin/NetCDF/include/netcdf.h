@@ -1076,6 +1076,14 @@ nc_set_chunk_cache(size_t size, size_t nelems, float preemption);
 EXTERNL int
 nc_get_chunk_cache(size_t *sizep, size_t *nelemsp, float *preemptionp);
 
+/* Set the number of threads used to (de)compress chunks. */
+EXTERNL int
+nc_set_chunk_threads(int nthreads);
+
+/* Get the number of threads used to (de)compress chunks. */
+EXTERNL int
+nc_get_chunk_threads(int *nthreadsp);
+
 /* Set the per-variable cache size, nelems, and preemption policy. */
 EXTERNL int
 nc_set_var_chunk_cache(int ncid, int varid, size_t size, size_t nelems,
@@ -1133,6 +1141,58 @@ nc_inq_format(int ncid, int *formatp);
 EXTERNL int
 nc_inq_format_extended(int ncid, int *formatp, int* modep);
 
+/** I/O statistics of an open file, returned by nc_inq_io_stats().
+ * Counters that do not apply to the format of the file stay zero. */
+typedef struct NC_io_stats {
+    unsigned long long bytes_read;     /**< Bytes read: from the file for classic files, of variable data for netCDF-4. */
+    unsigned long long bytes_written;  /**< Bytes written, as for bytes_read. */
+    unsigned long long gets;           /**< Region requests to the classic I/O layer. */
+    unsigned long long reads;          /**< Read system calls (classic), HDF5 dataset and raw chunk reads (netCDF-4). */
+    unsigned long long writes;         /**< Write system calls (classic), HDF5 dataset and raw chunk writes (netCDF-4). */
+    unsigned long long cache_hits;     /**< Classic region requests served without reading the file. */
+    unsigned long long cache_misses;   /**< Classic region requests that read the file. */
+    unsigned long long chunks_read;    /**< netCDF-4 chunks read with direct chunk I/O. */
+    unsigned long long chunks_written; /**< netCDF-4 chunks written with direct chunk I/O. */
+    unsigned long long convert_nsecs;  /**< Time spent converting data between file and memory types, in ns. */
+    double mdc_hit_rate;               /**< HDF5 metadata cache hit rate, -1 if not available. */
+} NC_io_stats;
+
+/* Get the I/O statistics of an open file. */
+EXTERNL int
+nc_inq_io_stats(int ncid, NC_io_stats *statsp);
+
+/* Set the I/O statistics of an open file to zero. */
+EXTERNL int
+nc_reset_io_stats(int ncid);
+
+/* Choose when the record count of a classic file being appended to is written. */
+EXTERNL int
+nc_set_numrecs_sync(int ncid, size_t nrecs, int msecs);
+
+/* Re-read the record count of a classic file another process appends to. */
+EXTERNL int
+nc_refresh_numrecs(int ncid, size_t *numrecsp);
+
+/** Formats of nc_dump_dispatch_trace(). */
+#define NC_TRACE_JSON   0 /**< Per function counts and latency histograms, as JSON. */
+#define NC_TRACE_CHROME 1 /**< The most recent calls, in Chrome trace event format. */
+
+/* Switch dispatch tracing on or off, for the files opened or created while it is on. */
+EXTERNL int
+nc_set_dispatch_trace(int on);
+
+/* Tell whether dispatch tracing is on. */
+EXTERNL int
+nc_get_dispatch_trace(int *onp);
+
+/* Clear the counters and the recorded calls of dispatch tracing. */
+EXTERNL int
+nc_reset_dispatch_trace(void);
+
+/* Write the dispatch trace to a file, or to stdout if path is NULL. */
+EXTERNL int
+nc_dump_dispatch_trace(const char *path, int format);
+
 /* Begin _dim */
 
 EXTERNL int
@@ -24,6 +24,8 @@ typedef struct NC_memio {
     void* memory;
     int flags;
 #define NC_MEMIO_LOCKED 1    /* Do not try to realloc or free provided memory */
+#define NC_MEMIO_COPYONWRITE 2 /* Never change the provided memory; the pages
+                                  written are copied, so opens share the rest */
 } NC_memio;
 
 #if defined(__cplusplus)
@@ -116,7 +116,7 @@ nc_rename_att(int ncid, int varid, const char *name, const char *newname)
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
    TRACE(nc_rename_att);
-   return ncp->dispatch->rename_att(ncid, varid, name, newname);
+   return NC_LOCKED(ncp,ncp->dispatch->rename_att(ncid, varid, name, newname));
 }
 
 /**
@@ -180,7 +180,7 @@ nc_del_att(int ncid, int varid, const char *name)
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
    TRACE(nc_del_att);
-   stat = ncp->dispatch->del_att(ncid, varid, name);
+   stat = NC_LOCKED(ncp,ncp->dispatch->del_att(ncid, varid, name));
    return stat;
 }
 /**@}*/  /* End doxygen member group. */
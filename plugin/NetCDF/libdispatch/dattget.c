@@ -144,7 +144,7 @@ nc_get_att(int ncid, int varid, const char *name, void *value)
       return stat;
 
    TRACE(nc_get_att);
-   return ncp->dispatch->get_att(ncid, varid, name, value, xtype);
+   return NC_LOCKED(ncp,ncp->dispatch->get_att(ncid, varid, name, value, xtype));
 }
 
 /**
@@ -225,7 +225,7 @@ nc_get_att_text(int ncid, int varid, const char *name, char *value)
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
    TRACE(nc_get_att_text);
-   return ncp->dispatch->get_att(ncid, varid, name, (void *)value, NC_CHAR);
+   return NC_LOCKED(ncp,ncp->dispatch->get_att(ncid, varid, name, (void *)value, NC_CHAR));
 }
 
 /**
@@ -258,7 +258,7 @@ nc_get_att_schar(int ncid, int varid, const char *name, signed char *value)
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
    TRACE(nc_get_att_schar);
-   return ncp->dispatch->get_att(ncid, varid, name, (void *)value, NC_BYTE);
+   return NC_LOCKED(ncp,ncp->dispatch->get_att(ncid, varid, name, (void *)value, NC_BYTE));
 }
 
 /**
@@ -291,7 +291,7 @@ nc_get_att_uchar(int ncid, int varid, const char *name, unsigned char *value)
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
    TRACE(nc_get_att_uchar);
-   return ncp->dispatch->get_att(ncid, varid, name, (void *)value, NC_UBYTE);
+   return NC_LOCKED(ncp,ncp->dispatch->get_att(ncid, varid, name, (void *)value, NC_UBYTE));
 }
 
 /**
@@ -324,7 +324,7 @@ nc_get_att_short(int ncid, int varid, const char *name, short *value)
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
    TRACE(nc_get_att_short);
-   return ncp->dispatch->get_att(ncid, varid, name, (void *)value, NC_SHORT);
+   return NC_LOCKED(ncp,ncp->dispatch->get_att(ncid, varid, name, (void *)value, NC_SHORT));
 }
 
 /**
@@ -357,7 +357,7 @@ nc_get_att_int(int ncid, int varid, const char *name, int *value)
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
    TRACE(nc_get_att_int);
-   return ncp->dispatch->get_att(ncid, varid, name, (void *)value, NC_INT);
+   return NC_LOCKED(ncp,ncp->dispatch->get_att(ncid, varid, name, (void *)value, NC_INT));
 }
 
 /**
@@ -390,7 +390,7 @@ nc_get_att_long(int ncid, int varid, const char *name, long *value)
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
    TRACE(nc_get_att_long);
-   return ncp->dispatch->get_att(ncid, varid, name, (void *)value, longtype);
+   return NC_LOCKED(ncp,ncp->dispatch->get_att(ncid, varid, name, (void *)value, longtype));
 }
 
 /**
@@ -423,7 +423,7 @@ nc_get_att_float(int ncid, int varid, const char *name, float *value)
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
    TRACE(nc_get_att_float);
-   return ncp->dispatch->get_att(ncid, varid, name, (void *)value, NC_FLOAT);
+   return NC_LOCKED(ncp,ncp->dispatch->get_att(ncid, varid, name, (void *)value, NC_FLOAT));
 }
 
 /**
@@ -456,7 +456,7 @@ nc_get_att_double(int ncid, int varid, const char *name, double *value)
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
    TRACE(nc_get_att_double);
-   return ncp->dispatch->get_att(ncid, varid, name, (void *)value, NC_DOUBLE);
+   return NC_LOCKED(ncp,ncp->dispatch->get_att(ncid, varid, name, (void *)value, NC_DOUBLE));
 }
 
 /**
@@ -489,7 +489,7 @@ nc_get_att_ubyte(int ncid, int varid, const char *name, unsigned char *value)
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
    TRACE(nc_get_att_ubyte);
-   return ncp->dispatch->get_att(ncid, varid, name, (void *)value, NC_UBYTE);
+   return NC_LOCKED(ncp,ncp->dispatch->get_att(ncid, varid, name, (void *)value, NC_UBYTE));
 }
 
 /**
@@ -522,7 +522,7 @@ nc_get_att_ushort(int ncid, int varid, const char *name, unsigned short *value)
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
    TRACE(nc_get_att_ushort);
-   return ncp->dispatch->get_att(ncid, varid, name, (void *)value, NC_USHORT);
+   return NC_LOCKED(ncp,ncp->dispatch->get_att(ncid, varid, name, (void *)value, NC_USHORT));
 }
 
 /**
@@ -555,7 +555,7 @@ nc_get_att_uint(int ncid, int varid, const char *name, unsigned int *value)
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
    TRACE(nc_get_att_uint);
-   return ncp->dispatch->get_att(ncid, varid, name, (void *)value, NC_UINT);
+   return NC_LOCKED(ncp,ncp->dispatch->get_att(ncid, varid, name, (void *)value, NC_UINT));
 }
 
 /**
@@ -588,7 +588,7 @@ nc_get_att_longlong(int ncid, int varid, const char *name, long long *value)
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
    TRACE(nc_get_att_longlong);
-   return ncp->dispatch->get_att(ncid, varid, name, (void *)value, NC_INT64);
+   return NC_LOCKED(ncp,ncp->dispatch->get_att(ncid, varid, name, (void *)value, NC_INT64));
 }
 
 /**
@@ -621,7 +621,7 @@ nc_get_att_ulonglong(int ncid, int varid, const char *name, unsigned long long *
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
    TRACE(nc_get_att_ulonglong);
-   return ncp->dispatch->get_att(ncid, varid, name, (void *)value, NC_UINT64);
+   return NC_LOCKED(ncp,ncp->dispatch->get_att(ncid, varid, name, (void *)value, NC_UINT64));
 }
 
 /**
@@ -714,6 +714,6 @@ nc_get_att_string(int ncid, int varid, const char *name, char **value)
     int stat = NC_check_id(ncid, &ncp);
     if(stat != NC_NOERR) return stat;
     TRACE(nc_get_att_string);
-    return ncp->dispatch->get_att(ncid,varid,name,(void*)value, NC_STRING);
+    return NC_LOCKED(ncp,ncp->dispatch->get_att(ncid,varid,name,(void*)value, NC_STRING));
 }
 /**@}*/  /* End doxygen member group. */
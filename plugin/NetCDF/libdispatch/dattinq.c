@@ -89,7 +89,7 @@ nc_inq_att(int ncid, int varid, const char *name, nc_type *xtypep,
    NC* ncp;
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->inq_att(ncid, varid, name, xtypep, lenp);
+   return NC_LOCKED(ncp,ncp->dispatch->inq_att(ncid, varid, name, xtypep, lenp));
 }
 
 /**
@@ -166,7 +166,7 @@ nc_inq_attid(int ncid, int varid, const char *name, int *idp)
    NC* ncp;
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->inq_attid(ncid, varid, name, idp);
+   return NC_LOCKED(ncp,ncp->dispatch->inq_attid(ncid, varid, name, idp));
 }
 
 /**
@@ -257,7 +257,7 @@ nc_inq_attname(int ncid, int varid, int attnum, char *name)
    NC* ncp;
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->inq_attname(ncid, varid, attnum, name);
+   return NC_LOCKED(ncp,ncp->dispatch->inq_attname(ncid, varid, attnum, name));
 }
 
 /**
@@ -303,7 +303,7 @@ nc_inq_natts(int ncid, int *nattsp)
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
    if(nattsp == NULL) return NC_NOERR;
-   return ncp->dispatch->inq(ncid, NULL, NULL, nattsp, NULL);
+   return NC_LOCKED(ncp,ncp->dispatch->inq(ncid, NULL, NULL, nattsp, NULL));
 }
 
 /**
@@ -360,7 +360,7 @@ nc_inq_atttype(int ncid, int varid, const char *name, nc_type *xtypep)
    NC* ncp;
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->inq_att(ncid, varid, name, xtypep, NULL);
+   return NC_LOCKED(ncp,ncp->dispatch->inq_att(ncid, varid, name, xtypep, NULL));
 }
 
 /**
@@ -426,7 +426,7 @@ nc_inq_attlen(int ncid, int varid, const char *name, size_t *lenp)
    NC* ncp;
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->inq_att(ncid, varid, name, NULL, lenp);
+   return NC_LOCKED(ncp,ncp->dispatch->inq_att(ncid, varid, name, NULL, lenp));
 }
 
 /*! \} */  /* End of named group ...*/
@@ -78,8 +78,8 @@ nc_put_att_string(int ncid, int varid, const char *name,
     NC* ncp;
     int stat = NC_check_id(ncid, &ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->put_att(ncid, varid, name, NC_STRING,
-				  len, (void*)value, NC_STRING);
+    return NC_LOCKED(ncp,ncp->dispatch->put_att(ncid, varid, name, NC_STRING,
+				  len, (void*)value, NC_STRING));
 }
 
 /**
@@ -156,8 +156,8 @@ int nc_put_att_text(int ncid, int varid, const char *name,
    NC* ncp;
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->put_att(ncid, varid, name, NC_CHAR, len,
-				 (void *)value, NC_CHAR);
+   return NC_LOCKED(ncp,ncp->dispatch->put_att(ncid, varid, name, NC_CHAR, len,
+				 (void *)value, NC_CHAR));
 }
 
 /**
@@ -225,8 +225,8 @@ nc_put_att(int ncid, int varid, const char *name, nc_type xtype,
    NC* ncp;
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->put_att(ncid, varid, name, xtype, len,
-				 value, xtype);
+   return NC_LOCKED(ncp,ncp->dispatch->put_att(ncid, varid, name, xtype, len,
+				 value, xtype));
 }
 
 /**
@@ -259,8 +259,8 @@ nc_put_att_schar(int ncid, int varid, const char *name,
    NC *ncp;
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->put_att(ncid, varid, name, xtype, len,
-				 (void *)value, NC_BYTE);
+   return NC_LOCKED(ncp,ncp->dispatch->put_att(ncid, varid, name, xtype, len,
+				 (void *)value, NC_BYTE));
 }
 
 /**
@@ -293,8 +293,8 @@ nc_put_att_uchar(int ncid, int varid, const char *name,
    NC* ncp;
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->put_att(ncid, varid, name, xtype, len,
-				 (void *)value, NC_UBYTE);
+   return NC_LOCKED(ncp,ncp->dispatch->put_att(ncid, varid, name, xtype, len,
+				 (void *)value, NC_UBYTE));
 }
 
 /**
@@ -327,8 +327,8 @@ nc_put_att_short(int ncid, int varid, const char *name,
    NC* ncp;
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->put_att(ncid, varid, name, xtype, len,
-				 (void *)value, NC_SHORT);
+   return NC_LOCKED(ncp,ncp->dispatch->put_att(ncid, varid, name, xtype, len,
+				 (void *)value, NC_SHORT));
 }
 
 /**
@@ -361,8 +361,8 @@ nc_put_att_int(int ncid, int varid, const char *name,
    NC* ncp;
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->put_att(ncid, varid, name, xtype, len,
-				 (void *)value, NC_INT);
+   return NC_LOCKED(ncp,ncp->dispatch->put_att(ncid, varid, name, xtype, len,
+				 (void *)value, NC_INT));
 }
 
 /**
@@ -395,8 +395,8 @@ nc_put_att_long(int ncid, int varid, const char *name,
    NC* ncp;
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->put_att(ncid, varid, name, xtype, len,
-				 (void *)value, longtype);
+   return NC_LOCKED(ncp,ncp->dispatch->put_att(ncid, varid, name, xtype, len,
+				 (void *)value, longtype));
 }
 
 /**
@@ -429,8 +429,8 @@ nc_put_att_float(int ncid, int varid, const char *name,
    NC* ncp;
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->put_att(ncid, varid, name, xtype, len,
-				 (void *)value, NC_FLOAT);
+   return NC_LOCKED(ncp,ncp->dispatch->put_att(ncid, varid, name, xtype, len,
+				 (void *)value, NC_FLOAT));
 }
 
 /**
@@ -463,8 +463,8 @@ nc_put_att_double(int ncid, int varid, const char *name,
    NC* ncp;
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->put_att(ncid, varid, name, xtype, len,
-				 (void *)value, NC_DOUBLE);
+   return NC_LOCKED(ncp,ncp->dispatch->put_att(ncid, varid, name, xtype, len,
+				 (void *)value, NC_DOUBLE));
 }
 
 /**
@@ -497,8 +497,8 @@ nc_put_att_ubyte(int ncid, int varid, const char *name,
    NC* ncp;
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->put_att(ncid, varid, name, xtype, len,
-				 (void *)value, NC_UBYTE);
+   return NC_LOCKED(ncp,ncp->dispatch->put_att(ncid, varid, name, xtype, len,
+				 (void *)value, NC_UBYTE));
 }
 
 /**
@@ -531,8 +531,8 @@ nc_put_att_ushort(int ncid, int varid, const char *name,
    NC* ncp;
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->put_att(ncid, varid, name, xtype, len,
-				 (void *)value, NC_USHORT);
+   return NC_LOCKED(ncp,ncp->dispatch->put_att(ncid, varid, name, xtype, len,
+				 (void *)value, NC_USHORT));
 }
 
 /**
@@ -565,8 +565,8 @@ nc_put_att_uint(int ncid, int varid, const char *name,
    NC* ncp;
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->put_att(ncid, varid, name, xtype, len,
-				 (void *)value, NC_UINT);
+   return NC_LOCKED(ncp,ncp->dispatch->put_att(ncid, varid, name, xtype, len,
+				 (void *)value, NC_UINT));
 }
 
 /**
@@ -600,8 +600,8 @@ nc_put_att_longlong(int ncid, int varid, const char *name,
    NC* ncp;
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->put_att(ncid, varid, name, xtype, len,
-				 (void *)value, NC_INT64);
+   return NC_LOCKED(ncp,ncp->dispatch->put_att(ncid, varid, name, xtype, len,
+				 (void *)value, NC_INT64));
 }
 
 /**
@@ -635,8 +635,8 @@ nc_put_att_ulonglong(int ncid, int varid, const char *name,
    NC* ncp;
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->put_att(ncid, varid, name, xtype, len,
-				 (void *)value, NC_UINT64);
+   return NC_LOCKED(ncp,ncp->dispatch->put_att(ncid, varid, name, xtype, len,
+				 (void *)value, NC_UINT64));
 }
 
 /**@}*/  /* End doxygen member group. */
@@ -27,6 +27,7 @@ See COPYRIGHT for license information.
 #endif
 
 #include "ncrc.h"
+#include "nclock.h"
 
 #undef DEBUG
 
@@ -111,6 +112,8 @@ NC_authsetup(NCauth** authp, NCURI* uri)
        to getinfo e.g. host+port  from url
     */
 
+    /* The .rc values are used under the global lock, see NC_rclookup() */
+    NCLOCKGLOBAL();
     setauthfield(auth,"HTTP.VERBOSE",
 			NC_rclookup("HTTP.VERBOSE",uri_hostport,uri->path));
     setauthfield(auth,"HTTP.TIMEOUT",
@@ -168,10 +171,12 @@ NC_authsetup(NCauth** authp, NCURI* uri)
       } else {
 	    /* Could not get user and pwd, so try USERPASSWORD */
 	    const char* userpwd = NC_rclookup("HTTP.CREDENTIALS.USERPASSWORD",uri_hostport,uri->path);
+	    user = pwd = NULL; /* one alone is not ours to free */
 	    if(userpwd != NULL) {
-      	        if((ret = NC_parsecredentials(userpwd,&user,&pwd))) goto done;
+      	        if((ret = NC_parsecredentials(userpwd,&user,&pwd))) {NCUNLOCKGLOBAL(); goto done;}
 	    }
       }
+      NCUNLOCKGLOBAL();
       setauthfield(auth,"HTTP.CREDENTIALS.USERNAME",user);
       setauthfield(auth,"HTTP.CREDENTIALS.PASSWORD",pwd);
       nullfree(user);
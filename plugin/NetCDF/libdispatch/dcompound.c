@@ -66,7 +66,7 @@ nc_def_compound(int ncid, size_t size, const char *name,
    NC* ncp;
    int stat = NC_check_id(ncid,&ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->def_compound(ncid,size,name,typeidp);
+   return NC_LOCKED(ncp,ncp->dispatch->def_compound(ncid,size,name,typeidp));
 }
 
 /** \ingroup user_types
@@ -102,8 +102,8 @@ nc_insert_compound(int ncid, nc_type xtype, const char *name,
    NC *ncp;
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->insert_compound(ncid, xtype, name,
-					 offset, field_typeid);
+   return NC_LOCKED(ncp,ncp->dispatch->insert_compound(ncid, xtype, name,
+					 offset, field_typeid));
 }
 
 /** \ingroup user_types
@@ -145,7 +145,7 @@ nc_insert_array_compound(int ncid, nc_type xtype, const char *name,
    NC* ncp;
    int stat = NC_check_id(ncid,&ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->insert_array_compound(ncid,xtype,name,offset,field_typeid,ndims,dim_sizes);
+   return NC_LOCKED(ncp,ncp->dispatch->insert_array_compound(ncid,xtype,name,offset,field_typeid,ndims,dim_sizes));
 }
 
 /**  \ingroup user_types
@@ -292,9 +292,9 @@ nc_inq_compound_field(int ncid, nc_type xtype, int fieldid,
    NC* ncp;
    int stat = NC_check_id(ncid,&ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->inq_compound_field(ncid, xtype, fieldid,
+   return NC_LOCKED(ncp,ncp->dispatch->inq_compound_field(ncid, xtype, fieldid,
 					    name, offsetp, field_typeidp,
-					    ndimsp, dim_sizesp);
+					    ndimsp, dim_sizesp));
 }
 
 /**  \ingroup user_types
@@ -324,9 +324,9 @@ nc_inq_compound_fieldname(int ncid, nc_type xtype, int fieldid,
    NC* ncp;
    int stat = NC_check_id(ncid,&ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->inq_compound_field(ncid, xtype, fieldid,
+   return NC_LOCKED(ncp,ncp->dispatch->inq_compound_field(ncid, xtype, fieldid,
 					    name, NULL, NULL, NULL,
-					    NULL);
+					    NULL));
 }
 
 /**  \ingroup user_types
@@ -356,7 +356,7 @@ nc_inq_compound_fieldoffset(int ncid, nc_type xtype, int fieldid,
    NC* ncp;
    int stat = NC_check_id(ncid,&ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->inq_compound_field(ncid,xtype,fieldid,NULL,offsetp,NULL,NULL,NULL);
+   return NC_LOCKED(ncp,ncp->dispatch->inq_compound_field(ncid,xtype,fieldid,NULL,offsetp,NULL,NULL,NULL));
 }
 
 /**  \ingroup user_types
@@ -386,7 +386,7 @@ nc_inq_compound_fieldtype(int ncid, nc_type xtype, int fieldid,
    NC* ncp;
    int stat = NC_check_id(ncid,&ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->inq_compound_field(ncid,xtype,fieldid,NULL,NULL,field_typeidp,NULL,NULL);
+   return NC_LOCKED(ncp,ncp->dispatch->inq_compound_field(ncid,xtype,fieldid,NULL,NULL,field_typeidp,NULL,NULL));
 }
 
 /**  \ingroup user_types
@@ -416,7 +416,7 @@ nc_inq_compound_fieldndims(int ncid, nc_type xtype, int fieldid,
    NC* ncp;
    int stat = NC_check_id(ncid,&ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->inq_compound_field(ncid,xtype,fieldid,NULL,NULL,NULL,ndimsp,NULL);
+   return NC_LOCKED(ncp,ncp->dispatch->inq_compound_field(ncid,xtype,fieldid,NULL,NULL,NULL,ndimsp,NULL));
 }
 
 /**  \ingroup user_types
@@ -446,9 +446,9 @@ nc_inq_compound_fielddim_sizes(int ncid, nc_type xtype, int fieldid,
    NC *ncp;
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->inq_compound_field(ncid, xtype, fieldid,
+   return NC_LOCKED(ncp,ncp->dispatch->inq_compound_field(ncid, xtype, fieldid,
 					    NULL, NULL, NULL, NULL,
-					    dim_sizesp);
+					    dim_sizesp));
 }
 
 /**  \ingroup user_types
@@ -478,6 +478,6 @@ nc_inq_compound_fieldindex(int ncid, nc_type xtype, const char *name,
    NC* ncp;
    int stat = NC_check_id(ncid,&ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->inq_compound_fieldindex(ncid,xtype,name,fieldidp);
+   return NC_LOCKED(ncp,ncp->dispatch->inq_compound_fieldindex(ncid,xtype,name,fieldidp));
 }
 /*! \} */  /* End of named group ...*/
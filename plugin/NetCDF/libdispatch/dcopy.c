@@ -11,9 +11,17 @@
 #include "ncdispatch.h"
 #include "nc_logging.h"
 #include "nclist.h"
+#include "netcdf_filter.h"
+
+#ifdef USE_HDF5
+#include "hdf5internal.h"
+#endif
 
 static int NC_find_equal_type(int ncid1, nc_type xtype1, int ncid2, nc_type *xtype2);
 
+/** Bytes of data moved per read/write pair by nc_copy_var(). */
+#define COPY_BLOCK_SIZE (32*1024*1024)
+
 #ifdef USE_NETCDF4
 
 static int searchgroup(int ncid1, int tid1, int grp, int* tid2);
@@ -250,6 +258,144 @@ NC_find_equal_type(int ncid1, nc_type xtype1, int ncid2, nc_type *xtype2)
    return ret;
 }
 
+#ifdef USE_HDF5
+/**
+ * @internal Find out if a variable has an unlimited dimension,
+ * looking for it in the group of the variable and its parents.
+ *
+ * @param ncid File or group ID.
+ * @param varid Variable ID.
+ * @param ndims Number of dimensions of the variable.
+ * @param unlimp Pointer that gets 1 if a dimension is unlimited, 0
+ * otherwise.
+ *
+ * @return ::NC_NOERR No error.
+*/
+static int
+var_has_unlimdim(int ncid, int varid, int ndims, int *unlimp)
+{
+   int dimids[NC_MAX_VAR_DIMS];
+   int *unlimids = NULL;
+   int grpid = ncid, nunlim, i, d;
+   int retval;
+
+   *unlimp = 0;
+   if ((retval = nc_inq_vardimid(ncid, varid, dimids)))
+      return retval;
+   for (;;)
+   {
+      if ((retval = nc_inq_unlimdims(grpid, &nunlim, NULL)))
+         return retval;
+      if (nunlim > 0)
+      {
+         if (!(unlimids = malloc((size_t)nunlim * sizeof(int))))
+            return NC_ENOMEM;
+         if ((retval = nc_inq_unlimdims(grpid, &nunlim, unlimids)))
+            break;
+         for (i = 0; i < nunlim && !*unlimp; i++)
+            for (d = 0; d < ndims; d++)
+               if (dimids[d] == unlimids[i])
+                  *unlimp = 1;
+         free(unlimids);
+         unlimids = NULL;
+         if (*unlimp)
+            break;
+      }
+      if ((retval = nc_inq_grp_parent(grpid, &grpid)))
+      {
+         if (retval == NC_ENOGRP)
+            retval = NC_NOERR;
+         break;
+      }
+   }
+   if (unlimids) free(unlimids);
+   return retval;
+}
+
+/**
+ * @internal Give a new netCDF-4 variable the chunking, filters and
+ * endianness of the netCDF-4 variable it is copied from, so that the
+ * copy keeps its layout and its chunks can be copied as they are
+ * stored. Filters that are not available in this build are skipped.
+ *
+ * @param ncid_in File ID to copy from.
+ * @param varid_in Variable ID to copy from.
+ * @param ncid_out File ID to copy to.
+ * @param varid_out Variable ID to copy to, still in define mode.
+ * @param ndims Number of dimensions of the variable.
+ *
+ * @return ::NC_NOERR No error.
+*/
+static int
+copy_var_storage(int ncid_in, int varid_in, int ncid_out, int varid_out, int ndims)
+{
+   size_t chunksizes[NC_MAX_VAR_DIMS];
+   unsigned int *filterids = NULL, *params = NULL;
+   size_t nfilters = 0, nparams, f;
+   int storage, endian;
+   int retval = NC_NOERR;
+
+   if ((retval = nc_inq_var_endian(ncid_in, varid_in, &endian)))
+      return retval;
+   if (endian != NC_ENDIAN_NATIVE &&
+       (retval = nc_def_var_endian(ncid_out, varid_out, endian)))
+      return retval;
+   if (ndims == 0)
+      return NC_NOERR;
+
+   if ((retval = nc_inq_var_chunking(ncid_in, varid_in, &storage, chunksizes)))
+      return retval;
+   if (storage != NC_CHUNKED)
+   {
+      int unlim;
+
+      /* An unlimited dimension must be chunked, so the output
+       * variable keeps the default chunking then. */
+      if ((retval = var_has_unlimdim(ncid_out, varid_out, ndims, &unlim)))
+         return retval;
+      if (!unlim)
+         retval = nc_def_var_chunking(ncid_out, varid_out, storage, NULL);
+      return retval;
+   }
+   if ((retval = nc_def_var_chunking(ncid_out, varid_out, storage, chunksizes)))
+      return retval;
+
+   /* Filters are applied in the order they were defined. */
+   if ((retval = nc_inq_var_filter_ids(ncid_in, varid_in, &nfilters, NULL)))
+      return retval;
+   if (nfilters == 0)
+      return NC_NOERR;
+   if (!(filterids = malloc(nfilters * sizeof(unsigned int))))
+      return NC_ENOMEM;
+   if ((retval = nc_inq_var_filter_ids(ncid_in, varid_in, &nfilters, filterids)))
+      goto done;
+   for (f = 0; f < nfilters; f++)
+   {
+      if ((retval = nc_inq_var_filter_info(ncid_in, varid_in, filterids[f], &nparams, NULL)))
+         goto done;
+      if (!(params = malloc((nparams ? nparams : 1) * sizeof(unsigned int))))
+      {
+         retval = NC_ENOMEM;
+         goto done;
+      }
+      if ((retval = nc_inq_var_filter_info(ncid_in, varid_in, filterids[f], &nparams, params)))
+         goto done;
+      retval = nc_def_var_filter(ncid_out, varid_out, filterids[f], nparams, params);
+      if (retval == NC_ENOFILTER || retval == NC_EFILTER)
+         retval = NC_NOERR;
+      if (retval)
+         goto done;
+      free(params);
+      params = NULL;
+   }
+
+done:
+   if (params) free(params);
+   if (filterids) free(filterids);
+   return retval;
+}
+#endif /*USE_HDF5*/
+
 /**
  * This will copy a variable that is an array of primitive type and
  * its attributes from one file to another, assuming dimensions in the
@@ -271,6 +417,13 @@ NC_find_equal_type(int ncid1, nc_type xtype1, int ncid2, nc_type *xtype2)
  * is not a problem for netCDF-4 files, which support efficient
  * addition of variables without moving data for other variables.
  *
+ * When both files are netCDF-4 files, the new variable gets the
+ * chunking, filters and endianness of the original, and if the
+ * stored chunks of the two variables are interchangeable they are
+ * copied as they are, without being decompressed and compressed
+ * again. Otherwise the data is copied in blocks of whole records
+ * aligned to the chunks of the output variable.
+ *
  * @param ncid_in File ID to copy from.
  * @param varid_in Variable ID to copy.
  * @param ncid_out File ID to copy to.
@@ -299,6 +452,9 @@ nc_copy_var(int ncid_in, int varid_in, int ncid_out)
    char type_name[NC_MAX_NAME+1];
    char dimname_in[NC_MAX_NAME + 1];
    size_t i;
+   size_t blockrecs = 1, chunk0 = 0;
+   int model_in, model_out;
+   int chunksdone = 0;
 
    /* Learn about this var. */
    if ((retval = nc_inq_var(ncid_in, varid_in, name, &xtype,
@@ -322,6 +478,10 @@ nc_copy_var(int ncid_in, int varid_in, int ncid_out)
       return retval;
    if ((retval = nc_inq_format(ncid_out, &dest_format)))
       return retval;
+   if ((retval = nc_inq_format_extended(ncid_in, &model_in, NULL)))
+      return retval;
+   if ((retval = nc_inq_format_extended(ncid_out, &model_out, NULL)))
+      return retval;
    if ((dest_format == NC_FORMAT_CLASSIC
         || dest_format == NC_FORMAT_64BIT_DATA
         || dest_format == NC_FORMAT_64BIT_OFFSET) &&
@@ -340,6 +500,11 @@ nc_copy_var(int ncid_in, int varid_in, int ncid_out)
    if ((retval = nc_def_var(ncid_out, name, xtype,
                             ndims, dimids_out, &varid_out)))
       BAIL(retval);
+#ifdef USE_HDF5
+   if (model_in == NC_FORMATX_NC_HDF5 && model_out == NC_FORMATX_NC_HDF5)
+      if ((retval = copy_var_storage(ncid_in, varid_in, ncid_out, varid_out, ndims)))
+         BAIL(retval);
+#endif
 
    /* Copy the attributes. */
    for (a=0; a<natts; a++)
@@ -355,6 +520,21 @@ nc_copy_var(int ncid_in, int varid_in, int ncid_out)
    nc_enddef(ncid_out);
    nc_sync(ncid_out);
 
+#ifdef USE_HDF5
+   /* Move the stored chunks as they are, if the layouts allow it. */
+   if (model_in == NC_FORMATX_NC_HDF5 && model_out == NC_FORMATX_NC_HDF5)
+   {
+      NC* ncp;
+      if ((retval = NC_check_id(ncid_out, &ncp)))
+         BAIL(retval);
+      if ((retval = NC_LOCKED(ncp, NC4_hdf5_copy_chunks(ncid_in, varid_in, ncid_out,
+                                                       varid_out, &chunksdone))))
+         BAIL(retval);
+      if (chunksdone)
+         goto exit;
+   }
+#endif
+
    /* Allocate memory for our start and count arrays. If ndims = 0
       this is a scalar, which I will treat as a 1-D array with one
       element. */
@@ -366,9 +546,8 @@ nc_copy_var(int ncid_in, int varid_in, int ncid_out)
 
    /* The start array will be all zeros, except the first element,
       which will be the record number. Count will be the dimension
-      size, except for the first element, which will be one, because
-      we will copy one record at a time. For this we need the var
-      shape. */
+      size, except for the first element, which will be the number of
+      records copied at a time. For this we need the var shape. */
    if (!(dimlen = malloc((size_t)real_ndims * sizeof(size_t))))
       BAIL(NC_ENOMEM);
 
@@ -399,17 +578,44 @@ nc_copy_var(int ncid_in, int varid_in, int ncid_out)
    if (!dimlen[0])
       goto exit;
 
-   /* Allocate memory for one record. */
-   if (!(data = malloc(reclen * type_size))) {
+   /* Copy as many records at a time as fit in COPY_BLOCK_SIZE,
+      rounded down to whole chunks along the first dimension, so
+      that each chunk of a compressed variable is written once. */
+   if (ndims > 0)
+   {
+      int storage;
+      size_t chunksizes[NC_MAX_VAR_DIMS];
+      if ((model_out == NC_FORMATX_NC_HDF5
+           && !nc_inq_var_chunking(ncid_out, varid_out, &storage, chunksizes)
+           && storage == NC_CHUNKED)
+          || (model_in == NC_FORMATX_NC_HDF5
+              && !nc_inq_var_chunking(ncid_in, varid_in, &storage, chunksizes)
+              && storage == NC_CHUNKED))
+         chunk0 = chunksizes[0];
+   }
+   if (reclen * type_size > 0)
+      blockrecs = COPY_BLOCK_SIZE / (reclen * type_size);
+   if (chunk0 > 1 && blockrecs > chunk0)
+      blockrecs -= blockrecs % chunk0;
+   if (blockrecs < 1)
+      blockrecs = 1;
+   if (blockrecs > dimlen[0])
+      blockrecs = dimlen[0];
+
+   /* Allocate memory for one block. */
+   if (!(data = malloc(blockrecs * reclen * type_size))) {
      if(count) free(count);
      if(dimlen) free(dimlen);
      if(start) free(start);
      return NC_ENOMEM;
    }
 
-   /* Copy the var data one record at a time. */
-   for (start[0]=0; !retval && start[0]<(size_t)dimlen[0]; start[0]++)
+   /* Copy the var data one block at a time. */
+   for (start[0]=0; !retval && start[0]<(size_t)dimlen[0]; start[0]+=count[0])
    {
+      count[0] = dimlen[0] - start[0];
+      if (count[0] > blockrecs)
+         count[0] = blockrecs;
       switch (xtype)
       {
 	 case NC_BYTE:
@@ -124,7 +124,7 @@ nc_def_dim(int ncid, const char *name, size_t len, int *idp)
     int stat = NC_check_id(ncid, &ncp);
     if(stat != NC_NOERR) return stat;
     TRACE(nc_def_dim);
-    return ncp->dispatch->def_dim(ncid, name, len, idp);
+    return NC_LOCKED(ncp,ncp->dispatch->def_dim(ncid, name, len, idp));
 }
 
 /**
@@ -155,7 +155,7 @@ nc_inq_dimid(int ncid, const char *name, int *idp)
     int stat = NC_check_id(ncid, &ncp);
     if(stat != NC_NOERR) return stat;
     TRACE(nc_inq_dimid);
-    return ncp->dispatch->inq_dimid(ncid,name,idp);
+    return NC_LOCKED(ncp,ncp->dispatch->inq_dimid(ncid,name,idp));
 }
 
 /**
@@ -219,7 +219,7 @@ nc_inq_dim(int ncid, int dimid, char *name, size_t *lenp)
     int stat = NC_check_id(ncid, &ncp);
     if(stat != NC_NOERR) return stat;
     TRACE(nc_inq_dim);
-    return ncp->dispatch->inq_dim(ncid,dimid,name,lenp);
+    return NC_LOCKED(ncp,ncp->dispatch->inq_dim(ncid,dimid,name,lenp));
 }
 
 /**
@@ -288,7 +288,7 @@ nc_rename_dim(int ncid, int dimid, const char *name)
     int stat = NC_check_id(ncid, &ncp);
     if(stat != NC_NOERR) return stat;
     TRACE(nc_rename_dim);
-    return ncp->dispatch->rename_dim(ncid,dimid,name);
+    return NC_LOCKED(ncp,ncp->dispatch->rename_dim(ncid,dimid,name));
 }
 
 /**
@@ -321,7 +321,7 @@ nc_inq_ndims(int ncid, int *ndimsp)
     if(stat != NC_NOERR) return stat;
     if(ndimsp == NULL) return NC_NOERR;
     TRACE(nc_inq_ndims);
-    return ncp->dispatch->inq(ncid,ndimsp,NULL,NULL,NULL);
+    return NC_LOCKED(ncp,ncp->dispatch->inq(ncid,ndimsp,NULL,NULL,NULL));
 }
 
 /**
@@ -353,7 +353,7 @@ nc_inq_unlimdim(int ncid, int *unlimdimidp)
     int stat = NC_check_id(ncid, &ncp);
     if(stat != NC_NOERR) return stat;
     TRACE(nc_inq_unlimdim);
-    return ncp->dispatch->inq_unlimdim(ncid,unlimdimidp);
+    return NC_LOCKED(ncp,ncp->dispatch->inq_unlimdim(ncid,unlimdimidp));
 }
 
 /**
@@ -413,7 +413,7 @@ nc_inq_dimname(int ncid, int dimid, char *name)
     if(stat != NC_NOERR) return stat;
     if(name == NULL) return NC_NOERR;
     TRACE(nc_inq_dimname);
-    return ncp->dispatch->inq_dim(ncid,dimid,name,NULL);
+    return NC_LOCKED(ncp,ncp->dispatch->inq_dim(ncid,dimid,name,NULL));
 }
 
 /**
@@ -471,7 +471,7 @@ nc_inq_dimlen(int ncid, int dimid, size_t *lenp)
     if(stat != NC_NOERR) return stat;
     if(lenp == NULL) return NC_NOERR;
     TRACE(nc_inq_dimlen);
-    return ncp->dispatch->inq_dim(ncid,dimid,NULL,lenp);
+    return NC_LOCKED(ncp,ncp->dispatch->inq_dim(ncid,dimid,NULL,lenp));
 }
 
 /** @} */
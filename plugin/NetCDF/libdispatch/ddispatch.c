@@ -13,6 +13,7 @@ See LICENSE.txt for license information.
 #include "ncpathmgr.h"
 #include "ncxml.h"
 #include "nc4internal.h"
+#include "nctrace.h"
 
 /* Required for getcwd, other functions. */
 #ifdef HAVE_UNISTD_H
@@ -110,12 +111,14 @@ NCDISPATCH_initialize(void)
 
     ncloginit();
 
-    /* Now load RC Files */
-    ncrc_initialize();
+    /* The rc files are loaded on first lookup (drc.c) */
 
     /* Compute type alignments */
     NC_compute_alignments();
 
+    /* Switch on dispatch tracing if NCDISPATCHTRACE is set */
+    if((status = NC_trace_initialize())) return status;
+
 #if defined(NETCDF_ENABLE_BYTERANGE) || defined(NETCDF_ENABLE_DAP) || defined(NETCDF_ENABLE_DAP4)
     /* Initialize curl if it is being used */
     {
@@ -128,6 +131,32 @@ NCDISPATCH_initialize(void)
     return status;
 }
 
+#define NC_ONCE_RUNNING 1
+#define NC_ONCE_DONE 2
+
+int
+NC_once(int* oncep, int (*init)(void))
+{
+    int stat = NC_NOERR;
+#ifdef _MSC_VER
+    if(_InterlockedOr((volatile long*)oncep,0) == NC_ONCE_DONE) return NC_NOERR;
+#else
+    if(__atomic_load_n(oncep,__ATOMIC_ACQUIRE) == NC_ONCE_DONE) return NC_NOERR;
+#endif
+    NCLOCKLIBRARY();
+    if(*oncep == NC_ONCE_INIT) {
+        *oncep = NC_ONCE_RUNNING; /* init() may call back here */
+        stat = init();
+#ifdef _MSC_VER
+        _InterlockedExchange((volatile long*)oncep,(stat ? NC_ONCE_INIT : NC_ONCE_DONE));
+#else
+        __atomic_store_n(oncep,(stat ? NC_ONCE_INIT : NC_ONCE_DONE),__ATOMIC_RELEASE);
+#endif
+    }
+    NCUNLOCKLIBRARY();
+    return stat;
+}
+
 int
 NCDISPATCH_finalize(void)
 {
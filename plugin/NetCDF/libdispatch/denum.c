@@ -45,7 +45,7 @@ nc_def_enum(int ncid, nc_type base_typeid, const char *name, nc_type *typeidp)
     NC* ncp;
     int stat = NC_check_id(ncid,&ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->def_enum(ncid,base_typeid,name,typeidp);
+    return NC_LOCKED(ncp,ncp->dispatch->def_enum(ncid,base_typeid,name,typeidp));
 }
 
 /** \ingroup user_types
@@ -74,8 +74,8 @@ nc_insert_enum(int ncid, nc_type xtype, const char *name,
     NC *ncp;
     int stat = NC_check_id(ncid, &ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->insert_enum(ncid, xtype, name,
-				      value);
+    return NC_LOCKED(ncp,ncp->dispatch->insert_enum(ncid, xtype, name,
+				      value));
 }
 
 /** \ingroup user_types
@@ -143,7 +143,7 @@ nc_inq_enum_member(int ncid, nc_type xtype, int idx, char *name,
     NC *ncp;
     int stat = NC_check_id(ncid, &ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->inq_enum_member(ncid, xtype, idx, name, value);
+    return NC_LOCKED(ncp,ncp->dispatch->inq_enum_member(ncid, xtype, idx, name, value));
 }
 
 /** \ingroup user_types
@@ -167,6 +167,6 @@ nc_inq_enum_ident(int ncid, nc_type xtype, long long value,
     NC* ncp;
     int stat = NC_check_id(ncid,&ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->inq_enum_ident(ncid,xtype,value,identifier);
+    return NC_LOCKED(ncp,ncp->dispatch->inq_enum_ident(ncid,xtype,value,identifier));
 }
 /*! \} */  /* End of named group ...*/
@@ -28,6 +28,9 @@
 #ifdef HAVE_UNISTD_H
 #include <unistd.h> /* lseek() */
 #endif
+#ifdef _WIN32
+#include <io.h> /* close() */
+#endif
 
 #ifdef HAVE_STDIO_H
 #include <stdio.h>
@@ -37,9 +40,21 @@
 #include "netcdf_mem.h"
 #include "ncpathmgr.h"
 #include "fbits.h"
+#include "ncutil.h"
+#include "nctrace.h"
+#include "ncudfplugins.h"
 
 #undef DEBUG
 
+extern int NC3_inq_io_stats(int ncid, NC_io_stats *statsp);
+extern int NC3_reset_io_stats(int ncid);
+extern int NC3_set_numrecs_sync(int ncid, size_t nrecs, int msecs);
+extern int NC3_refresh_numrecs(int ncid, size_t *numrecsp);
+#ifdef USE_HDF5
+extern int NC4_hdf5_inq_io_stats(int ncid, NC_io_stats *statsp);
+extern int NC4_hdf5_reset_io_stats(int ncid);
+#endif
+
 #ifndef nulldup
  #define nulldup(s) ((s)?strdup(s):NULL)
 #endif
@@ -166,6 +181,11 @@ int
 nc_def_user_format(int mode_flag, NC_Dispatch *dispatch_table, char *magic_number)
 {
     int udf_index;
+    int ret;
+
+    /* Plugins from the rc files first, so that the program has the last word */
+    if ((ret = NC_udf_load_plugins()))
+        return ret;
 
     /* Check inputs. */
     if (!dispatch_table)
@@ -220,6 +240,10 @@ int
 nc_inq_user_format(int mode_flag, NC_Dispatch **dispatch_table, char *magic_number)
 {
     int udf_index;
+    int ret;
+
+    if ((ret = NC_udf_load_plugins()))
+        return ret;
 
     /* Get the UDF index from the mode flag. */
     udf_index = udf_mode_to_index(mode_flag);
@@ -999,7 +1023,7 @@ nc_redef(int ncid)
     NC* ncp;
     int stat = NC_check_id(ncid, &ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->redef(ncid);
+    return NC_LOCKED(ncp,ncp->dispatch->redef(ncid));
 }
 
 /** \ingroup datasets
@@ -1064,7 +1088,7 @@ nc_enddef(int ncid)
     NC *ncp;
     status = NC_check_id(ncid, &ncp);
     if(status != NC_NOERR) return status;
-    return ncp->dispatch->_enddef(ncid,0,1,0,1);
+    return NC_LOCKED(ncp,ncp->dispatch->_enddef(ncid,0,1,0,1));
 }
 
 /** \ingroup datasets
@@ -1155,7 +1179,7 @@ nc__enddef(int ncid, size_t h_minfree, size_t v_align, size_t v_minfree,
     NC* ncp;
     int stat = NC_check_id(ncid, &ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->_enddef(ncid,h_minfree,v_align,v_minfree,r_align);
+    return NC_LOCKED(ncp,ncp->dispatch->_enddef(ncid,h_minfree,v_align,v_minfree,r_align));
 }
 
 /** \ingroup datasets
@@ -1231,7 +1255,7 @@ nc_sync(int ncid)
     NC* ncp;
     int stat = NC_check_id(ncid, &ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->sync(ncid);
+    return NC_LOCKED(ncp,ncp->dispatch->sync(ncid));
 }
 
 /** \ingroup datasets
@@ -1284,7 +1308,7 @@ nc_abort(int ncid)
     int stat = NC_check_id(ncid, &ncp);
     if(stat != NC_NOERR) return stat;
 
-    stat = ncp->dispatch->abort(ncid);
+    stat = NC_LOCKED(ncp,ncp->dispatch->abort(ncid));
     del_from_NCList(ncp);
     free_NC(ncp);
     return stat;
@@ -1337,7 +1361,7 @@ nc_close(int ncid)
     int stat = NC_check_id(ncid, &ncp);
     if(stat != NC_NOERR) return stat;
 
-    stat = ncp->dispatch->close(ncid,NULL);
+    stat = NC_LOCKED(ncp,ncp->dispatch->close(ncid,NULL));
     /* Remove from the nc list */
     if (!stat)
     {
@@ -1396,7 +1420,7 @@ nc_close_memio(int ncid, NC_memio* memio)
     int stat = NC_check_id(ncid, &ncp);
     if(stat != NC_NOERR) return stat;
 
-    stat = ncp->dispatch->close(ncid,memio);
+    stat = NC_LOCKED(ncp,ncp->dispatch->close(ncid,memio));
     /* Remove from the nc list */
     if (!stat)
     {
@@ -1510,7 +1534,7 @@ nc_set_fill(int ncid, int fillmode, int *old_modep)
     NC* ncp;
     int stat = NC_check_id(ncid, &ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->set_fill(ncid,fillmode,old_modep);
+    return NC_LOCKED(ncp,ncp->dispatch->set_fill(ncid,fillmode,old_modep));
 }
 
 /**
@@ -1583,7 +1607,7 @@ nc_inq_format(int ncid, int *formatp)
     NC* ncp;
     int stat = NC_check_id(ncid, &ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->inq_format(ncid,formatp);
+    return NC_LOCKED(ncp,ncp->dispatch->inq_format(ncid,formatp));
 }
 
 /** \ingroup datasets
@@ -1618,7 +1642,173 @@ nc_inq_format_extended(int ncid, int *formatp, int *modep)
     NC* ncp;
     int stat = NC_check_id(ncid, &ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->inq_format_extended(ncid,formatp,modep);
+    return NC_LOCKED(ncp,ncp->dispatch->inq_format_extended(ncid,formatp,modep));
+}
+
+/**\ingroup datasets
+   Get the I/O statistics of an open file.
+
+   The counters start at zero when the file is opened or created, or
+   when nc_reset_io_stats() is called. They count the calls made to
+   the operating system (or to HDF5) and the bytes they moved, the
+   buffer cache hits and misses of classic files, the chunks moved
+   whole by NetCDF-4 files, and the time spent converting data
+   between the file and the memory types. For NetCDF-4 files
+   mdc_hit_rate is the hit rate of the HDF5 metadata cache; it is -1
+   when not available.
+
+   Formats that keep no statistics return all counters at zero.
+
+   \param ncid NetCDF ID, from a previous call to nc_open() or
+   nc_create().
+
+   \param statsp Pointer to location for returned statistics.
+
+   \returns ::NC_NOERR No error.
+
+   \returns ::NC_EBADID Invalid ncid passed.
+
+   \returns ::NC_EINVAL statsp is NULL.
+*/
+int
+nc_inq_io_stats(int ncid, NC_io_stats *statsp)
+{
+    NC* ncp;
+    int stat = NC_check_id(ncid, &ncp);
+    if(stat != NC_NOERR) return stat;
+    if(statsp == NULL) return NC_EINVAL;
+    memset(statsp, 0, sizeof(NC_io_stats));
+    statsp->mdc_hit_rate = -1;
+    switch (ncp->dispatch->model) {
+    case NC_FORMATX_NC3:
+        return NC_LOCKED(ncp,NC3_inq_io_stats(ncid,statsp));
+#ifdef USE_HDF5
+    case NC_FORMATX_NC_HDF5:
+        return NC_LOCKED(ncp,NC4_hdf5_inq_io_stats(ncid,statsp));
+#endif
+    default:
+        return NC_NOERR;
+    }
+}
+
+/**\ingroup datasets
+   Set the I/O statistics of an open file to zero.
+
+   \param ncid NetCDF ID, from a previous call to nc_open() or
+   nc_create().
+
+   \returns ::NC_NOERR No error.
+
+   \returns ::NC_EBADID Invalid ncid passed.
+*/
+int
+nc_reset_io_stats(int ncid)
+{
+    NC* ncp;
+    int stat = NC_check_id(ncid, &ncp);
+    if(stat != NC_NOERR) return stat;
+    switch (ncp->dispatch->model) {
+    case NC_FORMATX_NC3:
+        return NC_LOCKED(ncp,NC3_reset_io_stats(ncid));
+#ifdef USE_HDF5
+    case NC_FORMATX_NC_HDF5:
+        return NC_LOCKED(ncp,NC4_hdf5_reset_io_stats(ncid));
+#endif
+    default:
+        return NC_NOERR;
+    }
+}
+
+/**\ingroup datasets
+   Choose when the number of records of a classic file open for
+   writing is written to the file.
+
+   Appending records changes only the count kept in memory, which is
+   written by nc_sync() and nc_close(). Files opened with ::NC_SHARE
+   also write it every time it grows, so that other processes see the
+   new records, at the cost of a header write per record. This
+   function sets instead to write it, when a record is started, if
+   nrecs records were added, or msecs milliseconds passed, since it was
+   last written. The count written leaves out the record being started.
+   The time is checked only when records are added, there is no timer.
+   Zero turns a limit off; with both at zero the count is written only
+   by nc_sync() and nc_close(), or at every change for ::NC_SHARE
+   files. Otherwise, for ::NC_SHARE files this replaces writing it at
+   every change.
+
+   Crash consistency: before the count is written, the records it
+   counts are handed to the operating system. So if the program dies,
+   the file is a valid one holding the records up to the last count
+   written, and these are whole if every record is written whole
+   before the next is started. Later records lie past the count and
+   are ignored. Nothing is forced to the disk (see nc_sync()), so
+   after a system crash the file holds what the system saved. Header
+   changes other than the count are only written by nc_enddef(),
+   nc_sync() and nc_close().
+
+   \param ncid NetCDF ID, from a previous call to nc_open() or
+   nc_create().
+
+   \param nrecs Write the count after this many records are added, or 0.
+
+   \param msecs Write the count this many milliseconds after it was
+   last written, or 0.
+
+   \returns ::NC_NOERR No error.
+
+   \returns ::NC_EBADID Invalid ncid passed.
+
+   \returns ::NC_EPERM The file is read only.
+
+   \returns ::NC_EINVAL msecs is negative.
+
+   \returns ::NC_ENOTNC3 The file is not a classic file.
+*/
+int
+nc_set_numrecs_sync(int ncid, size_t nrecs, int msecs)
+{
+    NC* ncp;
+    int stat = NC_check_id(ncid, &ncp);
+    if(stat != NC_NOERR) return stat;
+    if(msecs < 0) return NC_EINVAL;
+    if(ncp->dispatch->model != NC_FORMATX_NC3) return NC_ENOTNC3;
+    return NC_LOCKED(ncp,NC3_set_numrecs_sync(ncid,nrecs,msecs));
+}
+
+/**\ingroup datasets
+   Re-read the number of records of a classic file opened read only,
+   to follow a file that another process is appending records to.
+
+   Only the record count is read from the file, a few bytes, and the
+   header is not parsed again, so the new records can be read as soon
+   as they are counted without opening the file again. Dimensions,
+   variables and attributes stay as they were read by nc_open(): the
+   writer must only add records. Which records the count covers is up
+   to the writer, see nc_set_numrecs_sync() and ::NC_SHARE.
+
+   Files open for writing hold the newest count in memory, and it is
+   returned without reading the file. Files opened from memory do not
+   change.
+
+   \param ncid NetCDF ID, from a previous call to nc_open().
+
+   \param numrecsp Pointer to location for the number of records.
+   Ignored if NULL.
+
+   \returns ::NC_NOERR No error.
+
+   \returns ::NC_EBADID Invalid ncid passed.
+
+   \returns ::NC_ENOTNC3 The file is not a classic file.
+*/
+int
+nc_refresh_numrecs(int ncid, size_t *numrecsp)
+{
+    NC* ncp;
+    int stat = NC_check_id(ncid, &ncp);
+    if(stat != NC_NOERR) return stat;
+    if(ncp->dispatch->model != NC_FORMATX_NC3) return NC_ENOTNC3;
+    return NC_LOCKED(ncp,NC3_refresh_numrecs(ncid,numrecsp));
 }
 
 /**\ingroup datasets
@@ -1671,7 +1861,7 @@ nc_inq(int ncid, int *ndimsp, int *nvarsp, int *nattsp, int *unlimdimidp)
     NC* ncp;
     int stat = NC_check_id(ncid, &ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->inq(ncid,ndimsp,nvarsp,nattsp,unlimdimidp);
+    return NC_LOCKED(ncp,ncp->dispatch->inq(ncid,ndimsp,nvarsp,nattsp,unlimdimidp));
 }
 
 /**
@@ -1690,7 +1880,7 @@ nc_inq_nvars(int ncid, int *nvarsp)
     NC* ncp;
     int stat = NC_check_id(ncid, &ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->inq(ncid, NULL, nvarsp, NULL, NULL);
+    return NC_LOCKED(ncp,ncp->dispatch->inq(ncid, NULL, nvarsp, NULL, NULL));
 }
 
 /**\ingroup datasets
@@ -1779,7 +1969,7 @@ nc_inq_type(int ncid, nc_type xtype, char *name, size_t *size)
     if(stat != NC_NOERR) /* bad ncid */
         return NC_EBADTYPE;
     /* have good ncid */
-    return ncp->dispatch->inq_type(ncid,xtype,name,size);
+    return NC_LOCKED(ncp,ncp->dispatch->inq_type(ncid,xtype,name,size));
 }
 
 /** \defgroup dispatch dispatch functions. */
@@ -1881,6 +2071,7 @@ NC_create(const char *path0, int cmode, size_t initialsz,
     char* path = NULL;
     NCmodel model;
     char* newpath = NULL;
+    unsigned long long t0 = 0;
 
     TRACE(nc_create);
     if(path0 == NULL)
@@ -1895,6 +2086,7 @@ NC_create(const char *path0, int cmode, size_t initialsz,
     if(!NC_initialized) {
         if ((stat = nc_initialize())) goto done;
     }
+    if((stat = NC_udf_load_plugins())) goto done;
 
     {
         /* Skip past any leading whitespace in path */
@@ -1986,14 +2178,21 @@ NC_create(const char *path0, int cmode, size_t initialsz,
     /* Add to list of known open files and define ext_ncid */
     add_to_NCList(ncp);
 
+    if(NC_trace_on()) t0 = NC_nanotime();
+
     /* Assume create will fill in remaining ncp fields */
-    if ((stat = dispatcher->create(ncp->path, cmode, initialsz, basepe, chunksizehintp,
-                                   parameters, dispatcher, ncp->ext_ncid))) {
+    if ((stat = NC_LOCKED(ncp,dispatcher->create(ncp->path, cmode, initialsz, basepe, chunksizehintp,
+                                   parameters, dispatcher, ncp->ext_ncid)))) {
         del_from_NCList(ncp); /* oh well */
         free_NC(ncp);
+        ncp = NULL;
     } else {
         if(ncidp)*ncidp = ncp->ext_ncid;
     }
+    if(t0 != 0) {
+        if(ncp != NULL) NC_trace_install(ncp);
+        NC_trace_record(NCTRACE_create,(ncp != NULL ? ncp->ext_ncid : -1),t0,0,stat);
+    }
 done:
     nullfree(path);
     nullfree(newpath);
@@ -2030,18 +2229,22 @@ NC_open(const char *path0, int omode, int basepe, size_t *chunksizehintp,
     int stat = NC_NOERR;
     NC* ncp = NULL;
     const NC_Dispatch* dispatcher = NULL;
+    unsigned long long t0 = 0;
     int inmemory = 0;
     int diskless = 0;
     int use_mmap = 0;
     char* path = NULL;
     NCmodel model;
     char* newpath = NULL;
+    int fd = -1;
 
     TRACE(nc_open);
     if(!NC_initialized) {
         stat = nc_initialize();
         if(stat) goto done;
     }
+    /* Plugins configured in the rc files may claim the file */
+    if((stat = NC_udf_load_plugins())) goto done;
 
     /* Check inputs. */
     if (!path0)
@@ -2073,9 +2276,13 @@ NC_open(const char *path0, int omode, int basepe, size_t *chunksizehintp,
     }
 
     memset(&model,0,sizeof(model));
-    /* Infer model implementation and format, possibly by reading the file */
-    if((stat = NC_infermodel(path,&omode,0,useparallel,parameters,&model,&newpath)))
-        goto done;
+    /* Infer model implementation and format, possibly by reading the
+       file; absolute local paths take the quick way */
+    if(NC_infermodel_local(path,&omode,useparallel,&model,&fd) != NC_NOERR) {
+        memset(&model,0,sizeof(model));
+        if((stat = NC_infermodel(path,&omode,0,useparallel,parameters,&model,&newpath)))
+            goto done;
+    }
     if(newpath) {
         nullfree(path);
         path = newpath;
@@ -2255,20 +2462,37 @@ NC_open(const char *path0, int omode, int basepe, size_t *chunksizehintp,
     /* Create the NC* instance and insert its dispatcher */
     if((stat = new_NC(dispatcher,path,omode,&ncp))) goto done;
 
+    /* The classic backend reads the file through the descriptor the
+       magic number came from; the others open the file themselves */
+    if(fd >= 0 && model.impl == NC_FORMATX_NC3 && !diskless && !use_mmap)
+        ncp->fd = fd;
+    else if(fd >= 0)
+        close(fd);
+    fd = -1;
+
     /* Add to list of known open files. This assigns an ext_ncid. */
     add_to_NCList(ncp);
 
+    if(NC_trace_on()) t0 = NC_nanotime();
+
     /* Assume open will fill in remaining ncp fields */
-    stat = dispatcher->open(ncp->path, omode, basepe, chunksizehintp,
-                            parameters, dispatcher, ncp->ext_ncid);
+    stat = NC_LOCKED(ncp,dispatcher->open(ncp->path, omode, basepe, chunksizehintp,
+                            parameters, dispatcher, ncp->ext_ncid));
+    if(ncp->fd >= 0) {close(ncp->fd); ncp->fd = -1;} /* not taken */
     if(stat == NC_NOERR) {
         if(ncidp) *ncidp = ncp->ext_ncid;
     } else {
         del_from_NCList(ncp);
         free_NC(ncp);
+        ncp = NULL;
+    }
+    if(t0 != 0) {
+        if(ncp != NULL) NC_trace_install(ncp);
+        NC_trace_record(NCTRACE_open,(ncp != NULL ? ncp->ext_ncid : -1),t0,0,stat);
     }
 
 done:
+    if(fd >= 0) close(fd);
     nullfree(path);
     nullfree(newpath);
     return stat;
@@ -2291,6 +2515,8 @@ static int pseudofd = 0;
 int
 nc__pseudofd(void)
 {
+    int fd;
+    NCLOCKGLOBAL();
     if(pseudofd == 0)  {
 #ifdef HAVE_GETRLIMIT
         int maxfd = 32767; /* default */
@@ -2304,6 +2530,8 @@ nc__pseudofd(void)
         pseudofd = maxfd+1;
 #endif
     }
-    return pseudofd++;
+    fd = pseudofd++;
+    NCUNLOCKGLOBAL();
+    return fd;
 }
 /** \} */
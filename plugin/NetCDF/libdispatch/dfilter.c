@@ -62,7 +62,7 @@ nc_inq_var_filter_ids(int ncid, int varid, size_t* nfiltersp, unsigned int* ids)
     int stat = NC_check_id(ncid,&ncp);
     if(stat != NC_NOERR) return stat;
     TRACE(nc_inq_var_filter_ids);
-    if((stat = ncp->dispatch->inq_var_filter_ids(ncid,varid,nfiltersp,ids))) goto done;
+    if((stat = NC_LOCKED(ncp,ncp->dispatch->inq_var_filter_ids(ncid,varid,nfiltersp,ids)))) goto done;
 
 done:
    return stat;
@@ -98,7 +98,7 @@ nc_inq_var_filter_info(int ncid, int varid, unsigned int id, size_t* nparamsp, u
     int stat = NC_check_id(ncid,&ncp);
     if(stat != NC_NOERR) return stat;
     TRACE(nc_inq_var_filter_info);
-    if((stat = ncp->dispatch->inq_var_filter_info(ncid,varid,id,nparamsp,params))) goto done;
+    if((stat = NC_LOCKED(ncp,ncp->dispatch->inq_var_filter_info(ncid,varid,id,nparamsp,params)))) goto done;
 
 done:
      if(stat == NC_ENOFILTER) nclog(NCLOGWARN,"Undefined filter: %u",(unsigned)id);
@@ -130,7 +130,7 @@ nc_def_var_filter(int ncid, int varid, unsigned int id, size_t nparams, const un
 
     TRACE(nc_inq_var_filter);
     if((stat = NC_check_id(ncid,&ncp))) return stat;
-    if((stat = ncp->dispatch->def_var_filter(ncid,varid,id,nparams,params))) goto done;
+    if((stat = NC_LOCKED(ncp,ncp->dispatch->def_var_filter(ncid,varid,id,nparams,params)))) goto done;
 done:
      if(stat == NC_ENOFILTER) nclog(NCLOGWARN,"Undefined filter: %u",(unsigned)id);
     return stat;
@@ -213,7 +213,7 @@ nc_inq_filter_avail(int ncid, unsigned id)
 
     stat = NC_check_id(ncid,&ncp);
     if(stat != NC_NOERR) return stat;
-    if((stat = ncp->dispatch->inq_filter_avail(ncid,id))) goto done;
+    if((stat = NC_LOCKED(ncp,ncp->dispatch->inq_filter_avail(ncid,id)))) goto done;
 done:
     return stat;
 }
@@ -10,6 +10,7 @@ See LICENSE.txt for license information.
 
 #include "netcdf.h"
 #include "ncglobal.h"
+#include "nclock.h"
 #include "nclist.h"
 #include "ncuri.h"
 #include "ncrc.h"
@@ -70,15 +71,21 @@ done:
 NCglobalstate*
 NC_getglobalstate(void)
 {
+    NCglobalstate* gs;
+    NCLOCKGLOBAL();
     if(nc_globalstate == NULL)
         NC_createglobalstate();
-    return nc_globalstate;
+    gs = nc_globalstate;
+    NCUNLOCKGLOBAL();
+    return gs;
 }
 
 void
 NC_freeglobalstate(void)
 {
-    NCglobalstate* gs = nc_globalstate;
+    NCglobalstate* gs;
+    NCLOCKGLOBAL();
+    gs = nc_globalstate;
     if(gs != NULL) {
         nullfree(gs->tempdir);
         nullfree(gs->home);
@@ -93,6 +100,7 @@ NC_freeglobalstate(void)
 	free(gs);
 	nc_globalstate = NULL;
     }
+    NCUNLOCKGLOBAL();
 }
 
 /** \} */
@@ -60,7 +60,7 @@ int nc_inq_ncid(int ncid, const char *name, int *grp_ncid)
     NC* ncp;
     int stat = NC_check_id(ncid,&ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->inq_ncid(ncid,name,grp_ncid);
+    return NC_LOCKED(ncp,ncp->dispatch->inq_ncid(ncid,name,grp_ncid));
 }
 
 /*! @ingroup groups
@@ -78,7 +78,7 @@ int nc_inq_grps(int ncid, int *numgrps, int *ncids)
     NC* ncp;
     int stat = NC_check_id(ncid,&ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->inq_grps(ncid,numgrps,ncids);
+    return NC_LOCKED(ncp,ncp->dispatch->inq_grps(ncid,numgrps,ncids));
 }
 
 /*! @ingroup groups
@@ -95,7 +95,7 @@ int nc_inq_grpname(int ncid, char *name)
     NC* ncp;
     int stat = NC_check_id(ncid,&ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->inq_grpname(ncid,name);
+    return NC_LOCKED(ncp,ncp->dispatch->inq_grpname(ncid,name));
 }
 
 /*! @ingroup groups
@@ -115,7 +115,7 @@ int nc_inq_grpname_full(int ncid, size_t *lenp, char *full_name)
     NC* ncp;
     int stat = NC_check_id(ncid,&ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->inq_grpname_full(ncid,lenp,full_name);
+    return NC_LOCKED(ncp,ncp->dispatch->inq_grpname_full(ncid,lenp,full_name));
 }
 
 /*! @ingroup groups
@@ -149,7 +149,7 @@ int nc_inq_grp_parent(int ncid, int *parent_ncid)
     NC* ncp;
     int stat = NC_check_id(ncid,&ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->inq_grp_parent(ncid,parent_ncid);
+    return NC_LOCKED(ncp,ncp->dispatch->inq_grp_parent(ncid,parent_ncid));
 }
 
 /*! @ingroup groups
@@ -190,7 +190,7 @@ int nc_inq_grp_full_ncid(int ncid, const char *full_name, int *grp_ncid)
     NC* ncp;
     int stat = NC_check_id(ncid,&ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->inq_grp_full_ncid(ncid,full_name,grp_ncid);
+    return NC_LOCKED(ncp,ncp->dispatch->inq_grp_full_ncid(ncid,full_name,grp_ncid));
 }
 
 
@@ -209,7 +209,7 @@ int nc_inq_varids(int ncid, int *nvars, int *varids)
     NC* ncp;
     int stat = NC_check_id(ncid,&ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->inq_varids(ncid,nvars,varids);
+    return NC_LOCKED(ncp,ncp->dispatch->inq_varids(ncid,nvars,varids));
 }
 
 /*! @ingroup groups
@@ -228,7 +228,7 @@ int nc_inq_dimids(int ncid, int *ndims, int *dimids, int include_parents)
     NC* ncp;
     int stat = NC_check_id(ncid,&ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->inq_dimids(ncid,ndims,dimids,include_parents);
+    return NC_LOCKED(ncp,ncp->dispatch->inq_dimids(ncid,ndims,dimids,include_parents));
 }
 
 /*! @ingroup groups
@@ -247,7 +247,7 @@ int nc_inq_typeids(int ncid, int *ntypes, int *typeids)
     NC* ncp;
     int stat = NC_check_id(ncid,&ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->inq_typeids(ncid,ntypes,typeids);
+    return NC_LOCKED(ncp,ncp->dispatch->inq_typeids(ncid,ntypes,typeids));
 }
 
 /*! @ingroup groups
@@ -298,7 +298,7 @@ int nc_def_grp(int parent_ncid, const char *name, int *new_ncid)
     NC* ncp;
     int stat = NC_check_id(parent_ncid,&ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->def_grp(parent_ncid,name,new_ncid);
+    return NC_LOCKED(ncp,ncp->dispatch->def_grp(parent_ncid,name,new_ncid));
 }
 
 /*! @ingroup groups
@@ -319,7 +319,7 @@ int nc_rename_grp(int grpid, const char *name)
     NC* ncp;
     int stat = NC_check_id(grpid,&ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->rename_grp(grpid,name);
+    return NC_LOCKED(ncp,ncp->dispatch->rename_grp(grpid,name));
 }
 
 /*! @ingroup groups
@@ -335,7 +335,7 @@ int nc_show_metadata(int ncid)
     NC* ncp;
     int stat = NC_check_id(ncid,&ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->show_metadata(ncid);
+    return NC_LOCKED(ncp,ncp->dispatch->show_metadata(ncid));
 }
 
 /** \} */
@@ -0,0 +1,125 @@
+/*
+Copyright (c) 1998-2018 University Corporation for Atmospheric Research/Unidata
+See COPYRIGHT for license information.
+*/
+
+/*
+Fast non-cryptographic hash of the names kept in the in-memory
+tables (nchashmap.c, ncexhash.c).
+
+This is wyhash (final version 4, by Wang Yi, released to the public
+domain). It reads the key 4 or 8 bytes at a time and mixes with
+64x64->128 bit multiplies, so a typical name of 5 to 30 bytes costs
+a handful of instructions, where the table-driven CRC-64 used before
+went byte by byte. Its values are never written to files, so it can
+be changed freely; on big-endian machines it gives other values than
+on little-endian ones, which does no harm for the same reason.
+*/
+
+#include "config.h"
+#include <stddef.h>
+#include <string.h>
+#ifdef HAVE_STDINT_H
+#include <stdint.h>
+#endif
+#include "netcdf.h"
+#include "nccrc.h"
+
+static const uint64_t wysecret[4] = {
+    0xa0761d6478bd642full, 0xe7037ed1a0b428dbull,
+    0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull
+};
+
+/* 128 bit product of *A and *B; low half in *A, high half in *B */
+static inline void
+wymum(uint64_t* A, uint64_t* B)
+{
+#ifdef __SIZEOF_INT128__
+    __uint128_t r = *A;
+    r *= *B;
+    *A = (uint64_t)r;
+    *B = (uint64_t)(r >> 64);
+#else
+    uint64_t ha = *A >> 32, hb = *B >> 32, la = (uint32_t)*A, lb = (uint32_t)*B, hi, lo;
+    uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb, t = rl + (rm0 << 32), c = t < rl;
+    lo = t + (rm1 << 32);
+    c += lo < t;
+    hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+    *A = lo;
+    *B = hi;
+#endif
+}
+
+static inline uint64_t
+wymix(uint64_t A, uint64_t B)
+{
+    wymum(&A, &B);
+    return A ^ B;
+}
+
+static inline uint64_t
+wyr8(const unsigned char* p)
+{
+    uint64_t v;
+    memcpy(&v, p, 8);
+    return v;
+}
+
+static inline uint64_t
+wyr4(const unsigned char* p)
+{
+    uint32_t v;
+    memcpy(&v, p, 4);
+    return v;
+}
+
+/* 1 to 3 bytes */
+static inline uint64_t
+wyr3(const unsigned char* p, size_t k)
+{
+    return (((uint64_t)p[0]) << 16) | (((uint64_t)p[k >> 1]) << 8) | p[k - 1];
+}
+
+EXTERNL unsigned long long
+NC_hash64(const void* key, size_t len)
+{
+    const unsigned char* p = (const unsigned char*)key;
+    const uint64_t* s = wysecret;
+    uint64_t seed = wymix(s[0], s[1]); /* seed 0 */
+    uint64_t a, b;
+
+    if(len <= 16) {
+	if(len >= 4) {
+	    a = (wyr4(p) << 32) | wyr4(p + ((len >> 3) << 2));
+	    b = (wyr4(p + len - 4) << 32) | wyr4(p + len - 4 - ((len >> 3) << 2));
+	} else if(len > 0) {
+	    a = wyr3(p, len);
+	    b = 0;
+	} else
+	    a = b = 0;
+    } else {
+	size_t i = len;
+	if(i > 48) {
+	    uint64_t see1 = seed, see2 = seed;
+	    do {
+		seed = wymix(wyr8(p) ^ s[1], wyr8(p + 8) ^ seed);
+		see1 = wymix(wyr8(p + 16) ^ s[2], wyr8(p + 24) ^ see1);
+		see2 = wymix(wyr8(p + 32) ^ s[3], wyr8(p + 40) ^ see2);
+		p += 48;
+		i -= 48;
+	    } while(i > 48);
+	    seed ^= see1 ^ see2;
+	}
+	while(i > 16) {
+	    seed = wymix(wyr8(p) ^ s[1], wyr8(p + 8) ^ seed);
+	    i -= 16;
+	    p += 16;
+	}
+	a = wyr8(p + i - 16);
+	b = wyr8(p + i - 8);
+    }
+    a ^= s[1];
+    b ^= seed;
+    wymum(&a, &b);
+    return wymix(a ^ s[0] ^ len, b ^ s[1]);
+}
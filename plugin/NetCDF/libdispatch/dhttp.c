@@ -31,6 +31,7 @@
 #include "ncs3sdk.h"
 #endif
 #include "nchttp.h"
+#include "nclock.h"
 
 #undef TRACE
 
@@ -606,14 +607,16 @@ setupconn(NC_HTTP_STATE* state, const char* objecturl)
         if(uri == NULL) goto fail;
         hostport = NC_combinehostport(uri);
         ncurifree(uri); uri = NULL;
+        /* curl copies the value, under the lock, see NC_rclookup() */
+        NCLOCKGLOBAL();
         value = NC_rclookup("HTTP.SSL.CAINFO",hostport,NULL);
         nullfree(hostport); hostport = NULL;    
         if(value == NULL)
             value = NC_rclookup("HTTP.SSL.CAINFO",NULL,NULL);
-        if(value != NULL) {
+        if(value != NULL)
             cstat = CURLERR(curl_easy_setopt(state->curl.curl, CURLOPT_CAINFO, value));
-            if (cstat != CURLE_OK) goto fail;
-        }
+        NCUNLOCKGLOBAL();
+        if (value != NULL && cstat != CURLE_OK) goto fail;
     }
 
     /* Set the method */
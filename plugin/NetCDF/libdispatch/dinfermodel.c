@@ -17,6 +17,12 @@
 #ifdef HAVE_SYS_TYPES_H
 #include <sys/types.h>
 #endif
+#ifdef HAVE_SYS_STAT_H
+#include <sys/stat.h>
+#endif
+#ifdef HAVE_FCNTL_H
+#include <fcntl.h>
+#endif
 #ifndef _WIN32
 #ifdef USE_HDF5
 #include <hdf5.h>
@@ -857,6 +863,59 @@ set_default_mode(int* modep)
     *modep = mode; /* final result */
 }
 
+/* Make the mode flags agree with the inferred model */
+static int
+forceflags(const NCmodel* model, int* omodep)
+{
+    int omode = *omodep;
+    switch (model->impl) {
+    case NC_FORMATX_NC4:
+    case NC_FORMATX_NC_HDF4:
+    case NC_FORMATX_DAP4:
+    case NC_FORMATX_NCZARR:
+	omode |= NC_NETCDF4;
+	if(model->format == NC_FORMAT_NETCDF4_CLASSIC)
+	    omode |= NC_CLASSIC_MODEL;
+	break;
+    case NC_FORMATX_NC3:
+	omode &= ~NC_NETCDF4; /* must be netcdf-3 (CDF-1, CDF-2, CDF-5) */
+	if(model->format == NC_FORMAT_64BIT_OFFSET) omode |= NC_64BIT_OFFSET;
+	else if(model->format == NC_FORMAT_64BIT_DATA) omode |= NC_64BIT_DATA;
+	break;
+    case NC_FORMATX_PNETCDF:
+	omode &= ~NC_NETCDF4; /* must be netcdf-3 (CDF-1, CDF-2, CDF-5) */
+	if(model->format == NC_FORMAT_64BIT_OFFSET) omode |= NC_64BIT_OFFSET;
+	else if(model->format == NC_FORMAT_64BIT_DATA) omode |= NC_64BIT_DATA;
+	break;
+    case NC_FORMATX_DAP2:
+	omode &= ~(NC_NETCDF4|NC_64BIT_OFFSET|NC_64BIT_DATA|NC_CLASSIC_MODEL);
+	break;
+    case NC_FORMATX_UDF0:
+    case NC_FORMATX_UDF1:
+    case NC_FORMATX_UDF2:
+    case NC_FORMATX_UDF3:
+    case NC_FORMATX_UDF4:
+    case NC_FORMATX_UDF5:
+    case NC_FORMATX_UDF6:
+    case NC_FORMATX_UDF7:
+    case NC_FORMATX_UDF8:
+    case NC_FORMATX_UDF9:
+        if(model->format == NC_FORMAT_64BIT_OFFSET) 
+            omode |= NC_64BIT_OFFSET;
+        else if(model->format == NC_FORMAT_64BIT_DATA)
+            omode |= NC_64BIT_DATA;
+        else if(model->format == NC_FORMAT_NETCDF4)  
+            omode |= NC_NETCDF4;
+        else if(model->format == NC_FORMAT_NETCDF4_CLASSIC)  
+            omode |= NC_NETCDF4|NC_CLASSIC_MODEL;
+        break;
+    default:
+	return NC_ENOTNC;
+    }
+    *omodep = omode;
+    return NC_NOERR;
+}
+
 /**************************************************/
 /*
    Infer model for this dataset using some
@@ -1027,50 +1086,7 @@ NC_infermodel(const char* path, int* omodep, int iscreate, int useparallel, void
 	{stat = NC_ENOTNC; goto done;}
 
     /* Force flag consistency */
-    switch (model->impl) {
-    case NC_FORMATX_NC4:
-    case NC_FORMATX_NC_HDF4:
-    case NC_FORMATX_DAP4:
-    case NC_FORMATX_NCZARR:
-	omode |= NC_NETCDF4;
-	if(model->format == NC_FORMAT_NETCDF4_CLASSIC)
-	    omode |= NC_CLASSIC_MODEL;
-	break;
-    case NC_FORMATX_NC3:
-	omode &= ~NC_NETCDF4; /* must be netcdf-3 (CDF-1, CDF-2, CDF-5) */
-	if(model->format == NC_FORMAT_64BIT_OFFSET) omode |= NC_64BIT_OFFSET;
-	else if(model->format == NC_FORMAT_64BIT_DATA) omode |= NC_64BIT_DATA;
-	break;
-    case NC_FORMATX_PNETCDF:
-	omode &= ~NC_NETCDF4; /* must be netcdf-3 (CDF-1, CDF-2, CDF-5) */
-	if(model->format == NC_FORMAT_64BIT_OFFSET) omode |= NC_64BIT_OFFSET;
-	else if(model->format == NC_FORMAT_64BIT_DATA) omode |= NC_64BIT_DATA;
-	break;
-    case NC_FORMATX_DAP2:
-	omode &= ~(NC_NETCDF4|NC_64BIT_OFFSET|NC_64BIT_DATA|NC_CLASSIC_MODEL);
-	break;
-    case NC_FORMATX_UDF0:
-    case NC_FORMATX_UDF1:
-    case NC_FORMATX_UDF2:
-    case NC_FORMATX_UDF3:
-    case NC_FORMATX_UDF4:
-    case NC_FORMATX_UDF5:
-    case NC_FORMATX_UDF6:
-    case NC_FORMATX_UDF7:
-    case NC_FORMATX_UDF8:
-    case NC_FORMATX_UDF9:
-        if(model->format == NC_FORMAT_64BIT_OFFSET) 
-            omode |= NC_64BIT_OFFSET;
-        else if(model->format == NC_FORMAT_64BIT_DATA)
-            omode |= NC_64BIT_DATA;
-        else if(model->format == NC_FORMAT_NETCDF4)  
-            omode |= NC_NETCDF4;
-        else if(model->format == NC_FORMAT_NETCDF4_CLASSIC)  
-            omode |= NC_NETCDF4|NC_CLASSIC_MODEL;
-        break;
-    default:
-	{stat = NC_ENOTNC; goto done;}
-    }
+    if((stat = forceflags(model,&omode))) goto done;
 
 done:
     nullfree(sfrag);
@@ -1083,6 +1099,79 @@ done:
     return check(stat);
 }
 
+/*
+   Quick version of NC_infermodel for opening an absolute path to a
+   local file, the common case. It skips the URL processing and the
+   path conversion, and reads the magic number with a single pread.
+   The descriptor is returned in *fdp so that the classic backend
+   can use it instead of opening the file again; the caller closes it.
+
+   Returns NC_EURL when the path needs the general treatment, in
+   which case nothing has been changed and the caller should call
+   NC_infermodel(). Errors are left to NC_infermodel too, so that
+   both report them the same way.
+*/
+
+int
+NC_infermodel_local(const char* path, int* omodep, int useparallel, NCmodel* model, int* fdp)
+{
+#if defined(HAVE_UNISTD_H) && defined(HAVE_FCNTL_H) && !defined(_WIN32) && !defined(__CYGWIN__) && !defined(__MSYS__)
+    int omode = *omodep;
+    int fd = -1;
+    struct stat st;
+    char magic[NC_MAX_MAGIC_NUMBER_LEN];
+    NCmodel m;
+
+    /* Anything but a plain absolute path may be a URL, a DAOS
+       container or some other special case */
+    if(path == NULL || path[0] != '/' || strchr(path,'#') != NULL)
+        return NC_EURL;
+    if(useparallel || fIsSet(omode,NC_INMEMORY))
+        return NC_EURL;
+    memset(&m,0,sizeof(m));
+    /* Only the netCDF formats; user defined formats read the file themselves */
+    if(NC_omodeinfer(useparallel,omode,&m) != NC_NOERR
+       || (m.impl != NC_FORMATX_NC3 && m.impl != NC_FORMATX_NC_HDF5))
+        return NC_EURL;
+    if(isdaoscontainer(path) == NC_NOERR)
+        return NC_EURL;
+
+    if((fd = open(path,O_RDONLY)) < 0)
+        return NC_EURL;
+    if(fstat(fd,&st) != 0 || !S_ISREG(st.st_mode)
+       || (unsigned long long)st.st_size <= MAGIC_NUMBER_LEN)
+        goto slow;
+    if(pread(fd,magic,MAGIC_NUMBER_LEN,0) != MAGIC_NUMBER_LEN)
+        goto slow;
+    if(NC_interpret_magic_number(magic,&m) != NC_NOERR || m.format == 0) {
+        /* HDF5 files may have a user block; the signature is then at
+           512, 1024, 2048, ... */
+        unsigned long long pos;
+        for(pos=512;;pos*=2) {
+            if(pos+MAGIC_NUMBER_LEN > (unsigned long long)st.st_size)
+                goto slow;
+            if(pread(fd,magic,MAGIC_NUMBER_LEN,(off_t)pos) != MAGIC_NUMBER_LEN)
+                goto slow;
+            NC_interpret_magic_number(magic,&m);
+            if(m.impl == NC_FORMATX_NC4) break;
+        }
+    }
+    if(!modelcomplete(&m) || forceflags(&m,&omode) != NC_NOERR)
+        goto slow;
+
+    *model = m;
+    *omodep = omode;
+    *fdp = fd;
+    return NC_NOERR;
+
+slow:
+    close(fd);
+#else
+    (void)path; (void)omodep; (void)useparallel; (void)model; (void)fdp;
+#endif
+    return NC_EURL;
+}
+
 static int
 isreadable(NCURI* uri, NCmodel* model)
 {
@@ -23,6 +23,7 @@ Currently two operations are defined:
 #include "nc4dispatch.h"
 #include "ncoffsets.h"
 #include "ncbytes.h"
+#include "nclock.h"
 
 #undef REPORT
 #undef DEBUG
@@ -110,8 +111,8 @@ nc_reclaim_data(int ncid, nc_type xtype, void* memory, size_t count)
     if((stat = NC_check_id(ncid,&nc))) goto done;    
     nc = DAPSUBSTRATE(nc);
 
-    /* Call internal version */
-    stat = NC_reclaim_data(nc,xtype,memory,count);
+    /* Call internal version; it may list the members of a type */
+    stat = NC_LOCKED(nc,NC_reclaim_data(nc,xtype,memory,count));
 
 #if 0
 #ifdef USE_NETCDF4
@@ -202,8 +203,8 @@ nc_copy_data(int ncid, nc_type xtype, const void* memory, size_t count, void* co
     if((stat = NC_check_id(ncid,&nc))) goto done;    
     nc = DAPSUBSTRATE(nc);
 
-    /* Call internal version */
-    stat = NC_copy_data(nc,xtype,memory,count,copy);
+    /* Call internal version; it may list the members of a type */
+    stat = NC_LOCKED(nc,NC_copy_data(nc,xtype,memory,count,copy));
 done:
     return stat;
 }
@@ -9,6 +9,13 @@ on a deep level rather than the shallow level of e.g. nc_free_vlen_t.
 Currently two operations are defined:
 1. reclaim a vector of instances
 2. copy a vector of instances
+
+Types without strings or VLENs, even nested, are copied with one
+memcpy() and need no reclaiming. For the variable sized compound
+types, the members holding pointers are listed once per type, with
+nested compounds flattened (NC_TYPE_INFO_T.ptrs), so a vector of
+instances is copied with one memcpy() and then only those members
+are deep copied, and reclaiming visits only them.
 */
 
 #include "config.h"
@@ -24,15 +31,16 @@ Currently two operations are defined:
 #undef REPORT
 #undef DEBUG
 
-/* It is helpful to have a structure that identifies a pointer into the overall memory */
-typedef struct Position{char* memory;} Position;
+/* Nested compound arrays are flattened into the outer type if they
+   add at most this many pointer members; larger ones are recursed */
+#define MAXFLATTEN 64
 
 static int type_alignment_initialized = 0;
 
 /* Forward */
 #ifdef USE_NETCDF4
-static int reclaim_datar(NC_FILE_INFO_T* file, NC_TYPE_INFO_T* utype, Position instance);
-static int copy_datar(NC_FILE_INFO_T* file, NC_TYPE_INFO_T* utype, Position src, Position dst);
+static int reclaim_vector(NC_FILE_INFO_T* file, nc_type xtype, NC_TYPE_INFO_T* utype, char* memory, size_t count);
+static int copy_vector(NC_FILE_INFO_T* file, nc_type xtype, NC_TYPE_INFO_T* utype, const char* src, char* dst, size_t count);
 #endif
 
 int NC_print_data(NC_FILE_INFO_T* file, nc_type xtype, const void* memory, size_t count);
@@ -56,9 +64,6 @@ will be free'd.
 
 Should work for any netcdf type.
 
-Note that this has been optimized significantly, largely
-by unwinding various reclaim cliche procedures.
-
 @param nc NC* structure
 @param xtype type id
 @param memory ptr to top-level memory to reclaim
@@ -70,49 +75,26 @@ int
 NC_reclaim_data(NC* nc, nc_type xtype, void* memory, size_t count)
 {
     int stat = NC_NOERR;
-    size_t i;
-    Position instance;
     NC_FILE_INFO_T* file = NULL;
     NC_TYPE_INFO_T* utype = NULL;
 
     assert(nc != NULL);
     assert((memory == NULL && count == 0) || (memory != NULL || count > 0));
 
-    /* Process atomic types */
-
     /* Optimize: Vector of fixed size atomic types (always the case for netcdf-3)*/
-    if(xtype < NC_STRING) goto done;
+    if(xtype < NC_STRING || count == 0) goto done;
 
 #ifdef USE_NETCDF4
-    /* Optimize: Vector of strings */
-    if(xtype == NC_STRING) {
-	char** ss = (char**)memory;
-        for(i=0;i<count;i++) {
-	    nullfree(ss[i]);
-	}
-        goto done;
+    if(xtype > NC_STRING) {
+        assert(USEFILEINFO(nc) != 0);
+        file = (NC_FILE_INFO_T*)(nc)->dispatchdata;
+        if((stat = nc4_find_type(file,xtype,&utype))) goto done;
+        /* Optimize: vector of fixed sized user type instances */
+        if(!utype->varsized) goto done; /* no need to reclaim anything */
     }
 
-    /* Process User types */
-    assert(USEFILEINFO(nc) != 0);
-    file = (NC_FILE_INFO_T*)(nc)->dispatchdata;
-    if((stat = nc4_find_type(file,xtype,&utype))) goto done;
-
-    /* Optimize: vector of fixed sized compound type instances */
-    if(!utype->varsized) goto done; /* no need to reclaim anything */
-
-    /* Remaining cases: vector of VLEN and vector of (transitive) variable sized compound types.
-       These all require potential recursion.
-    */
-
-    /* Build a memory walker object */
-    instance.memory = (char*)memory; /* use char* so we can do pointer arithmetic */
-    /* Walk each vector instance */
-    /* Note that we avoid reclaiming the top level memory */
-    for(i=0;i<count;i++) {
-        if((stat=reclaim_datar(file,utype,instance))) goto done;
-	instance.memory += utype->size; /* move to next entry */
-    }
+    /* Remaining cases: strings, VLENs and variable sized compounds */
+    stat = reclaim_vector(file,xtype,utype,(char*)memory,count);
 #else
     stat = NC_EBADTYPE;
 #endif
@@ -122,99 +104,146 @@ done:
 }
 
 #ifdef USE_NETCDF4
-/* Recursive type walker: reclaim a single instance of a variable-sized user-defined type;
-   specifically a vlen or a variable-sized compound type instance
-*/
+/* Size of one instance of a pointer member */
+static size_t
+member_size(const NC_PTR_MEMBER* m)
+{
+    if(m->nc_typeid == NC_STRING) return sizeof(char*);
+    if(m->type->nc_type_class == NC_VLEN) return sizeof(nc_vlen_t);
+    return m->type->size;
+}
+
 static int
-reclaim_datar(NC_FILE_INFO_T* file, NC_TYPE_INFO_T* utype, Position instance)
+member_cmp(const void* a, const void* b)
 {
-    int i,stat = NC_NOERR;
-    nc_type basetypeid;
-    NC_TYPE_INFO_T* basetype = NULL;
-    size_t nfields;
-    nc_vlen_t* vlen;
-    size_t fid;
-    int ndims;
-    int dimsizes[NC_MAX_VAR_DIMS];
-    size_t alignment = 0;
-    Position vinstance; /* walk the vlen instance memory */
-
-    assert(utype->varsized); /* All fixed size cases are optimized out */
-
-    /* Leaving VLEN or Compound */
-
-    if(utype->nc_type_class == NC_VLEN) {
-	basetypeid = utype->u.v.base_nc_typeid; /* Get basetype */
-	vlen = (nc_vlen_t*)instance.memory;/* memory as vector of nc_vlen_t instances */
-	/* Optimize: basetype is atomic fixed size */
-	if(basetypeid < NC_STRING) {
-	    goto out;
-  	}
-	/* Optimize: basetype is string */
-	if(basetypeid == NC_STRING) {
-            if(vlen->len > 0 && vlen->p != NULL) {
-	        char** slist = (char**)vlen->p; /* vlen instance is a vector of string pointers */
-		for(i=0;i<vlen->len;i++) {if(slist[i] != NULL) free(slist[i]);}
-	    }
-	    goto out;
-	}
-	/* Optimize: vlen basetype is a fixed-size user-type */
-        if((stat = nc4_find_type(file,basetypeid,&basetype))) goto done;
-        if(!basetype->varsized) {
-	    goto out;
-	}
-        /* Remaining case: basetype is itself variable size => recurse */
-        if((stat = NC_type_alignment_internal(file,basetypeid,basetype,&alignment))) goto done;;
-        vinstance.memory = (char*)vlen->p; /* use char* so we can do pointer arithmetic */
-        vinstance.memory = (void*)NC_read_align((uintptr_t)vinstance.memory,alignment);
-        for(i=0;i<vlen->len;i++) {
-            if((stat=reclaim_datar(file,basetype,vinstance))) goto done; /* reclaim one basetype instance */
-	    vinstance.memory += basetype->size; /* move to next base instance */
+    size_t oa = ((const NC_PTR_MEMBER*)a)->offset;
+    size_t ob = ((const NC_PTR_MEMBER*)b)->offset;
+    return oa < ob ? -1 : oa > ob;
+}
+
+/* Append a member to *ptrsp, joining it to the last one when it is
+   the same type and follows it */
+static int
+add_member(NC_PTR_MEMBER** ptrsp, size_t* np, size_t* allocp, const NC_PTR_MEMBER* m)
+{
+    if(*np > 0) {
+        NC_PTR_MEMBER* last = &(*ptrsp)[*np - 1];
+        if(last->nc_typeid == m->nc_typeid
+           && last->offset + last->count * member_size(last) == m->offset) {
+            last->count += m->count;
+            return NC_NOERR;
         }
-out:
-        if(vlen->len > 0 && vlen->p != NULL) {free(vlen->p);}
-        goto done;	
-    } else if(utype->nc_type_class == NC_COMPOUND) {    
-	Position finstance;  /* mark the fields's instance */
-	nfields = nclistlength(utype->u.c.field);
-        /* Get info about each field in turn and reclaim it */
-        for(fid=0;fid<nfields;fid++) {
-	    NC_FIELD_INFO_T* field = NULL;
-	    
-	    /* Get field's dimension sizes */
-	    field = (NC_FIELD_INFO_T*)nclistget(utype->u.c.field,fid);    
-	    ndims = field->ndims;
-	    int arraycount = 1;
-	    for(i=0;i<ndims;i++) {dimsizes[i] = field->dim_size[i]; arraycount *= dimsizes[i];}
-            if(field->ndims == 0) {ndims=1; dimsizes[0]=1;} /* fake the scalar case */
-
-            /* "Move" to start of this field's instance */
-            finstance.memory = instance.memory + field->offset; /* includes proper alignment */
-
-	    /* optimize: fixed length atomic type */
-	    if(field->nc_typeid < NC_STRING) continue;
-
-	    /* optimize: string field type */
-	    if(field->nc_typeid == NC_STRING) {
-	        char** strvec = (char**)finstance.memory;
-		for(i=0;i<arraycount;i++) {
-		    if(strvec[i] != NULL) free(strvec[i]);
-		}
-		continue; /* do next field */
-	    }
-	    
-	    /* optimize: fixed length compound base type */
-            if((stat = nc4_find_type(file,field->nc_typeid,&basetype))) goto done;
-	    if(!basetype->varsized) continue;
+    }
+    if(*np == *allocp) {
+        size_t nalloc = (*allocp == 0 ? 8 : 2 * *allocp);
+        NC_PTR_MEMBER* p = (NC_PTR_MEMBER*)realloc(*ptrsp,nalloc*sizeof(NC_PTR_MEMBER));
+        if(p == NULL) return NC_ENOMEM;
+        *ptrsp = p;
+        *allocp = nalloc;
+    }
+    (*ptrsp)[(*np)++] = *m;
+    return NC_NOERR;
+}
 
-	    /* Field is itself variable length (possibly transitively) */
-	    for(i=0;i<arraycount;i++) {
-                if((stat = reclaim_datar(file, basetype, finstance))) goto done;
-		finstance.memory += basetype->size;
+/* List the pointer members of a variable sized compound type in
+   utype->ptrs, sorted by offset. Nested compounds come first, so that
+   their lists can be copied in */
+static int
+compound_layout(NC_FILE_INFO_T* file, NC_TYPE_INFO_T* utype)
+{
+    int stat = NC_NOERR;
+    NC_PTR_MEMBER* ptrs = NULL;
+    NC_PTR_MEMBER m;
+    size_t n = 0, nalloc = 0, fid, i, j, k;
+
+    assert(utype->nc_type_class == NC_COMPOUND && utype->varsized);
+    if(utype->ptrs != NULL) goto done;
+
+    for(fid=0;fid<nclistlength(utype->u.c.field);fid++) {
+        NC_FIELD_INFO_T* field = (NC_FIELD_INFO_T*)nclistget(utype->u.c.field,fid);
+        NC_TYPE_INFO_T* basetype = NULL;
+        size_t arraycount = 1;
+
+        for(i=0;i<(size_t)field->ndims;i++) arraycount *= (size_t)field->dim_size[i];
+        if(field->nc_typeid < NC_STRING) continue;
+        m.offset = field->offset;
+        m.count = arraycount;
+        m.nc_typeid = field->nc_typeid;
+        m.type = NULL;
+        if(field->nc_typeid > NC_STRING) {
+            if((stat = nc4_find_type(file,field->nc_typeid,&basetype))) goto done;
+            if(!basetype->varsized) continue;
+            m.type = basetype;
+            if(basetype->nc_type_class == NC_COMPOUND) {
+                if((stat = compound_layout(file,basetype))) goto done;
+                if(arraycount * basetype->nptrs <= MAXFLATTEN) {
+                    /* Flatten: list its members as members of this type */
+                    for(j=0;j<arraycount;j++)
+                        for(k=0;k<basetype->nptrs;k++) {
+                            m = basetype->ptrs[k];
+                            m.offset += field->offset + j * basetype->size;
+                            if((stat = add_member(&ptrs,&n,&nalloc,&m))) goto done;
+                        }
+                    continue;
+                }
             }
         }
-	goto done;
-    } else {stat = NC_EBADTYPE; goto done;}
+        if((stat = add_member(&ptrs,&n,&nalloc,&m))) goto done;
+    }
+    if(n == 0) {stat = NC_EBADTYPE; goto done;} /* varsized says otherwise */
+
+    /* Fields need not be in offset order; sort, then join again */
+    qsort(ptrs,n,sizeof(NC_PTR_MEMBER),member_cmp);
+    for(i=1,j=0;i<n;i++) {
+        if(ptrs[j].nc_typeid == ptrs[i].nc_typeid
+           && ptrs[j].offset + ptrs[j].count * member_size(&ptrs[j]) == ptrs[i].offset)
+            ptrs[j].count += ptrs[i].count;
+        else
+            ptrs[++j] = ptrs[i];
+    }
+    utype->ptrs = ptrs;
+    utype->nptrs = j + 1;
+    ptrs = NULL;
+
+done:
+    free(ptrs);
+    return stat;
+}
+
+/* Reclaim the nested data of count instances of a string, VLEN or
+   variable sized compound type */
+static int
+reclaim_vector(NC_FILE_INFO_T* file, nc_type xtype, NC_TYPE_INFO_T* utype, char* memory, size_t count)
+{
+    int stat = NC_NOERR;
+    size_t i, k;
+
+    if(xtype == NC_STRING) {
+        char** ss = (char**)memory;
+        for(i=0;i<count;i++)
+            nullfree(ss[i]);
+    } else if(utype->nc_type_class == NC_VLEN) {
+        nc_vlen_t* vlens = (nc_vlen_t*)memory;
+        nc_type basetypeid = utype->u.v.base_nc_typeid;
+        NC_TYPE_INFO_T* basetype = NULL;
+
+        if(basetypeid > NC_STRING)
+            if((stat = nc4_find_type(file,basetypeid,&basetype))) goto done;
+        for(i=0;i<count;i++) {
+            if(vlens[i].len == 0 || vlens[i].p == NULL) continue;
+            if(basetypeid == NC_STRING || (basetype != NULL && basetype->varsized))
+                if((stat = reclaim_vector(file,basetypeid,basetype,(char*)vlens[i].p,vlens[i].len))) goto done;
+            free(vlens[i].p);
+        }
+    } else if(utype->nc_type_class == NC_COMPOUND) {
+        if((stat = compound_layout(file,utype))) goto done;
+        for(i=0;i<count;i++,memory += utype->size)
+            for(k=0;k<utype->nptrs;k++) {
+                const NC_PTR_MEMBER* m = &utype->ptrs[k];
+                if((stat = reclaim_vector(file,m->nc_typeid,m->type,memory + m->offset,m->count))) goto done;
+            }
+    } else
+        stat = NC_EBADTYPE;
 
 done:
     return stat;
@@ -234,7 +263,8 @@ by calling malloc().
 
 WARNING: DOES NOT ALLOCATE THE TOP-LEVEL MEMORY (see the
 nc_copy_data_all function).  Note that all memory blocks other
-than the top are dynamically allocated.
+than the top are dynamically allocated. If the copy fails, what was
+not copied is zeroed, so the copy can be given to NC_reclaim_data().
 
 Should work for any netcdf type.
 
@@ -250,12 +280,8 @@ int
 NC_copy_data(NC* nc, nc_type xtype, const void* memory, size_t count, void* copy)
 {
     int stat = NC_NOERR;
-    size_t i;
-    Position src;
-    Position dst;
     NC_FILE_INFO_T* file = NULL;
     NC_TYPE_INFO_T* utype = NULL;
-    size_t typesize = 0;
 
     if(memory == NULL || count == 0)
         goto done; /* ok, do nothing */
@@ -264,60 +290,26 @@ NC_copy_data(NC* nc, nc_type xtype, const void* memory, size_t count, void* copy
     assert(memory != NULL || count > 0);
     assert(copy != NULL || count == 0);
 
-    /* Process atomic types */
-
     /* Optimize: Vector of fixed size atomic types */
     if(xtype < NC_STRING) {
-	typesize = NC_atomictypelen(xtype);
-        memcpy(copy,memory,count*typesize);
+        memcpy(copy,memory,count*NC_atomictypelen(xtype));
 	goto done;
     }
-    
-#ifdef USE_NETCDF4
-    /* Optimize: Vector of strings */
-    if(xtype == NC_STRING) {
-	char** svec = (char**)memory;
-	char** dvec = (char**)copy;
-	size_t len;
-        for(i=0;i<count;i++) {
-	    const char* ssrc = svec[i];
-	    char* sdst;
-	    if(ssrc == NULL)
-		sdst = NULL;
-	    else {
-	        len = nulllen(ssrc);
-                if((sdst = (char*)malloc(len+1))==NULL) {stat = NC_ENOMEM; goto done;}
-	        memcpy(sdst,ssrc,len+1); /* +1 for trailing nul */
-	    }
-	    dvec[i] = sdst;
-	}
-        goto done;
-    }
-
-    assert(USEFILEINFO(nc) != 0);
-    file = (NC_FILE_INFO_T*)(nc)->dispatchdata;
-
-    /* Process User types */
-    if((stat = nc4_find_type(file,xtype,&utype))) goto done;
 
-    /* Optimize: vector of fixed sized compound type instances */
-    if(!utype->varsized) {
-        memcpy(copy,memory,count*utype->size);
-	goto done;
+#ifdef USE_NETCDF4
+    if(xtype > NC_STRING) {
+        assert(USEFILEINFO(nc) != 0);
+        file = (NC_FILE_INFO_T*)(nc)->dispatchdata;
+        if((stat = nc4_find_type(file,xtype,&utype))) goto done;
+        /* Optimize: vector of fixed sized user type instances */
+        if(!utype->varsized) {
+            memcpy(copy,memory,count*utype->size);
+            goto done;
+        }
     }
 
-    /* Remaining cases: vector of VLEN and vector of variable sized compound types.
-       These all require potential recursion.
-    */
-
-    src.memory = (char*)memory; /* use char* so we can do pointer arithmetic */
-    dst.memory = (char*)copy; /* use char* so we can do pointer arithmetic */
-    /* Walk each vector instance */
-    for(i=0;i<count;i++) {
-        if((stat=copy_datar(file,utype,src,dst))) goto done;
-	src.memory += utype->size;
-	dst.memory += utype->size;
-    }
+    /* Remaining cases: strings, VLENs and variable sized compounds */
+    stat = copy_vector(file,xtype,utype,(const char*)memory,(char*)copy,count);
 #else
     stat = NC_EBADTYPE;
 #endif
@@ -327,143 +319,82 @@ done:
 }
 
 #ifdef USE_NETCDF4
-/* Recursive type walker: reclaim an instance of variable-sized user-defined types;
-   specifically a vlen or a variable-sized compound type instance
-*/
+/* Copy one VLEN instance. On failure dst is left so that it can be
+   reclaimed */
 static int
-copy_datar(NC_FILE_INFO_T* file, NC_TYPE_INFO_T* utype, Position src, Position dst)
+copy_vlen(NC_FILE_INFO_T* file, NC_TYPE_INFO_T* utype, const nc_vlen_t* src, nc_vlen_t* dst)
 {
-    int i, stat = NC_NOERR;
-    nc_type basetypeid;
+    int stat = NC_NOERR;
+    nc_type basetypeid = utype->u.v.base_nc_typeid;
     NC_TYPE_INFO_T* basetype = NULL;
-    size_t nfields;
-    nc_vlen_t* srcvlens = NULL;
-    nc_vlen_t* dstvlens = NULL;
-    size_t fid, arraycount;
-    int ndims;
-    int dimsizes[NC_MAX_VAR_DIMS];
-    Position vsrc, vdst;
-    size_t alignment = 0;
-
-    assert(utype->varsized); /* All fixed size cases are optimized out */
-
-    /* Leaving VLEN or Compound */
-
-    if(utype->nc_type_class == NC_VLEN) {
-	size_t basetypesize = 0;
-	size_t copycount = 0;
-
-	basetypeid = utype->u.v.base_nc_typeid; /* Get basetype */
-	srcvlens = (nc_vlen_t*)src.memory;
-	dstvlens = (nc_vlen_t*)dst.memory;
-	dstvlens->len = srcvlens->len; /* always */
-
-	if(srcvlens->len == 0) {
-	    dstvlens->p = NULL;
-	    goto done;
-	}
+    size_t basetypesize;
 
-	if(basetypeid <= NC_MAX_ATOMIC_TYPE)
-	    basetypesize = NC_atomictypelen(basetypeid);
-        copycount = srcvlens->len*basetypesize;
-
-	/* Optimize: basetype is atomic fixed size */
-	if(basetypeid < NC_STRING) {
-	    if((dstvlens->p = (void*)malloc(copycount))==NULL) {stat = NC_ENOMEM; goto done;}
-	    memcpy(dstvlens->p,srcvlens->p,copycount);
-	    goto done;
-  	}
-
-	/* Optimize: basetype is string */
-	if(basetypeid == NC_STRING) {
-	    char** srcstrvec = (char**)srcvlens->p;
-    	    char** dststrvec = NULL;
-	    if((dststrvec = (void*)malloc(copycount))==NULL) {stat = NC_ENOMEM; goto done;}
-    	    dstvlens->p = (void*)dststrvec;
-	    for(i=0;i<srcvlens->len;i++) {
-		if((dststrvec[i] = strdup(srcstrvec[i]))==NULL) {stat = NC_ENOMEM; goto done;}
-	    }
-	    goto done;
-	}
+    dst->len = src->len;
+    dst->p = NULL;
+    if(src->len == 0 || src->p == NULL) {dst->len = 0; goto done;}
 
-	/* User-defined type */
-        /* Recompute base type size */
+    if(basetypeid <= NC_STRING)
+        basetypesize = NC_atomictypelen(basetypeid);
+    else {
         if((stat = nc4_find_type(file,basetypeid,&basetype))) goto done;
-	basetypesize = basetype->size;
-        copycount = srcvlens->len*basetypesize;
-
-	/* Optimize: basetype is user-type fixed size */
-        if(!basetype->varsized) {
-	    if((dstvlens->p = (void*)malloc(copycount))==NULL) {stat = NC_ENOMEM; goto done;}
-	    memcpy(dstvlens->p,srcvlens->p,copycount);
-	    goto done;
-	}
-
-        /* Remaining case: basetype is itself variable size => recurse */
-        if((stat = NC_type_alignment_internal(file,basetypeid,basetype,&alignment))) goto done;;
-        vsrc.memory = (char*)srcvlens->p; /* use char* so we can do pointer arithmetic */
-        if((vdst.memory = (char*)malloc(copycount))==NULL) {stat = NC_ENOMEM; goto done;}
-        dstvlens->p = vdst.memory; /* don't lose it */
-        vsrc.memory = (void*)NC_read_align((uintptr_t)vsrc.memory,alignment);
-	vdst.memory = (void*)NC_read_align((uintptr_t)vdst.memory,alignment);
-        for(i=0;i<srcvlens->len;i++) {
-            if((stat=copy_datar(file,basetype,vsrc,vdst))) goto done;
-	    vsrc.memory += basetype->size;
-	    vdst.memory += basetype->size;
-        }
-	goto done;	
-    } else if(utype->nc_type_class == NC_COMPOUND) {    
-	Position fsrc;  /* mark the src fields's instance */
-	Position fdst;  /* mark the dst fields's instance */
-	nfields = nclistlength(utype->u.c.field);
-        /* Get info about each field in turn and copy it */
-        for(fid=0;fid<nfields;fid++) {
-	    NC_FIELD_INFO_T* field = NULL;
-	    
-	    field = (NC_FIELD_INFO_T*)nclistget(utype->u.c.field,fid);    
-	    ndims = field->ndims;
-	    arraycount = 1;
-	    for(i=0;i<ndims;i++) {dimsizes[i] = field->dim_size[i]; arraycount *= (size_t)dimsizes[i];}
-            if(field->ndims == 0) {ndims=1; dimsizes[0]=1;} /* fake the scalar case */
-
-            /* "move" to this field */
-            fsrc.memory = src.memory + field->offset;
-            fdst.memory = dst.memory + field->offset;
-
-	    /* optimize: fixed length atomic type */
-	    if(field->nc_typeid < NC_STRING) {
-		size_t typesize = NC_atomictypelen(field->nc_typeid);
-		memcpy(fdst.memory,fsrc.memory,arraycount*typesize);
-		continue; /* move to next field */
-	    }
+        basetypesize = basetype->size;
+    }
+    if((dst->p = malloc(src->len * basetypesize)) == NULL) {dst->len = 0; stat = NC_ENOMEM; goto done;}
+    if(basetypeid < NC_STRING || (basetype != NULL && !basetype->varsized))
+        memcpy(dst->p,src->p,src->len * basetypesize);
+    else
+        stat = copy_vector(file,basetypeid,basetype,(const char*)src->p,(char*)dst->p,src->len);
 
-	    /* optimize: string field type */
-	    if(field->nc_typeid == NC_STRING) {
-	        char** srcstrvec = (char**)fsrc.memory;
-	        char** dststrvec = (char**)fdst.memory;
-		for(i=0;i<arraycount;i++) 
-		    {if(srcstrvec[i] != NULL) {dststrvec[i] = strdup(srcstrvec[i]);} else {dststrvec[i] = NULL;}}
-		continue; /* move to next field */
-	    }
+done:
+    return stat;
+}
 
-	    /* optimize: fixed length compound base type */
-            if((stat = nc4_find_type(file,field->nc_typeid,&basetype))) goto done;
-	    if(!basetype->varsized) {
-		memcpy(fdst.memory,fsrc.memory,arraycount*basetype->size);
-		continue; /* move to next field */
-	    }
+/* Copy count instances of a string, VLEN or variable sized compound
+   type. On failure, what was not copied is zeroed */
+static int
+copy_vector(NC_FILE_INFO_T* file, nc_type xtype, NC_TYPE_INFO_T* utype, const char* src, char* dst, size_t count)
+{
+    int stat = NC_NOERR;
+    size_t i, k, size = 0;
 
-	    /* Remaining case; field type is variable type */
-            for(i=0;i<arraycount;i++) {
-                if((stat = copy_datar(file, basetype, fsrc, fdst))) goto done;
-		fsrc.memory += basetype->size;
-		fdst.memory += basetype->size;
-            }
+    if(xtype == NC_STRING) {
+        const char* const* svec = (const char* const*)src;
+        char** dvec = (char**)dst;
+        size = sizeof(char*);
+        for(i=0;i<count;i++) {
+            if(svec[i] == NULL)
+                dvec[i] = NULL;
+            else if((dvec[i] = strdup(svec[i])) == NULL)
+                {stat = NC_ENOMEM; i++; goto fail;}
         }
-	goto done;
-
-    } else {stat = NC_EBADTYPE; goto done;}
+    } else if(utype->nc_type_class == NC_VLEN) {
+        const nc_vlen_t* svec = (const nc_vlen_t*)src;
+        nc_vlen_t* dvec = (nc_vlen_t*)dst;
+        size = sizeof(nc_vlen_t);
+        for(i=0;i<count;i++)
+            if((stat = copy_vlen(file,utype,&svec[i],&dvec[i]))) {i++; goto fail;}
+    } else if(utype->nc_type_class == NC_COMPOUND) {
+        /* Copy it all, then make the pointer members point to copies */
+        size = utype->size;
+        if((stat = compound_layout(file,utype))) {i = 0; goto fail;}
+        memcpy(dst,src,count*size);
+        for(i=0;i<count;i++)
+            for(k=0;k<utype->nptrs;k++) {
+                const NC_PTR_MEMBER* m = &utype->ptrs[k];
+                size_t off = i*size + m->offset;
+                if((stat = copy_vector(file,m->nc_typeid,m->type,src+off,dst+off,m->count))) {
+                    /* The members after this one still point into src */
+                    off += m->count * member_size(m);
+                    memset(dst+off,0,count*size-off);
+                    goto done;
+                }
+            }
+    } else
+        stat = NC_EBADTYPE;
+    goto done;
 
+fail:
+    memset(dst+i*size,0,(count-i)*size);
 done:
     return stat;
 }
@@ -26,14 +26,14 @@ NCDISPATCH_inq_var_all(int ncid, int varid, char *name, nc_type *xtypep,
    NC* ncp;
    int stat = NC_check_id(ncid,&ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->inq_var_all(
+   return NC_LOCKED(ncp,ncp->dispatch->inq_var_all(
       ncid, varid, name, xtypep,
       ndimsp, dimidsp, nattsp,
       shufflep, deflatep, deflate_levelp, fletcher32p,
       contiguousp, chunksizesp,
       no_fill, fill_valuep,
       endiannessp,
-      idp, nparamsp, params);
+      idp, nparamsp, params));
 }
 
 int
@@ -42,7 +42,7 @@ NCDISPATCH_get_att(int ncid, int varid, const char* name, void* value, nc_type t
    NC* ncp;
    int stat = NC_check_id(ncid,&ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->get_att(ncid,varid,name,value,t);
+   return NC_LOCKED(ncp,ncp->dispatch->get_att(ncid,varid,name,value,t));
 }
 
 /*! \} */  /* End of named group ...*/
@@ -0,0 +1,113 @@
+/* Copyright 2018, UCAR/Unidata and OPeNDAP, Inc.
+   See the COPYRIGHT file for more information. */
+/**
+ * @file
+ * @internal
+ *
+ * The locks of the thread-safe build; see nclock.h for the rules.
+ */
+
+#include "config.h"
+#include <stdlib.h>
+
+#ifdef ENABLE_THREADSAFE
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#include "netcdf.h"
+#include "ncdispatch.h"
+#include "ncthreads.h"
+#include "nclock.h"
+
+static NCmutex* globallock = NULL;
+static NCmutex* librarylock = NULL;
+
+/* The two static locks are created on first use */
+static void
+createlocks(void)
+{
+    if(ncmutex_new(&globallock) != NC_NOERR
+       || ncmutex_new(&librarylock) != NC_NOERR)
+	abort(); /* nothing sensible can be done without them */
+}
+
+#ifdef _WIN32
+static INIT_ONCE lockonce = INIT_ONCE_STATIC_INIT;
+static BOOL CALLBACK
+createlocks_once(PINIT_ONCE once, PVOID param, PVOID* ctx)
+{
+    createlocks();
+    return TRUE;
+}
+#define INITLOCKS() InitOnceExecuteOnce(&lockonce,createlocks_once,NULL,NULL)
+#else
+static pthread_once_t lockonce = PTHREAD_ONCE_INIT;
+#define INITLOCKS() pthread_once(&lockonce,createlocks)
+#endif
+
+void
+NC_lock_global(void)
+{
+    INITLOCKS();
+    ncmutex_lock(globallock);
+}
+
+void
+NC_unlock_global(void)
+{
+    ncmutex_unlock(globallock);
+}
+
+void
+NC_lock_library(void)
+{
+    INITLOCKS();
+    ncmutex_lock(librarylock);
+}
+
+void
+NC_unlock_library(void)
+{
+    ncmutex_unlock(librarylock);
+}
+
+int
+NC_lock_new(NC* ncp)
+{
+    /* Only the classic formats keep all their state in the NC */
+    if(ncp->dispatch == NULL || ncp->dispatch->model != NC_FORMATX_NC3)
+	return NC_NOERR;
+    return ncmutex_new(&ncp->lock);
+}
+
+void
+NC_lock_free(NC* ncp)
+{
+    ncmutex_free(ncp->lock);
+    ncp->lock = NULL;
+}
+
+void
+NC_lock(NC* ncp)
+{
+    if(ncp->lock != NULL)
+	ncmutex_lock(ncp->lock);
+    else
+	NC_lock_library();
+}
+
+int
+NC_unlock(NC* ncp, int stat)
+{
+    if(ncp->lock != NULL)
+	ncmutex_unlock(ncp->lock);
+    else
+	NC_unlock_library();
+    return stat;
+}
+
+#endif /*ENABLE_THREADSAFE*/
@@ -35,7 +35,7 @@ nc_def_opaque(int ncid, size_t size, const char *name, nc_type *xtypep)
     NC* ncp;
     int stat = NC_check_id(ncid,&ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->def_opaque(ncid,size,name,xtypep);
+    return NC_LOCKED(ncp,ncp->dispatch->def_opaque(ncid,size,name,xtypep));
 }
 
 /** \ingroup user_types
@@ -392,7 +392,7 @@ nc_var_par_access(int ncid, int varid, int par_access)
     if ((stat = NC_check_id(ncid, &ncp)))
        return stat;
 
-    return ncp->dispatch->var_par_access(ncid,varid,par_access);
+    return NC_LOCKED(ncp,ncp->dispatch->var_par_access(ncid,varid,par_access));
 #endif
 }
 
@@ -47,7 +47,8 @@ static int NC_plugin_path_initialized = 0;
 static int NC_plugin_path_verify = 1;
 
 /**
- * This function is called as part of nc_initialize.
+ * This function is called when HDF5 is started (NC_HDF5_startup())
+ * or the plugin path is first used.
  * Its purpose is to initialize the plugin paths state.
  *
  * @return NC_NOERR
@@ -66,6 +67,7 @@ nc_plugin_path_initialize(void)
 #endif
 
     if(!NC_initialized) nc_initialize();
+    NCLOCKLIBRARY();
     if(NC_plugin_path_initialized != 0) goto done;
     NC_plugin_path_initialized = 1;
 
@@ -113,6 +115,7 @@ nc_plugin_path_initialize(void)
     }
 done:
     ncaux_plugin_path_clear(&dirs);
+    NCUNLOCKLIBRARY();
     return NCTHROW(stat);
 }
 
@@ -131,6 +134,7 @@ nc_plugin_path_finalize(void)
     int stat = NC_NOERR;
     struct NCglobalstate* gs = NC_getglobalstate();
 
+    NCLOCKLIBRARY();
     if(NC_plugin_path_initialized == 0) goto done;
     NC_plugin_path_initialized = 0;
 
@@ -146,6 +150,7 @@ nc_plugin_path_finalize(void)
 
     nclistfreeall(gs->pluginpaths); gs->pluginpaths = NULL;
 done:
+    NCUNLOCKLIBRARY();
     return NCTHROW(stat);
 }
 
@@ -165,6 +170,8 @@ nc_plugin_path_ndirs(size_t* ndirsp)
     size_t ndirs = 0;
     struct NCglobalstate* gs = NC_getglobalstate();
 
+    if(!NC_plugin_path_initialized) nc_plugin_path_initialize();
+    NCLOCKLIBRARY();
     if(gs->pluginpaths == NULL) gs->pluginpaths = nclistnew(); /* suspenders and belt */
     ndirs = nclistlength(gs->pluginpaths);
 
@@ -187,6 +194,7 @@ nc_plugin_path_ndirs(size_t* ndirsp)
     }
     if(ndirsp) *ndirsp = ndirs;
 done:
+    NCUNLOCKLIBRARY();
     return NCTHROW(stat);
 }
 
@@ -212,6 +220,8 @@ nc_plugin_path_get(NCPluginList* dirs)
     struct NCglobalstate* gs = NC_getglobalstate();
     size_t i;
 
+    if(!NC_plugin_path_initialized) nc_plugin_path_initialize();
+    NCLOCKLIBRARY();
     if(gs->pluginpaths == NULL) gs->pluginpaths = nclistnew(); /* suspenders and belt */
     if(dirs == NULL) goto done;
     dirs->ndirs = nclistlength(gs->pluginpaths);
@@ -254,6 +264,7 @@ nc_plugin_path_get(NCPluginList* dirs)
 #endif /*NETCDF_ENABLE_NCZARR_FILTERS*/
     }
 done:
+    NCUNLOCKLIBRARY();
     return NCTHROW(stat);
 }
 
@@ -273,6 +284,8 @@ nc_plugin_path_set(NCPluginList* dirs)
     int stat = NC_NOERR;
     struct NCglobalstate* gs = NC_getglobalstate();
 
+    if(!NC_plugin_path_initialized) nc_plugin_path_initialize();
+    NCLOCKLIBRARY();
     if(dirs == NULL) {stat = NC_EINVAL; goto done;}
 
     /* Clear the current dir list */
@@ -296,6 +309,7 @@ nc_plugin_path_set(NCPluginList* dirs)
 #endif
 
 done:
+    NCUNLOCKLIBRARY();
     return NCTHROW(stat);
 }
 
@@ -86,10 +86,13 @@ nc_rc_get(const char* key)
 
     ncg = NC_getglobalstate();
     assert(ncg != NULL && ncg->rcinfo != NULL && ncg->rcinfo->entries != NULL);
+    /* Copy the value before another thread can replace it */
+    NCLOCKGLOBAL();
     if(ncg->rcinfo->ignore) goto done;
     value = NC_rclookup(key,NULL,NULL);
 done:
     value = nulldup(value);   
+    NCUNLOCKGLOBAL();
     return value;
 }
 
@@ -112,7 +115,7 @@ nc_rc_set(const char* key, const char* value)
 
     ncg = NC_getglobalstate();
     assert(ncg != NULL && ncg->rcinfo != NULL && ncg->rcinfo->entries != NULL);
-    if(ncg->rcinfo->ignore) goto done;;
+    if(ncg->rcinfo->ignore) goto done;
     stat = NC_rcfile_insert(key,NULL,NULL,value);
 done:
     return stat;
@@ -132,12 +135,16 @@ For debugging support, it is possible
 to change where the code looks for the .aws directory.
 This is set by the environment variable NC_TEST_AWS_DIR.
 
+Not called by nc_initialize(): the functions that read the tables
+call it the first time, so programs that never look anything up
+never read the files.
 */
 
 void
 ncrc_initialize(void)
 {
-    if(NCRCinitialized) return;
+    NCLOCKGLOBAL();
+    if(NCRCinitialized) {NCUNLOCKGLOBAL(); return;}
     NCRCinitialized = 1; /* prevent recursion */
 
 #ifndef NOREAD
@@ -154,6 +161,7 @@ ncrc_initialize(void)
     }
     }
 #endif
+    NCUNLOCKGLOBAL();
 }
 
 static void
@@ -271,6 +279,9 @@ done:
 /**
  * Locate a entry by property key.
  * If duplicate keys, first takes precedence.
+ * The value is owned by the .rc tables and nc_rc_set() may free it:
+ * in the thread-safe build, callers hold NCLOCKGLOBAL() for as long
+ * as they use it, or copy it under the lock.
  * @param key to lookup
  * @param hostport to use for lookup
  * @param urlpath to use for lookup
@@ -281,7 +292,9 @@ NC_rclookup(const char* key, const char* hostport, const char* urlpath)
 {
     struct NCRCentry* entry = NULL;
     if(!NCRCinitialized) ncrc_initialize();
+    NCLOCKGLOBAL();
     entry = rclocate(key,hostport,urlpath);
+    NCUNLOCKGLOBAL();
     return (entry == NULL ? NULL : entry->value);
 }
 
@@ -679,6 +692,7 @@ NC_rcfile_insert(const char* key, const char* hostport, const char* urlpath, con
 
     if(!NCRCinitialized) ncrc_initialize();
 
+    NCLOCKGLOBAL();
     if(key == NULL || value == NULL)
         {ret = NC_EINVAL; goto done;}
 
@@ -710,6 +724,7 @@ NC_rcfile_insert(const char* key, const char* hostport, const char* urlpath, con
     storedump("NC_rcfile_insert",rc);
 #endif    
 done:
+    NCUNLOCKGLOBAL();
     return ret;
 }
 
@@ -717,6 +732,7 @@ done:
 size_t
 NC_rcfile_length(NCRCinfo* info)
 {
+    if(!NCRCinitialized) ncrc_initialize();
     return nclistlength(info->entries);
 }
 
@@ -724,6 +740,7 @@ NC_rcfile_length(NCRCinfo* info)
 NCRCentry*
 NC_rcfile_ith(NCRCinfo* info, size_t i)
 {
+    if(!NCRCinitialized) ncrc_initialize();
     if(i >= nclistlength(info->entries))
 	return NULL;
     return (NCRCentry*)nclistget(info->entries,i);
@@ -30,6 +30,7 @@
 #include "nclog.h"
 #include "ncs3sdk.h"
 #include "ncutil.h"
+#include "nclock.h"
 
 #undef AWSDEBUG
 
@@ -198,9 +199,12 @@ NC_s3urlrebuild(NCURI* url, NCS3INFO* s3, NCURI** newurlp)
 	region = nulldup(s3->region);
     if(region == NULL) {
         const char* region0 = NULL;
-	/* Get default region */
-	if((stat = NC_getdefaults3region(url,&region0))) goto done;
-	region = (char*)nulldup(region0);
+	/* Get default region; it may be an .rc value, see NC_rclookup() */
+	NCLOCKGLOBAL();
+	if((stat = NC_getdefaults3region(url,&region0)) == NC_NOERR)
+	    region = (char*)nulldup(region0);
+	NCUNLOCKGLOBAL();
+	if(stat) goto done;
     }
     if(region == NULL) {stat = NC_ES3; goto done;}
 
@@ -302,10 +306,14 @@ NC_s3urlprocess(NCURI* url, NCS3INFO* s3, NCURI** newurlp)
 
     if(url == NULL || s3 == NULL)
         {stat = NC_EURL; goto done;}
-    /* Get current profile */
-    if((stat = NC_getactives3profile(url,&profile0))) goto done;
-    if(profile0 == NULL) profile0 = "no";
-    s3->profile = strdup(profile0);
+    /* Get current profile; it may be an .rc value, see NC_rclookup() */
+    NCLOCKGLOBAL();
+    if((stat = NC_getactives3profile(url,&profile0)) == NC_NOERR) {
+        if(profile0 == NULL) profile0 = "no";
+        s3->profile = strdup(profile0);
+    }
+    NCUNLOCKGLOBAL();
+    if(stat) goto done;
 
     /* Rebuild the URL to path format and get a usable region and optional bucket*/
     if((stat = NC_s3urlrebuild(url,s3,&url2))) goto done;
@@ -613,6 +621,7 @@ NC_authgets3profile(const char* profilename, struct AWSprofile** profilep)
     int stat = NC_NOERR;
     NCglobalstate* gstate = NC_getglobalstate();
 
+    ncrc_initialize(); /* the profiles are read with the rc files */
     for(size_t i=0;i<nclistlength(gstate->rcinfo->s3profiles);i++) {
 	struct AWSprofile* profile = (struct AWSprofile*)nclistget(gstate->rcinfo->s3profiles,i);
 	if(strcmp(profilename,profile->name)==0)
@@ -688,6 +697,9 @@ Get the current active profile. The priority order is as follows:
 4. "default"
 5. "no" -- meaning do not use any profile => no secret key
 
+The profile may be an .rc value: in the thread-safe build, hold
+NCLOCKGLOBAL() while using it, see NC_rclookup().
+
 @param uri uri with mode flags, may be NULL
 @param profilep return profile name here or NULL if none found
 @return NC_NOERR if no error.
@@ -738,6 +750,8 @@ Get the current default region. The search order is as follows:
 3. aws_region key in current profile (only if profiles are being used)
 4. NCglobalstate.aws.default_region
 
+The region may be an .rc value, as for NC_getactives3profile().
+
 @param uri uri with mode flags, may be NULL
 @param regionp return region name here or NULL if none found
 @return NC_NOERR if no error.
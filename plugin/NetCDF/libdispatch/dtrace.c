@@ -0,0 +1,665 @@
+/* Copyright 2018, UCAR/Unidata and OPeNDAP, Inc.
+   See the COPYRIGHT file for more information. */
+/**
+ * @file
+ *
+ * Dispatch tracing: per function call counts, latency histograms and
+ * a ring buffer of the most recent calls; see nctrace.h.
+ */
+
+#include "config.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "ncdispatch.h"
+#include "ncutil.h"
+#include "nctrace.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#define NCTRACE_TLS __declspec(thread)
+#define ATOMIC_ADD(p,n) ((unsigned long long)_InterlockedExchangeAdd64((volatile __int64*)(p),(__int64)(n)))
+#define ATOMIC_LOAD(p) ((unsigned long long)_InterlockedOr64((volatile __int64*)(p),0))
+#define ATOMIC_STORE(p,v) ((void)_InterlockedExchange64((volatile __int64*)(p),(__int64)(v)))
+#else
+#define NCTRACE_TLS __thread
+#define ATOMIC_ADD(p,n) __atomic_fetch_add((p),(unsigned long long)(n),__ATOMIC_RELAXED)
+#define ATOMIC_LOAD(p) __atomic_load_n((p),__ATOMIC_ACQUIRE)
+#define ATOMIC_STORE(p,v) __atomic_store_n((p),(unsigned long long)(v),__ATOMIC_RELEASE)
+#endif
+
+/* Most dispatch tables ever wrapped: one per format in practice */
+#define NCTRACE_TABLES 32
+
+/* Totals of one dispatch function */
+typedef struct NCtracestats {
+    unsigned long long calls;
+    unsigned long long errors;
+    unsigned long long nsecs;
+    unsigned long long maxnsecs;
+    unsigned long long bytes;
+    unsigned long long hist[NCTRACE_BUCKETS];
+} NCtracestats;
+
+/* One call in the ring buffer */
+typedef struct NCtraceevent {
+    unsigned long long seq;   /* index+1 of the call, 0 while it is written */
+    unsigned long long start; /* ns since tracing was first switched on */
+    unsigned long long nsecs;
+    unsigned long long bytes;
+    int ncid;
+    int stat;
+    int func;
+    int thread;
+} NCtraceevent;
+
+static const char* funcnames[NCTRACE_NFUNCS] = {
+    "create", "open", "redef", "enddef",
+    "sync", "abort", "close", "set_fill",
+    "inq_format", "inq_format_extended", "inq",
+    "inq_type", "def_dim", "inq_dimid", "inq_dim",
+    "inq_unlimdim", "rename_dim", "inq_att",
+    "inq_attid", "inq_attname", "rename_att",
+    "del_att", "get_att", "put_att", "def_var",
+    "inq_varid", "rename_var", "get_vara",
+    "put_vara", "get_vars", "put_vars", "get_varm",
+    "put_varm", "inq_var_all", "var_par_access",
+    "def_var_fill", "show_metadata", "inq_unlimdims",
+    "inq_ncid", "inq_grps", "inq_grpname",
+    "inq_grpname_full", "inq_grp_parent",
+    "inq_grp_full_ncid", "inq_varids", "inq_dimids",
+    "inq_typeids", "inq_type_equal", "def_grp",
+    "rename_grp", "inq_user_type", "inq_typeid",
+    "def_compound", "insert_compound",
+    "insert_array_compound", "inq_compound_field",
+    "inq_compound_fieldindex", "def_vlen",
+    "put_vlen_element", "get_vlen_element", "def_enum",
+    "insert_enum", "inq_enum_member", "inq_enum_ident",
+    "def_opaque", "def_var_deflate", "def_var_fletcher32",
+    "def_var_chunking", "def_var_endian", "def_var_filter",
+    "set_var_chunk_cache", "get_var_chunk_cache",
+    "inq_var_filter_ids", "inq_var_filter_info",
+    "def_var_quantize", "inq_var_quantize",
+    "inq_filter_avail"
+};
+
+static int tracing = 0;
+static unsigned long long epoch = 0;
+static NCtracestats stats[NCTRACE_NFUNCS];
+static NCtraceevent* ring = NULL;
+static unsigned long long ringnext = 0;
+static unsigned long long nthreads = 0;
+static NCTRACE_TLS int threadid = 0;
+
+static struct NCtracetable {
+    const NC_Dispatch* inner;
+    NC_Dispatch table;
+} tables[NCTRACE_TABLES];
+static int ntables = 0;
+
+/* Set by NCDISPATCHTRACE */
+static char* envpath = NULL;
+static int envformat = NC_TRACE_JSON;
+
+/**************************************************/
+/* Recording */
+
+int
+NC_trace_on(void)
+{
+#ifdef _MSC_VER
+    return *(volatile int*)&tracing;
+#else
+    return __atomic_load_n(&tracing,__ATOMIC_RELAXED);
+#endif
+}
+
+static int
+bucket(unsigned long long ns)
+{
+    int b = 0;
+    while(ns > 1 && b < NCTRACE_BUCKETS-1) {ns >>= 1; b++;}
+    return b;
+}
+
+static void
+setmax(unsigned long long* p, unsigned long long v)
+{
+#ifdef _MSC_VER
+    __int64 old = *(volatile __int64*)p;
+    while((unsigned long long)old < v) {
+	__int64 seen = _InterlockedCompareExchange64((volatile __int64*)p,(__int64)v,old);
+	if(seen == old) break;
+	old = seen;
+    }
+#else
+    unsigned long long old = __atomic_load_n(p,__ATOMIC_RELAXED);
+    while(old < v
+          && !__atomic_compare_exchange_n(p,&old,v,1,__ATOMIC_RELAXED,__ATOMIC_RELAXED))
+	;
+#endif
+}
+
+void
+NC_trace_record(int func, int ncid, unsigned long long t0,
+                unsigned long long bytes, int stat)
+{
+    unsigned long long ns = NC_nanotime() - t0;
+    NCtracestats* s = &stats[func];
+    NCtraceevent* e;
+    unsigned long long idx;
+
+    ATOMIC_ADD(&s->calls,1);
+    if(stat != NC_NOERR) ATOMIC_ADD(&s->errors,1);
+    ATOMIC_ADD(&s->nsecs,ns);
+    ATOMIC_ADD(&s->bytes,bytes);
+    ATOMIC_ADD(&s->hist[bucket(ns)],1);
+    setmax(&s->maxnsecs,ns);
+
+    if(ring == NULL) return;
+    if(threadid == 0)
+	threadid = (int)ATOMIC_ADD(&nthreads,1) + 1;
+    idx = ATOMIC_ADD(&ringnext,1);
+    e = &ring[idx & (NCTRACE_RING-1)];
+    ATOMIC_STORE(&e->seq,0);
+    e->start = t0 - epoch;
+    e->nsecs = ns;
+    e->bytes = bytes;
+    e->ncid = ncid;
+    e->stat = stat;
+    e->func = func;
+    e->thread = threadid;
+    ATOMIC_STORE(&e->seq,idx+1);
+}
+
+/* Size of one value of type, or 0 if unknown */
+static size_t
+typesize(const NC_Dispatch* d, int ncid, nc_type type)
+{
+    size_t size = 0;
+    if(type > NC_NAT && type <= NC_MAX_ATOMIC_TYPE)
+	return NC_atomictypelen(type);
+    if(d->inq_type(ncid,type,NULL,&size) != NC_NOERR)
+	return 0;
+    return size;
+}
+
+/* Bytes moved by a get/put of count values of varid */
+static unsigned long long
+varbytes(const NC_Dispatch* d, int ncid, int varid, const size_t* count, nc_type memtype)
+{
+    nc_type xtype = NC_NAT;
+    int i, ndims = 0;
+    unsigned long long n;
+
+    if(count == NULL
+       || d->inq_var_all(ncid,varid,NULL,&xtype,&ndims,NULL,NULL,NULL,NULL,NULL,
+                         NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL) != NC_NOERR)
+	return 0;
+    n = typesize(d,ncid,(memtype == NC_NAT ? xtype : memtype));
+    for(i=0;i<ndims;i++)
+	n *= count[i];
+    return n;
+}
+
+/**************************************************/
+/* The wrappers */
+
+#define TRACECALL(fn,params,args) \
+static int \
+trace_##fn params \
+{ \
+    NC* ncp; \
+    unsigned long long t0; \
+    int stat = NC_check_id(ncid,&ncp); \
+    if(stat != NC_NOERR) return stat; \
+    if(!NC_trace_on()) return ncp->traced->fn args; \
+    t0 = NC_nanotime(); \
+    stat = ncp->traced->fn args; \
+    NC_trace_record(NCTRACE_##fn,ncid,t0,0,stat); \
+    return stat; \
+}
+
+TRACECALL(redef,(int ncid),(ncid))
+TRACECALL(_enddef,(int ncid, size_t a, size_t b, size_t c, size_t d),(ncid,a,b,c,d))
+TRACECALL(sync,(int ncid),(ncid))
+TRACECALL(abort,(int ncid),(ncid))
+TRACECALL(close,(int ncid, void* a),(ncid,a))
+TRACECALL(set_fill,(int ncid, int a, int* b),(ncid,a,b))
+TRACECALL(inq_format,(int ncid, int* a),(ncid,a))
+TRACECALL(inq_format_extended,(int ncid, int* a, int* b),(ncid,a,b))
+TRACECALL(inq,(int ncid, int* a, int* b, int* c, int* d),(ncid,a,b,c,d))
+TRACECALL(inq_type,(int ncid, nc_type a, char* b, size_t* c),(ncid,a,b,c))
+TRACECALL(def_dim,(int ncid, const char* a, size_t b, int* c),(ncid,a,b,c))
+TRACECALL(inq_dimid,(int ncid, const char* a, int* b),(ncid,a,b))
+TRACECALL(inq_dim,(int ncid, int a, char* b, size_t* c),(ncid,a,b,c))
+TRACECALL(inq_unlimdim,(int ncid, int* a),(ncid,a))
+TRACECALL(rename_dim,(int ncid, int a, const char* b),(ncid,a,b))
+TRACECALL(inq_att,(int ncid, int a, const char* b, nc_type* c, size_t* d),(ncid,a,b,c,d))
+TRACECALL(inq_attid,(int ncid, int a, const char* b, int* c),(ncid,a,b,c))
+TRACECALL(inq_attname,(int ncid, int a, int b, char* c),(ncid,a,b,c))
+TRACECALL(rename_att,(int ncid, int a, const char* b, const char* c),(ncid,a,b,c))
+TRACECALL(del_att,(int ncid, int a, const char* b),(ncid,a,b))
+TRACECALL(def_var,(int ncid, const char* a, nc_type b, int c, const int* d, int* e),(ncid,a,b,c,d,e))
+TRACECALL(inq_varid,(int ncid, const char* a, int* b),(ncid,a,b))
+TRACECALL(rename_var,(int ncid, int a, const char* b),(ncid,a,b))
+TRACECALL(inq_var_all,(int ncid, int a, char* b, nc_type* c, int* d, int* e, int* f,
+                   int* g, int* h, int* i, int* j, int* k, size_t* l, int* m,
+                   void* n, int* o, unsigned int* p, size_t* q, unsigned int* r),
+      (ncid,a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r))
+TRACECALL(var_par_access,(int ncid, int a, int b),(ncid,a,b))
+TRACECALL(def_var_fill,(int ncid, int a, int b, const void* c),(ncid,a,b,c))
+TRACECALL(show_metadata,(int ncid),(ncid))
+TRACECALL(inq_unlimdims,(int ncid, int* a, int* b),(ncid,a,b))
+TRACECALL(inq_ncid,(int ncid, const char* a, int* b),(ncid,a,b))
+TRACECALL(inq_grps,(int ncid, int* a, int* b),(ncid,a,b))
+TRACECALL(inq_grpname,(int ncid, char* a),(ncid,a))
+TRACECALL(inq_grpname_full,(int ncid, size_t* a, char* b),(ncid,a,b))
+TRACECALL(inq_grp_parent,(int ncid, int* a),(ncid,a))
+TRACECALL(inq_grp_full_ncid,(int ncid, const char* a, int* b),(ncid,a,b))
+TRACECALL(inq_varids,(int ncid, int* a, int* b),(ncid,a,b))
+TRACECALL(inq_dimids,(int ncid, int* a, int* b, int c),(ncid,a,b,c))
+TRACECALL(inq_typeids,(int ncid, int* a, int* b),(ncid,a,b))
+TRACECALL(inq_type_equal,(int ncid, nc_type a, int b, nc_type c, int* d),(ncid,a,b,c,d))
+TRACECALL(def_grp,(int ncid, const char* a, int* b),(ncid,a,b))
+TRACECALL(rename_grp,(int ncid, const char* a),(ncid,a))
+TRACECALL(inq_user_type,(int ncid, nc_type a, char* b, size_t* c, nc_type* d, size_t* e, int* f),
+      (ncid,a,b,c,d,e,f))
+TRACECALL(inq_typeid,(int ncid, const char* a, nc_type* b),(ncid,a,b))
+TRACECALL(def_compound,(int ncid, size_t a, const char* b, nc_type* c),(ncid,a,b,c))
+TRACECALL(insert_compound,(int ncid, nc_type a, const char* b, size_t c, nc_type d),(ncid,a,b,c,d))
+TRACECALL(insert_array_compound,(int ncid, nc_type a, const char* b, size_t c, nc_type d,
+                             int e, const int* f),(ncid,a,b,c,d,e,f))
+TRACECALL(inq_compound_field,(int ncid, nc_type a, int b, char* c, size_t* d, nc_type* e,
+                          int* f, int* g),(ncid,a,b,c,d,e,f,g))
+TRACECALL(inq_compound_fieldindex,(int ncid, nc_type a, const char* b, int* c),(ncid,a,b,c))
+TRACECALL(def_vlen,(int ncid, const char* a, nc_type b, nc_type* c),(ncid,a,b,c))
+TRACECALL(put_vlen_element,(int ncid, int a, void* b, size_t c, const void* d),(ncid,a,b,c,d))
+TRACECALL(get_vlen_element,(int ncid, int a, const void* b, size_t* c, void* d),(ncid,a,b,c,d))
+TRACECALL(def_enum,(int ncid, nc_type a, const char* b, nc_type* c),(ncid,a,b,c))
+TRACECALL(insert_enum,(int ncid, nc_type a, const char* b, const void* c),(ncid,a,b,c))
+TRACECALL(inq_enum_member,(int ncid, nc_type a, int b, char* c, void* d),(ncid,a,b,c,d))
+TRACECALL(inq_enum_ident,(int ncid, nc_type a, long long b, char* c),(ncid,a,b,c))
+TRACECALL(def_opaque,(int ncid, size_t a, const char* b, nc_type* c),(ncid,a,b,c))
+TRACECALL(def_var_deflate,(int ncid, int a, int b, int c, int d),(ncid,a,b,c,d))
+TRACECALL(def_var_fletcher32,(int ncid, int a, int b),(ncid,a,b))
+TRACECALL(def_var_chunking,(int ncid, int a, int b, const size_t* c),(ncid,a,b,c))
+TRACECALL(def_var_endian,(int ncid, int a, int b),(ncid,a,b))
+TRACECALL(def_var_filter,(int ncid, int a, unsigned int b, size_t c, const unsigned int* d),(ncid,a,b,c,d))
+TRACECALL(set_var_chunk_cache,(int ncid, int a, size_t b, size_t c, float d),(ncid,a,b,c,d))
+TRACECALL(get_var_chunk_cache,(int ncid, int a, size_t* b, size_t* c, float* d),(ncid,a,b,c,d))
+TRACECALL(inq_var_filter_ids,(int ncid, int a, size_t* b, unsigned int* c),(ncid,a,b,c))
+TRACECALL(inq_var_filter_info,(int ncid, int a, unsigned int b, size_t* c, unsigned int* d),(ncid,a,b,c,d))
+TRACECALL(def_var_quantize,(int ncid, int a, int b, int c),(ncid,a,b,c))
+TRACECALL(inq_var_quantize,(int ncid, int a, int* b, int* c),(ncid,a,b,c))
+TRACECALL(inq_filter_avail,(int ncid, unsigned a),(ncid,a))
+
+/* Same, also counting the bytes of data moved */
+#define TRACEDATA(fn,params,args,count,memtype) \
+static int \
+trace_##fn params \
+{ \
+    NC* ncp; \
+    unsigned long long t0, bytes = 0; \
+    int stat = NC_check_id(ncid,&ncp); \
+    if(stat != NC_NOERR) return stat; \
+    if(!NC_trace_on()) return ncp->traced->fn args; \
+    t0 = NC_nanotime(); \
+    stat = ncp->traced->fn args; \
+    if(stat == NC_NOERR) \
+	bytes = varbytes(ncp->traced,ncid,varid,count,memtype); \
+    NC_trace_record(NCTRACE_##fn,ncid,t0,bytes,stat); \
+    return stat; \
+}
+
+TRACEDATA(get_vara,(int ncid, int varid, const size_t* a, const size_t* b, void* c, nc_type d),
+          (ncid,varid,a,b,c,d),b,d)
+TRACEDATA(put_vara,(int ncid, int varid, const size_t* a, const size_t* b, const void* c, nc_type d),
+          (ncid,varid,a,b,c,d),b,d)
+TRACEDATA(get_vars,(int ncid, int varid, const size_t* a, const size_t* b, const ptrdiff_t* c,
+                    void* d, nc_type e),(ncid,varid,a,b,c,d,e),b,e)
+TRACEDATA(put_vars,(int ncid, int varid, const size_t* a, const size_t* b, const ptrdiff_t* c,
+                    const void* d, nc_type e),(ncid,varid,a,b,c,d,e),b,e)
+TRACEDATA(get_varm,(int ncid, int varid, const size_t* a, const size_t* b, const ptrdiff_t* c,
+                    const ptrdiff_t* d, void* e, nc_type f),(ncid,varid,a,b,c,d,e,f),b,f)
+TRACEDATA(put_varm,(int ncid, int varid, const size_t* a, const size_t* b, const ptrdiff_t* c,
+                    const ptrdiff_t* d, const void* e, nc_type f),(ncid,varid,a,b,c,d,e,f),b,f)
+
+static int
+trace_get_att(int ncid, int varid, const char* name, void* value, nc_type memtype)
+{
+    NC* ncp;
+    unsigned long long t0, bytes = 0;
+    nc_type xtype;
+    size_t len;
+    int stat = NC_check_id(ncid,&ncp);
+    if(stat != NC_NOERR) return stat;
+    if(!NC_trace_on()) return ncp->traced->get_att(ncid,varid,name,value,memtype);
+    t0 = NC_nanotime();
+    stat = ncp->traced->get_att(ncid,varid,name,value,memtype);
+    if(stat == NC_NOERR
+       && ncp->traced->inq_att(ncid,varid,name,&xtype,&len) == NC_NOERR)
+	bytes = len * typesize(ncp->traced,ncid,(memtype == NC_NAT ? xtype : memtype));
+    NC_trace_record(NCTRACE_get_att,ncid,t0,bytes,stat);
+    return stat;
+}
+
+static int
+trace_put_att(int ncid, int varid, const char* name, nc_type xtype, size_t len,
+              const void* value, nc_type memtype)
+{
+    NC* ncp;
+    unsigned long long t0, bytes = 0;
+    int stat = NC_check_id(ncid,&ncp);
+    if(stat != NC_NOERR) return stat;
+    if(!NC_trace_on()) return ncp->traced->put_att(ncid,varid,name,xtype,len,value,memtype);
+    t0 = NC_nanotime();
+    stat = ncp->traced->put_att(ncid,varid,name,xtype,len,value,memtype);
+    if(stat == NC_NOERR)
+	bytes = len * typesize(ncp->traced,ncid,(memtype == NC_NAT ? xtype : memtype));
+    NC_trace_record(NCTRACE_put_att,ncid,t0,bytes,stat);
+    return stat;
+}
+
+/* Wrap every entry that inner implements */
+#define WRAP(fn) if(inner->fn != NULL) t->fn = trace_##fn
+
+static void
+buildtable(NC_Dispatch* t, const NC_Dispatch* inner)
+{
+    *t = *inner; /* model, version, create and open stay */
+    WRAP(redef); WRAP(_enddef); WRAP(sync); WRAP(abort); WRAP(close);
+    WRAP(set_fill); WRAP(inq_format); WRAP(inq_format_extended); WRAP(inq);
+    WRAP(inq_type); WRAP(def_dim); WRAP(inq_dimid); WRAP(inq_dim);
+    WRAP(inq_unlimdim); WRAP(rename_dim); WRAP(inq_att); WRAP(inq_attid);
+    WRAP(inq_attname); WRAP(rename_att); WRAP(del_att); WRAP(get_att);
+    WRAP(put_att); WRAP(def_var); WRAP(inq_varid); WRAP(rename_var);
+    WRAP(get_vara); WRAP(put_vara); WRAP(get_vars); WRAP(put_vars);
+    WRAP(get_varm); WRAP(put_varm); WRAP(inq_var_all); WRAP(var_par_access);
+    WRAP(def_var_fill); WRAP(show_metadata); WRAP(inq_unlimdims);
+    WRAP(inq_ncid); WRAP(inq_grps); WRAP(inq_grpname); WRAP(inq_grpname_full);
+    WRAP(inq_grp_parent); WRAP(inq_grp_full_ncid); WRAP(inq_varids);
+    WRAP(inq_dimids); WRAP(inq_typeids); WRAP(inq_type_equal); WRAP(def_grp);
+    WRAP(rename_grp); WRAP(inq_user_type); WRAP(inq_typeid);
+    WRAP(def_compound); WRAP(insert_compound); WRAP(insert_array_compound);
+    WRAP(inq_compound_field); WRAP(inq_compound_fieldindex); WRAP(def_vlen);
+    WRAP(put_vlen_element); WRAP(get_vlen_element); WRAP(def_enum);
+    WRAP(insert_enum); WRAP(inq_enum_member); WRAP(inq_enum_ident);
+    WRAP(def_opaque); WRAP(def_var_deflate); WRAP(def_var_fletcher32);
+    WRAP(def_var_chunking); WRAP(def_var_endian); WRAP(def_var_filter);
+    WRAP(set_var_chunk_cache); WRAP(get_var_chunk_cache);
+    WRAP(inq_var_filter_ids); WRAP(inq_var_filter_info);
+    WRAP(def_var_quantize); WRAP(inq_var_quantize); WRAP(inq_filter_avail);
+}
+
+void
+NC_trace_install(NC* ncp)
+{
+    const NC_Dispatch* inner = ncp->dispatch;
+    int i;
+
+    if(ncp->traced != NULL) return;
+    NCLOCKGLOBAL();
+    for(i=0;i<ntables;i++)
+	if(tables[i].inner == inner) break;
+    if(i == ntables && ntables < NCTRACE_TABLES) {
+	tables[i].inner = inner;
+	buildtable(&tables[i].table,inner);
+	ntables++;
+    }
+    if(i < ntables) {
+	ncp->traced = inner;
+	ncp->dispatch = &tables[i].table;
+    }
+    NCUNLOCKGLOBAL();
+}
+
+/**************************************************/
+/* Output */
+
+/* Upper bound in ns of the histogram bucket holding quantile q */
+static unsigned long long
+quantile(const NCtracestats* s, double q)
+{
+    unsigned long long want = (unsigned long long)(q * (double)s->calls + 0.5), seen = 0;
+    int b;
+    if(want == 0) want = 1;
+    for(b=0;b<NCTRACE_BUCKETS;b++) {
+	seen += s->hist[b];
+	if(seen >= want) break;
+    }
+    if(b >= NCTRACE_BUCKETS-1) return s->maxnsecs;
+    return ((2ULL << b) - 1 < s->maxnsecs ? (2ULL << b) - 1 : s->maxnsecs);
+}
+
+static const NCtracestats* sortstats = NULL;
+
+static int
+bytime(const void* a, const void* b)
+{
+    unsigned long long ta = sortstats[*(const int*)a].nsecs;
+    unsigned long long tb = sortstats[*(const int*)b].nsecs;
+    return (ta < tb ? 1 : (ta > tb ? -1 : 0));
+}
+
+static void
+dumpjson(FILE* f, const NCtracestats* snap)
+{
+    int order[NCTRACE_NFUNCS];
+    int i, b, first = 1;
+    unsigned long long total = 0, n = ATOMIC_LOAD(&ringnext);
+
+    for(i=0;i<NCTRACE_NFUNCS;i++) {
+	order[i] = i;
+	total += snap[i].calls;
+    }
+    sortstats = snap;
+    qsort(order,NCTRACE_NFUNCS,sizeof(int),bytime);
+    fprintf(f,"{\n\"calls\": %llu,\n\"ring_size\": %d,\n\"ring_calls\": %llu,\n\"functions\": [",
+            total,NCTRACE_RING,(n < NCTRACE_RING ? n : (unsigned long long)NCTRACE_RING));
+    for(i=0;i<NCTRACE_NFUNCS;i++) {
+	const NCtracestats* s = &snap[order[i]];
+	int firstb = 1;
+	if(s->calls == 0) continue;
+	fprintf(f,"%s\n{\"name\": \"%s\", \"calls\": %llu, \"errors\": %llu, \"total_ns\": %llu, "
+	          "\"mean_ns\": %llu, \"max_ns\": %llu, \"p50_ns\": %llu, \"p90_ns\": %llu, "
+	          "\"p99_ns\": %llu, \"bytes\": %llu, \"histogram\": [",
+	        (first ? "" : ","),funcnames[order[i]],s->calls,s->errors,s->nsecs,
+	        s->nsecs / s->calls,s->maxnsecs,quantile(s,0.5),quantile(s,0.9),
+	        quantile(s,0.99),s->bytes);
+	for(b=0;b<NCTRACE_BUCKETS;b++) {
+	    if(s->hist[b] == 0) continue;
+	    fprintf(f,"%s[%llu, %llu]",(firstb ? "" : ", "),(b == 0 ? 0ULL : 1ULL << b),s->hist[b]);
+	    firstb = 0;
+	}
+	fprintf(f,"]}");
+	first = 0;
+    }
+    fprintf(f,"\n]\n}\n");
+}
+
+static void
+dumpchrome(FILE* f)
+{
+    unsigned long long n = ATOMIC_LOAD(&ringnext);
+    unsigned long long i = (n > NCTRACE_RING ? n - NCTRACE_RING : 0);
+    int first = 1;
+
+    fprintf(f,"{\"displayTimeUnit\": \"ns\", \"traceEvents\": [");
+    for(;i<n;i++) {
+	NCtraceevent* e = &ring[i & (NCTRACE_RING-1)];
+	NCtraceevent copy;
+	if(ATOMIC_LOAD(&e->seq) != i+1) continue; /* being written, or overwritten */
+	copy = *e;
+	if(ATOMIC_LOAD(&e->seq) != i+1) continue;
+	fprintf(f,"%s\n{\"name\": \"%s\", \"cat\": \"netcdf\", \"ph\": \"X\", \"pid\": 1, "
+	          "\"tid\": %d, \"ts\": %.3f, \"dur\": %.3f, "
+	          "\"args\": {\"ncid\": %d, \"bytes\": %llu, \"status\": %d}}",
+	        (first ? "" : ","),funcnames[copy.func],copy.thread,
+	        (double)copy.start / 1000.0,(double)copy.nsecs / 1000.0,
+	        copy.ncid,copy.bytes,copy.stat);
+	first = 0;
+    }
+    fprintf(f,"\n]}\n");
+}
+
+static void
+dumpatexit(void)
+{
+    if(envpath != NULL)
+	(void)nc_dump_dispatch_trace(envpath,envformat);
+}
+
+int
+NC_trace_initialize(void)
+{
+    static int initialized = 0;
+    const char* path = getenv(NCENVDISPATCHTRACE);
+    const char* format = getenv(NCENVDISPATCHTRACEFORMAT);
+
+    if(initialized || path == NULL || *path == '\0')
+	return NC_NOERR;
+    initialized = 1;
+    if((envpath = strdup(path)) == NULL)
+	return NC_ENOMEM;
+    if(format != NULL && strcmp(format,"chrome") == 0)
+	envformat = NC_TRACE_CHROME;
+    if(atexit(dumpatexit))
+	fprintf(stderr,"atexit failed\n");
+    return nc_set_dispatch_trace(1);
+}
+
+/**************************************************/
+/* Public API */
+
+/** \ingroup datasets
+Switch dispatch tracing on or off.
+
+While tracing is on, every call made on the files opened or created
+from then on is counted and timed: the library keeps, for each
+function of the dispatch table, the number of calls and errors, the
+total and maximum latency, a latency histogram and the bytes of data
+moved, plus the last 65536 calls. Files opened before tracing was
+switched on are not traced. Tracing can also be switched on by
+setting the NCDISPATCHTRACE environment variable to the path of the
+file that nc_dump_dispatch_trace() writes at exit, in the format
+named by NCDISPATCHTRACEFORMAT ("json", the default, or "chrome").
+
+\param on Non-zero to switch tracing on, zero to switch it off.
+
+\returns ::NC_NOERR No error.
+\returns ::NC_ENOMEM Out of memory.
+*/
+int
+nc_set_dispatch_trace(int on)
+{
+    int stat = NC_NOERR;
+    NCLOCKGLOBAL();
+    if(on && ring == NULL) {
+	if((ring = (NCtraceevent*)calloc(NCTRACE_RING,sizeof(NCtraceevent))) == NULL)
+	    stat = NC_ENOMEM;
+	else
+	    epoch = NC_nanotime();
+    }
+    if(stat == NC_NOERR) {
+#ifdef _MSC_VER
+	*(volatile int*)&tracing = (on != 0);
+#else
+	__atomic_store_n(&tracing,(on != 0),__ATOMIC_RELEASE);
+#endif
+    }
+    NCUNLOCKGLOBAL();
+    return stat;
+}
+
+/** \ingroup datasets
+Tell whether dispatch tracing is on.
+
+\param onp Pointer that gets 1 if tracing is on, 0 if not.
+
+\returns ::NC_NOERR No error.
+\returns ::NC_EINVAL onp is NULL.
+*/
+int
+nc_get_dispatch_trace(int *onp)
+{
+    if(onp == NULL) return NC_EINVAL;
+    *onp = NC_trace_on();
+    return NC_NOERR;
+}
+
+/** \ingroup datasets
+Clear the counters and the recorded calls of dispatch tracing. Calls
+running in other threads at the same time may be partly counted.
+
+\returns ::NC_NOERR No error.
+*/
+int
+nc_reset_dispatch_trace(void)
+{
+    NCLOCKGLOBAL();
+    memset(stats,0,sizeof(stats));
+    if(ring != NULL)
+	memset(ring,0,NCTRACE_RING * sizeof(NCtraceevent));
+    ATOMIC_STORE(&ringnext,0);
+    NCUNLOCKGLOBAL();
+    return NC_NOERR;
+}
+
+/** \ingroup datasets
+Write the dispatch trace.
+
+With ::NC_TRACE_JSON the output is a JSON object with, for every
+function called, the number of calls and errors, the total, mean and
+maximum latency, the 50th, 90th and 99th percentiles, the bytes moved
+and the latency histogram as [lower bound in ns, calls] pairs.
+Functions are sorted by total time. The percentiles are the upper
+bounds of the histogram buckets that hold them.
+
+With ::NC_TRACE_CHROME the output holds the most recent calls in the
+Chrome trace event format, to be loaded in chrome://tracing or
+Perfetto.
+
+\param path File to write, or NULL for stdout.
+\param format ::NC_TRACE_JSON or ::NC_TRACE_CHROME.
+
+\returns ::NC_NOERR No error.
+\returns ::NC_EINVAL Unknown format.
+\returns ::NC_EPERM Cannot open path.
+*/
+int
+nc_dump_dispatch_trace(const char *path, int format)
+{
+    NCtracestats* snap = NULL;
+    FILE* f = stdout;
+    int i, b;
+
+    if(format != NC_TRACE_JSON && format != NC_TRACE_CHROME)
+	return NC_EINVAL;
+    if(path != NULL && (f = fopen(path,"w")) == NULL)
+	return NC_EPERM;
+    if(format == NC_TRACE_JSON) {
+	if((snap = (NCtracestats*)calloc(NCTRACE_NFUNCS,sizeof(NCtracestats))) == NULL) {
+	    if(f != stdout) fclose(f);
+	    return NC_ENOMEM;
+	}
+	for(i=0;i<NCTRACE_NFUNCS;i++) {
+	    snap[i].calls = ATOMIC_LOAD(&stats[i].calls);
+	    snap[i].errors = ATOMIC_LOAD(&stats[i].errors);
+	    snap[i].nsecs = ATOMIC_LOAD(&stats[i].nsecs);
+	    snap[i].maxnsecs = ATOMIC_LOAD(&stats[i].maxnsecs);
+	    snap[i].bytes = ATOMIC_LOAD(&stats[i].bytes);
+	    for(b=0;b<NCTRACE_BUCKETS;b++)
+		snap[i].hist[b] = ATOMIC_LOAD(&stats[i].hist[b]);
+	}
+	dumpjson(f,snap);
+	free(snap);
+    } else if(ring != NULL)
+	dumpchrome(f);
+    else
+	fprintf(f,"{\"displayTimeUnit\": \"ns\", \"traceEvents\": []}\n");
+    if(f != stdout) fclose(f);
+    else fflush(f);
+    return NC_NOERR;
+}
@@ -72,7 +72,7 @@ nc_inq_type_equal(int ncid1, nc_type typeid1, int ncid2,
     NC* ncp1;
     int stat = NC_check_id(ncid1,&ncp1);
     if(stat != NC_NOERR) return stat;
-    return ncp1->dispatch->inq_type_equal(ncid1,typeid1,ncid2,typeid2,equal);
+    return NC_LOCKED(ncp1,ncp1->dispatch->inq_type_equal(ncid1,typeid1,ncid2,typeid2,equal));
 }
 
 /** \name Learning about User-Defined Types
@@ -104,7 +104,7 @@ nc_inq_typeid(int ncid, const char *name, nc_type *typeidp)
     NC* ncp;
     int stat = NC_check_id(ncid,&ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->inq_typeid(ncid,name,typeidp);
+    return NC_LOCKED(ncp,ncp->dispatch->inq_typeid(ncid,name,typeidp));
 }
 
 /** \ingroup user_types
@@ -149,8 +149,8 @@ nc_inq_user_type(int ncid, nc_type xtype, char *name, size_t *size,
     NC *ncp;
     int stat = NC_check_id(ncid,&ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->inq_user_type(ncid, xtype, name, size,
-					base_nc_typep, nfieldsp, classp);
+    return NC_LOCKED(ncp,ncp->dispatch->inq_user_type(ncid, xtype, name, size,
+					base_nc_typep, nfieldsp, classp));
 }
 /*! \} */  /* End of named group ...*/
 
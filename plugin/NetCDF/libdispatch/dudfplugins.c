@@ -17,6 +17,7 @@
 #include "netcdf_dispatch.h"
 #include "nclog.h"
 #include "ncrc.h"
+#include "ncdispatch.h"
 #include "ncudfplugins.h"
 
 /* Platform-specific dynamic loading headers */
@@ -232,27 +233,33 @@ done:
  * @author Edward Hartnett
  * @date 2/2/26
  */
-int
-NC_udf_load_plugins(void)
+static int
+udf_load_plugins(void)
 {
     int stat = NC_NOERR;
     
     /* Loop through all 10 UDF slots */
     for (int i = 0; i < NC_MAX_UDF_FORMATS; i++) {
         char key_lib[64], key_init[64], key_magic[64];
-        const char* lib = NULL;
-        const char* init = NULL;
-        const char* magic = NULL;
+        char* lib = NULL;
+        char* init = NULL;
+        char* magic = NULL;
         
         /* Build RC key names for this UDF slot */
         snprintf(key_lib, sizeof(key_lib), "NETCDF.UDF%d.LIBRARY", i);
         snprintf(key_init, sizeof(key_init), "NETCDF.UDF%d.INIT", i);
         snprintf(key_magic, sizeof(key_magic), "NETCDF.UDF%d.MAGIC", i);
         
-        /* Look up RC values */
+        /* Look up RC values. They are copied, as loading the plugin
+           takes other locks, see NC_rclookup() */
+        NCLOCKGLOBAL();
         lib = NC_rclookup(key_lib, NULL, NULL);
         init = NC_rclookup(key_init, NULL, NULL);
         magic = NC_rclookup(key_magic, NULL, NULL);
+        lib = nulldup(lib);
+        init = nulldup(init);
+        magic = nulldup(magic);
+        NCUNLOCKGLOBAL();
         
         /* If both LIBRARY and INIT are present, try to load the plugin */
         if (lib && init) {
@@ -265,8 +272,28 @@ NC_udf_load_plugins(void)
                   "(both NETCDF.UDF%d.LIBRARY and NETCDF.UDF%d.INIT are required)",
                   i, i, i);
         }
+        nullfree(lib);
+        nullfree(init);
+        nullfree(magic);
     }
     
     /* Always return success - plugin loading failures are not fatal */
     return NC_NOERR;
 }
+
+static int udf_plugins_once = NC_ONCE_INIT;
+
+/**
+ * Load the UDF plugins configured in the RC files, the first time
+ * it is called. Called before a file is opened or created, as the
+ * plugins may claim files by their magic number, and before the
+ * user formats are defined or inquired by the program.
+ *
+ * @return NC_NOERR (always succeeds, even if plugins fail to load).
+ */
+int
+NC_udf_load_plugins(void)
+{
+    if(!NC_initialized) nc_initialize();
+    return NC_once(&udf_plugins_once,udf_load_plugins);
+}
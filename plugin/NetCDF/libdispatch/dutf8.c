@@ -16,6 +16,25 @@
 
 /* Provide a wrapper around whatever utf8 library we use. */
 
+/*
+ * Names are nearly always ASCII. Test 8 bytes at a time; the loop has
+ * no branch on the data, so compilers vectorize it.
+ */
+int
+nc_utf8_isascii(const unsigned char* str, size_t len)
+{
+    unsigned long long acc = 0;
+    size_t i = 0;
+    for(;i + 8 <= len;i += 8) {
+	unsigned long long w;
+	memcpy(&w, str + i, 8);
+	acc |= w;
+    }
+    for(;i < len;i++)
+	acc |= str[i];
+    return (acc & 0x8080808080808080ULL) == 0;
+}
+
 /*
  * Check validity of a UTF8 encoded null-terminated byte string.
  * Return codes:
@@ -33,6 +52,8 @@ int nc_utf8_validate(const unsigned char* name)
     nc_utf8proc_int32_t codepoint;
     nc_utf8proc_ssize_t count;
 
+    if(nc_utf8_isascii(name, strlen((const char*)name)))
+	return NC_NOERR;
     str = (const nc_utf8proc_uint8_t*)name;
     while(*str) {
         count = nc_utf8proc_iterate(str,nchars,&codepoint);
@@ -78,6 +99,15 @@ nc_utf8_normalize(const unsigned char* utf8, unsigned char** normalp)
     const nc_utf8proc_uint8_t* str = (const nc_utf8proc_uint8_t*)utf8;
     nc_utf8proc_uint8_t* retval = NULL;
     nc_utf8proc_ssize_t count;
+    size_t len = strlen((const char*)utf8);
+    if(nc_utf8_isascii(utf8, len)) {
+	/* Its own NFC form; just copy it */
+	if((retval = (nc_utf8proc_uint8_t*)malloc(len + 1)) == NULL)
+	    return NC_ENOMEM;
+	memcpy(retval, utf8, len + 1);
+	if(normalp) *normalp = (unsigned char*)retval; else free(retval);
+	return NC_NOERR;
+    }
     count = nc_utf8proc_map(str, 0, &retval, UTF8PROC_NULLTERM | UTF8PROC_STABLE | UTF8PROC_COMPOSE);
     if(count < 0) {/* error */
 	switch (count) {
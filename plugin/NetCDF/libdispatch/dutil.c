@@ -22,6 +22,11 @@
 #ifdef _MSC_VER
 #include <io.h>
 #endif
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
 #include "netcdf.h"
 #include "ncuri.h"
 #include "ncbytes.h"
@@ -641,3 +646,22 @@ NC_freeenvv(size_t n, char** envv)
     free(envv);    
 }
 
+/**
+Monotonic clock in nanoseconds, for timing; the origin is arbitrary.
+*/
+unsigned long long
+NC_nanotime(void)
+{
+#ifdef _WIN32
+    static LARGE_INTEGER freq;
+    LARGE_INTEGER t;
+    if(freq.QuadPart == 0) QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&t);
+    return (unsigned long long)(t.QuadPart / freq.QuadPart) * 1000000000ULL
+           + (unsigned long long)(t.QuadPart % freq.QuadPart) * 1000000000ULL / (unsigned long long)freq.QuadPart;
+#else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC,&t);
+    return (unsigned long long)t.tv_sec * 1000000000ULL + (unsigned long long)t.tv_nsec;
+#endif
+}
@@ -222,8 +222,8 @@ nc_def_var(int ncid, const char *name, nc_type xtype,
     if ((stat = NC_check_id(ncid, &ncp)))
         return stat;
     TRACE(nc_def_var);
-    return ncp->dispatch->def_var(ncid, name, xtype, ndims,
-                                  dimidsp, varidp);
+    return NC_LOCKED(ncp,ncp->dispatch->def_var(ncid, name, xtype, ndims,
+                                  dimidsp, varidp));
 }
 
 /**
@@ -320,7 +320,7 @@ nc_def_var_fill(int ncid, int varid, int no_fill, const void *fill_value)
      * fill_value argument. */
     if (varid == NC_GLOBAL) return NC_EGLOBAL;
 
-    return ncp->dispatch->def_var_fill(ncid,varid,no_fill,fill_value);
+    return NC_LOCKED(ncp,ncp->dispatch->def_var_fill(ncid,varid,no_fill,fill_value));
 }
 
 /**
@@ -465,7 +465,7 @@ nc_def_var_deflate(int ncid, int varid, int shuffle, int deflate, int deflate_le
     NC* ncp;
     int stat = NC_check_id(ncid,&ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->def_var_deflate(ncid,varid,shuffle,deflate,deflate_level);
+    return NC_LOCKED(ncp,ncp->dispatch->def_var_deflate(ncid,varid,shuffle,deflate,deflate_level));
 }
 
 /**
@@ -568,7 +568,7 @@ nc_def_var_quantize(int ncid, int varid, int quantize_mode, int nsd)
 
     /* Using NC_GLOBAL is illegal. */
     if (varid == NC_GLOBAL) return NC_EGLOBAL;
-    return ncp->dispatch->def_var_quantize(ncid,varid,quantize_mode,nsd);
+    return NC_LOCKED(ncp,ncp->dispatch->def_var_quantize(ncid,varid,quantize_mode,nsd));
 }
 
 /**
@@ -614,7 +614,7 @@ nc_def_var_fletcher32(int ncid, int varid, int fletcher32)
     NC* ncp;
     int stat = NC_check_id(ncid,&ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->def_var_fletcher32(ncid,varid,fletcher32);
+    return NC_LOCKED(ncp,ncp->dispatch->def_var_fletcher32(ncid,varid,fletcher32));
 }
 
 /**
@@ -734,8 +734,8 @@ nc_def_var_chunking(int ncid, int varid, int storage, const size_t *chunksizesp)
     NC* ncp;
     int stat = NC_check_id(ncid, &ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->def_var_chunking(ncid, varid, storage,
-                                           chunksizesp);
+    return NC_LOCKED(ncp,ncp->dispatch->def_var_chunking(ncid, varid, storage,
+                                           chunksizesp));
 }
 
 /**
@@ -812,7 +812,7 @@ nc_def_var_endian(int ncid, int varid, int endian)
     NC* ncp;
     int stat = NC_check_id(ncid,&ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->def_var_endian(ncid,varid,endian);
+    return NC_LOCKED(ncp,ncp->dispatch->def_var_endian(ncid,varid,endian));
 }
 
 /**
@@ -951,7 +951,7 @@ nc_rename_var(int ncid, int varid, const char *name)
     int stat = NC_check_id(ncid, &ncp);
     if(stat != NC_NOERR) return stat;
     TRACE(nc_rename_var);
-    return ncp->dispatch->rename_var(ncid, varid, name);
+    return NC_LOCKED(ncp,ncp->dispatch->rename_var(ncid, varid, name));
 }
 /** @} */
 
@@ -1401,8 +1401,8 @@ nc_set_var_chunk_cache(int ncid, int varid, size_t size, size_t nelems,
     NC* ncp;
     int stat = NC_check_id(ncid, &ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->set_var_chunk_cache(ncid, varid, size,
-                                              nelems, preemption);
+    return NC_LOCKED(ncp,ncp->dispatch->set_var_chunk_cache(ncid, varid, size,
+                                              nelems, preemption));
 }
 
 /**
@@ -1442,8 +1442,8 @@ nc_get_var_chunk_cache(int ncid, int varid, size_t *sizep, size_t *nelemsp,
     NC* ncp;
     int stat = NC_check_id(ncid, &ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->get_var_chunk_cache(ncid, varid, sizep,
-                                              nelemsp, preemptionp);
+    return NC_LOCKED(ncp,ncp->dispatch->get_var_chunk_cache(ncid, varid, sizep,
+                                              nelemsp, preemptionp));
 }
 
 #ifndef USE_NETCDF4
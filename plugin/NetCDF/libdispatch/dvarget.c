@@ -101,7 +101,7 @@ NC_get_vara(int ncid, int varid,
       stat = NC_check_nulls(ncid, varid, start, &my_count, NULL);
       if(stat != NC_NOERR) return stat;
    }
-   stat =  ncp->dispatch->get_vara(ncid,varid,start,my_count,value,memtype);
+   stat =  NC_LOCKED_READ(ncp,ncp->dispatch->get_vara(ncid,varid,start,my_count,value,memtype));
    if(edges == NULL) free(my_count);
    return stat;
 }
@@ -591,8 +591,8 @@ NC_get_vars(int ncid, int varid, const size_t *start,
       if(stat != NC_NOERR) return stat;
    }
 
-   stat = ncp->dispatch->get_vars(ncid,varid,start,my_count,my_stride,
-                                  value,memtype);
+   stat = NC_LOCKED_READ(ncp,ncp->dispatch->get_vars(ncid,varid,start,my_count,my_stride,
+                                  value,memtype));
    if(edges == NULL) free(my_count);
    if(stride == NULL) free(my_stride);
    return stat;
@@ -653,8 +653,8 @@ NC_get_varm(int ncid, int varid, const size_t *start,
       if(stat != NC_NOERR) return stat;
    }
 
-   stat = ncp->dispatch->get_varm(ncid, varid, start, my_count, my_stride,
-                                  map, value, memtype);
+   stat = NC_LOCKED_READ(ncp,ncp->dispatch->get_varm(ncid, varid, start, my_count, my_stride,
+                                  map, value, memtype));
    if(edges == NULL) free(my_count);
    if(stride == NULL) free(my_stride);
    return stat;
@@ -62,7 +62,7 @@ nc_inq_varid(int ncid, const char *name, int *varidp)
    NC* ncp;
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
-   return ncp->dispatch->inq_varid(ncid, name, varidp);
+   return NC_LOCKED(ncp,ncp->dispatch->inq_varid(ncid, name, varidp));
 }
 
 /**
@@ -128,10 +128,10 @@ nc_inq_var(int ncid, int varid, char *name, nc_type *xtypep,
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
    TRACE(nc_inq_var);
-   return ncp->dispatch->inq_var_all(ncid, varid, name, xtypep, ndimsp,
+   return NC_LOCKED(ncp,ncp->dispatch->inq_var_all(ncid, varid, name, xtypep, ndimsp,
 				     dimidsp, nattsp, NULL, NULL, NULL,
 				     NULL, NULL, NULL, NULL, NULL, NULL,
-				     NULL,NULL,NULL);
+				     NULL,NULL,NULL));
 }
 
 /**
@@ -334,7 +334,7 @@ nc_inq_var_deflate(int ncid, int varid, int *shufflep, int *deflatep, int *defla
    /* also get the shuffle state */
    if(!shufflep)
        return NC_NOERR;
-   return ncp->dispatch->inq_var_all(
+   return NC_LOCKED(ncp,ncp->dispatch->inq_var_all(
       ncid, varid,
       NULL, /*name*/
       NULL, /*xtypep*/
@@ -351,7 +351,7 @@ nc_inq_var_deflate(int ncid, int varid, int *shufflep, int *deflatep, int *defla
       NULL, /*fillvaluep*/
       NULL, /*endianp*/
       NULL, NULL, NULL
-      );
+      ));
 }
 
 /** \ingroup variables
@@ -381,7 +381,7 @@ nc_inq_var_fletcher32(int ncid, int varid, int *fletcher32p)
    int stat = NC_check_id(ncid,&ncp);
    if(stat != NC_NOERR) return stat;
    TRACE(nc_inq_var_fletcher32);
-   return ncp->dispatch->inq_var_all(
+   return NC_LOCKED(ncp,ncp->dispatch->inq_var_all(
       ncid, varid,
       NULL, /*name*/
       NULL, /*xtypep*/
@@ -398,7 +398,7 @@ nc_inq_var_fletcher32(int ncid, int varid, int *fletcher32p)
       NULL, /*fillvaluep*/
       NULL, /*endianp*/
       NULL, NULL, NULL
-      );
+      ));
 }
 
 /**
@@ -469,10 +469,10 @@ nc_inq_var_chunking(int ncid, int varid, int *storagep, size_t *chunksizesp)
    int stat = NC_check_id(ncid, &ncp);
    if(stat != NC_NOERR) return stat;
    TRACE(nc_inq_var_chunking);
-   return ncp->dispatch->inq_var_all(ncid, varid, NULL, NULL, NULL, NULL,
+   return NC_LOCKED(ncp,ncp->dispatch->inq_var_all(ncid, varid, NULL, NULL, NULL, NULL,
 				     NULL, NULL, NULL, NULL, NULL, storagep,
 				     chunksizesp, NULL, NULL, NULL,
-                                     NULL, NULL, NULL);
+                                     NULL, NULL, NULL));
 }
 
 /** \ingroup variables
@@ -507,7 +507,7 @@ nc_inq_var_fill(int ncid, int varid, int *no_fill, void *fill_valuep)
    if(stat != NC_NOERR) return stat;
    TRACE(nc_inq_var_fill);
 
-   return ncp->dispatch->inq_var_all(
+   return NC_LOCKED(ncp,ncp->dispatch->inq_var_all(
       ncid,varid,
       NULL, /*name*/
       NULL, /*xtypep*/
@@ -524,7 +524,7 @@ nc_inq_var_fill(int ncid, int varid, int *no_fill, void *fill_valuep)
       fill_valuep, /*fillvaluep*/
       NULL, /*endianp*/
       NULL, NULL, NULL
-      );
+      ));
 }
 
 /** @ingroup variables
@@ -554,8 +554,8 @@ nc_inq_var_quantize(int ncid, int varid, int *quantize_modep, int *nsdp)
    /* Using NC_GLOBAL is illegal. */
    if (varid == NC_GLOBAL) return NC_EGLOBAL;
 
-   return ncp->dispatch->inq_var_quantize(ncid, varid,
-					  quantize_modep, nsdp);
+   return NC_LOCKED(ncp,ncp->dispatch->inq_var_quantize(ncid, varid,
+					  quantize_modep, nsdp));
 }
 
 /** \ingroup variables
@@ -586,7 +586,7 @@ nc_inq_var_endian(int ncid, int varid, int *endianp)
    int stat = NC_check_id(ncid,&ncp);
    if(stat != NC_NOERR) return stat;
    TRACE(nc_inq_var_endian);
-   return ncp->dispatch->inq_var_all(
+   return NC_LOCKED(ncp,ncp->dispatch->inq_var_all(
       ncid, varid,
       NULL, /*name*/
       NULL, /*xtypep*/
@@ -602,7 +602,7 @@ nc_inq_var_endian(int ncid, int varid, int *endianp)
       NULL, /*nofillp*/
       NULL, /*fillvaluep*/
       endianp, /*endianp*/
-      NULL, NULL, NULL);
+      NULL, NULL, NULL));
 }
 
 /**
@@ -679,8 +679,8 @@ nc_inq_unlimdims(int ncid, int *nunlimdimsp, int *unlimdimidsp)
     int stat = NC_check_id(ncid,&ncp);
     if(stat != NC_NOERR) return stat;
     TRACE(nc_inq_unlimdims);
-    return ncp->dispatch->inq_unlimdims(ncid, nunlimdimsp,
-					unlimdimidsp);
+    return NC_LOCKED(ncp,ncp->dispatch->inq_unlimdims(ncid, nunlimdimsp,
+					unlimdimidsp));
 #endif
 }
 
@@ -94,7 +94,7 @@ NC_put_vara(int ncid, int varid, const size_t *start,
       stat = NC_check_nulls(ncid, varid, start, &my_count, NULL);
       if(stat != NC_NOERR) return stat;
    }
-   stat = ncp->dispatch->put_vara(ncid, varid, start, my_count, value, memtype);
+   stat = NC_LOCKED(ncp,ncp->dispatch->put_vara(ncid, varid, start, my_count, value, memtype));
    if(edges == NULL) free(my_count);
    return stat;
 }
@@ -545,8 +545,8 @@ NC_put_vars(int ncid, int varid, const size_t *start,
       if(stat != NC_NOERR) return stat;
    }
 
-   stat = ncp->dispatch->put_vars(ncid, varid, start, my_count, my_stride,
-                                  value, memtype);
+   stat = NC_LOCKED(ncp,ncp->dispatch->put_vars(ncid, varid, start, my_count, my_stride,
+                                  value, memtype));
    if(edges == NULL) free(my_count);
    if(stride == NULL) free(my_stride);
    return stat;
@@ -574,8 +574,8 @@ NC_put_varm(int ncid, int varid, const size_t *start,
       if(stat != NC_NOERR) return stat;
    }
 
-   stat = ncp->dispatch->put_varm(ncid, varid, start, my_count, my_stride,
-                                  map, value, memtype);
+   stat = NC_LOCKED(ncp,ncp->dispatch->put_varm(ncid, varid, start, my_count, my_stride,
+                                  map, value, memtype));
    if(edges == NULL) free(my_count);
    if(stride == NULL) free(my_stride);
    return stat;
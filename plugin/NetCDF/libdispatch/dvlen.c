@@ -94,7 +94,7 @@ nc_def_vlen(int ncid, const char *name, nc_type base_typeid, nc_type *xtypep)
     NC* ncp;
     int stat = NC_check_id(ncid,&ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->def_vlen(ncid,name,base_typeid,xtypep);
+    return NC_LOCKED(ncp,ncp->dispatch->def_vlen(ncid,name,base_typeid,xtypep));
 }
 
 /** \ingroup user_types
@@ -152,7 +152,7 @@ nc_put_vlen_element(int ncid, int typeid1, void *vlen_element, size_t len, const
     NC* ncp;
     int stat = NC_check_id(ncid,&ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->put_vlen_element(ncid,typeid1,vlen_element,len,data);
+    return NC_LOCKED(ncp,ncp->dispatch->put_vlen_element(ncid,typeid1,vlen_element,len,data));
 }
 
 /** 
@@ -181,6 +181,6 @@ nc_get_vlen_element(int ncid, int typeid1, const void *vlen_element,
     NC *ncp;
     int stat = NC_check_id(ncid,&ncp);
     if(stat != NC_NOERR) return stat;
-    return ncp->dispatch->get_vlen_element(ncid, typeid1, vlen_element, 
-					   len, data);
+    return NC_LOCKED(ncp,ncp->dispatch->get_vlen_element(ncid, typeid1, vlen_element, 
+					   len, data));
 }
@@ -63,6 +63,9 @@ free_NC(NC *ncp)
         return;
     if(ncp->path)
         free(ncp->path);
+#ifdef ENABLE_THREADSAFE
+    NC_lock_free(ncp);
+#endif
     /* We assume caller has already cleaned up ncp->dispatchdata */
     free(ncp);
 }
@@ -90,10 +93,17 @@ new_NC(const NC_Dispatch* dispatcher, const char* path, int mode, NC** ncpp)
     ncp->dispatch = dispatcher;
     ncp->path = nulldup(path);
     ncp->mode = mode;
+    ncp->fd = -1;
     if(ncp->path == NULL) { /* fail */
         free_NC(ncp);
         return NC_ENOMEM;
     }
+#ifdef ENABLE_THREADSAFE
+    if(NC_lock_new(ncp) != NC_NOERR) {
+        free_NC(ncp);
+        return NC_ENOMEM;
+    }
+#endif
     if(ncpp) {
         *ncpp = ncp;
     } else {
@@ -146,6 +146,8 @@ ncexhashnew(int leaflen)
     if(exhashnewleaf(map,&leaf[1])) goto done;
     exhashlinkleaf(map,leaf[0]);
     exhashlinkleaf(map,leaf[1]);
+    /* Each leaf is under one directory entry */
+    leaf[0]->depth = leaf[1]->depth = gdepth;
     /* Fill in vector */
     for(i=0;i<(1<<gdepth);i++) topvector[i] = (i & 0x1?leaf[1]:leaf[0]);
     topvector = NULL;
@@ -400,18 +402,23 @@ exhashsplit(NCexhashmap* map, ncexhashkey_t hkey, NCexleaf* leaf)
      fprintf(stderr,"split.split: newleaf=");ncexhashprintleaf(map,newleaf);
 #endif
 
-    /* Now walk the directory to locate all occurrences of old
-       leaf and replace with newleaf in those cases where the
-       directory index % 2 == 1 
+    /* The directory entries of a leaf are the 2^(map depth - old leaf
+       depth) consecutive ones that share its prefix, hkey's among them.
+       Their upper half, where the bit the leaf now adds to its depth is
+       1, goes to newleaf. (Testing i % 2 == 1 over the whole directory
+       was only right when both depths are equal.)
     */
-    for(i=0;i<(1<<map->depth);i++) {
-	if(map->directory[i] == leafptr) {
-	    if(i % 2 == 1) { /* entries should be newleaf */
+    {
+	int shift = map->depth - leaf->depth;
+	size_t half = (size_t)1 << shift;
+	size_t first = (size_t)(MSB(hkey,map->depth) >> (shift+1)) << (shift+1);
+	size_t j;
+	for(j=first+half;j<first+2*half;j++) {
+	    assert(map->directory[j] == leafptr);
 #if DEBUG >= 3
-		fprintf(stderr,"split.directory[%d]=%d (newleaf)\n",(int)i,newleaf->uid);
+	    fprintf(stderr,"split.directory[%d]=%d (newleaf)\n",(int)j,newleaf->uid);
 #endif
-	        map->directory[i] = newleaf;
-	    }
+	    map->directory[j] = newleaf;
 	}
     }
 
@@ -691,7 +698,7 @@ ncexhashinqmap(NCexhashmap* map, int* leaflenp, int* depthp, int* nactivep, int*
 ncexhashkey_t
 ncexhashkey(const unsigned char* key, size_t size)
 {
-    return NC_crc64(0,(unsigned char*)key,(unsigned int)size);
+    return NC_hash64(key,size);
 }
 
 /* Walk the entries in some order */
@@ -80,6 +80,14 @@ static size_t findPrimeGreaterThan(size_t val);
 extern void printhashmapstats(NC_hashmap* hm);
 extern void printhashmap(NC_hashmap* hm);
 
+/* Value of tags[] for an active entry of hashkey h; 0 and 1 mark
+   empty and deleted slots */
+#define TAG(h) ((h) < 2 ? (h) + 2 : (h))
+
+/* First slot to probe for hashkey h: h/2^32 scaled to the table size,
+   which avoids a division */
+#define HOME(hm,h) ((size_t)(((unsigned long long)(h) * (hm)->alloc) >> NCHASHKEYBITS))
+
 static int
 rehash(NC_hashmap* hm)
 {
@@ -88,22 +96,37 @@ rehash(NC_hashmap* hm)
     size_t active = hm->active;
 #endif
     NC_hentry* oldtable = hm->table;
+    nchashkey_t* oldtags = hm->tags;
+    size_t newalloc;
+    NC_hentry* table;
+    nchashkey_t* tags;
 
     Trace("rehash");
 
-    hm->alloc = findPrimeGreaterThan(alloc<<1);
-    if(hm->alloc == 0) return 0;
-    hm->table = (NC_hentry*)calloc(sizeof(NC_hentry), hm->alloc);
-    hm->active = 0;
-
+    newalloc = findPrimeGreaterThan(alloc<<1);
+    if(newalloc == 0) return 0;
+    table = (NC_hentry*)calloc(sizeof(NC_hentry), newalloc);
+    tags = (nchashkey_t*)calloc(sizeof(nchashkey_t), newalloc);
+    if(table == NULL || tags == NULL) {nullfree(table); nullfree(tags); return 0;}
+    hm->alloc = newalloc;
+    hm->table = table;
+    hm->tags = tags;
+
+    /* The keys are unique and there are no deleted slots, so each
+       entry just goes, with its key and hashkey, to the first empty
+       slot from its home */
     while(alloc > 0) {
         NC_hentry* h = &oldtable[--alloc];
         if(h->flags == ACTIVE) {
-            NC_hashmapadd(hm, h->data, h->key, h->keysize);
-	    if(h->key) free(h->key);
+	    size_t index = HOME(hm,h->hashkey);
+	    while(tags[index] != 0)
+		if(++index == newalloc) index = 0;
+	    table[index] = *h;
+	    tags[index] = TAG(h->hashkey);
         }
     }
     free(oldtable);
+    free(oldtags);
     ASSERT(active == hm->active);
     return 1;
 }
@@ -118,39 +141,39 @@ locate(NC_hashmap* hash, nchashkey_t hashkey, const char* key, size_t keysize, s
 {
     size_t i;
     size_t index;
-    size_t step = 1; /* simple linear probe */
     int deletefound = 0;
     size_t deletedindex = 0; /* first deleted entry encountered */
+    const nchashkey_t tag = TAG(hashkey);
+    const nchashkey_t* tags = hash->tags;
     NC_hentry* entry;
     Trace("locate");
     /* Compute starting point */
     assert(hash->alloc > 0);
-    index = (size_t)(hashkey % hash->alloc);
+    index = HOME(hash,hashkey);
 
     /* Search table using linear probing */
     for (i = 0; i < hash->alloc; i++) {
-      entry = &hash->table[index];
-      if(entry->flags & ACTIVE) {
-	    if(indexp) *indexp = index; /* assume a match */
-            if(entry->hashkey == hashkey && entry->keysize == keysize) {
-		/* Check content */
-		if(memcmp(entry->key,key,keysize)==0)
-		    return 1;
+      nchashkey_t t = tags[index];
+      if(t == tag) {
+	    entry = &hash->table[index];
+            if(entry->hashkey == hashkey && entry->keysize == keysize
+	       && memcmp(entry->key,key,keysize)==0) {
+		if(indexp) *indexp = index;
+		return 1;
             }
 	    /* Keep looking */
-	} else if(entry->flags & DELETED) {
+      } else if(t == 0) { /* Empty slot */
+	    if(indexp) *indexp = index;
+	    return 1;
+      } else if(t == 1) {
 	    if(!deletefound) {/* save this position */
 	        deletefound = 1;
 		deletedindex = index;
 	    }
 	    /* Keep looking */
- 	} else { /* Empty slot */
-	    if(indexp) *indexp = index;
-	    return 1;
-	}
-        /* linear probe */
-	assert(hash->alloc > 0);
-	index = (index + step) % hash->alloc;
+      }
+      /* linear probe */
+      if(++index == hash->alloc) index = 0;
     }
     if(deletedok && deletefound) {
 	if(indexp) *indexp = deletedindex;
@@ -160,11 +183,11 @@ locate(NC_hashmap* hash, nchashkey_t hashkey, const char* key, size_t keysize, s
 }
 
 /* Return the hash key for specified key; takes key+size*/
-/* Wrapper for crc64*/
 nchashkey_t
 NC_hashmapkey(const char* key, size_t size)
 {
-    return (nchashkey_t)NC_crc64(0,(void*)key,(unsigned int)size);
+    unsigned long long h = NC_hash64(key,size);
+    return (nchashkey_t)(h ^ (h >> 32));
 }
 
 NC_hashmap*
@@ -186,7 +209,8 @@ NC_hashmapnew(size_t startsize)
 	if(startsize == 0) {nullfree(hm); return 0;}
     }
     hm->table = (NC_hentry*)calloc(sizeof(NC_hentry), (size_t)startsize);
-    if(hm->table == NULL) {nullfree(hm);return 0;}
+    hm->tags = (nchashkey_t*)calloc(sizeof(nchashkey_t), (size_t)startsize);
+    if(hm->table == NULL || hm->tags == NULL) {nullfree(hm->table);nullfree(hm->tags);nullfree(hm);return 0;}
     hm->alloc = startsize;
     hm->active = 0;
     return hm;
@@ -218,15 +242,17 @@ NC_hashmapadd(NC_hashmap* hash, uintptr_t data, const char* key, size_t keysize)
 	    entry->data = data;
 	    return 1;
         } else { /* !ACTIVE || DELETED */
+	    char* copy = malloc(keysize+1);
+	    if(copy == NULL)
+		return 0;
+	    memcpy(copy,key,keysize);
+	    copy[keysize] = '\0'; /* ensure null terminated */
 	    entry->flags = ACTIVE;
 	    entry->data = data;
 	    entry->hashkey = hashkey;
 	    entry->keysize = keysize;
-	    entry->key = malloc(keysize+1);
-	    if(entry->key == NULL)
-		return 0;
-	    memcpy(entry->key,key,keysize);
-	    entry->key[keysize] = '\0'; /* ensure null terminated */
+	    entry->key = copy;
+	    hash->tags[index] = TAG(hashkey);
 	    ++hash->active;
 	    return 1;
 	}
@@ -252,6 +278,7 @@ NC_hashmapremove(NC_hashmap* hash, const char* key, size_t keysize, uintptr_t* d
     h = &hash->table[index];
     if(h->flags & ACTIVE) { /* matching entry found */
 	h->flags = DELETED; /* also turn off ACTIVE */
+	hash->tags[index] = 1;
 	if(h->key) free(h->key);
 	h->key = NULL;
 	h->keysize = 0;
@@ -350,6 +377,7 @@ NC_hashmapfree(NC_hashmap* hash)
 	   free(he->key);
       }
       free(hash->table);
+      free(hash->tags);
       free(hash);
     }
     return 1;
@@ -369,6 +397,7 @@ NC_hashmapdeactivate(NC_hashmap* map, uintptr_t data)
     for(h=map->table,i=0;i<map->alloc;i++,h++) {
 	if((h->flags & ACTIVE) && h->data == data) {
 	    h->flags = DELETED;
+	    map->tags[i] = 1;
 	    if(h->key) free(h->key);
  	    h->key = NULL;
 	    h->keysize = 0;
@@ -33,6 +33,9 @@ static NC** nc_filelist = NULL;
 /** The number of files currently open. */
 static int numfiles = 0;
 
+/* All of the functions below run under the global lock of the
+ * thread-safe build (see nclock.h). */
+
 /**
  * How many files are currently open?
  *
@@ -42,7 +45,11 @@ static int numfiles = 0;
 int
 count_NCList(void)
 {
-    return numfiles;
+    int n;
+    NCLOCKGLOBAL();
+    n = numfiles;
+    NCUNLOCKGLOBAL();
+    return n;
 }
 
 /**
@@ -54,9 +61,12 @@ count_NCList(void)
 void
 free_NCList(void)
 {
-    if(numfiles > 0) return; /* not empty */
-    if(nc_filelist != NULL) free(nc_filelist);
-    nc_filelist = NULL;
+    NCLOCKGLOBAL();
+    if(numfiles == 0) { /* else not empty */
+        if(nc_filelist != NULL) free(nc_filelist);
+        nc_filelist = NULL;
+    }
+    NCUNLOCKGLOBAL();
 }
 
 /**
@@ -81,11 +91,13 @@ free_NCList(void)
 int
 add_to_NCList(NC* ncp)
 {
+    int stat = NC_NOERR;
     unsigned int i;
     unsigned int new_id;
+    NCLOCKGLOBAL();
     if(nc_filelist == NULL) {
         if (!(nc_filelist = calloc(1, sizeof(NC*)*NCFILELISTLENGTH)))
-            return NC_ENOMEM;
+            {stat = NC_ENOMEM; goto done;}
         numfiles = 0;
     }
 
@@ -93,11 +105,13 @@ add_to_NCList(NC* ncp)
     for(i=1; i < NCFILELISTLENGTH; i++) {
         if(nc_filelist[i] == NULL) {new_id = i; break;}
     }
-    if(new_id == 0) return NC_ENOMEM; /* no more slots */
+    if(new_id == 0) {stat = NC_ENOMEM; goto done;} /* no more slots */
     nc_filelist[new_id] = ncp;
     numfiles++;
     ncp->ext_ncid = (int)(new_id << ID_SHIFT);
-    return NC_NOERR;
+done:
+    NCUNLOCKGLOBAL();
+    return stat;
 }
 
 /**
@@ -113,20 +127,23 @@ add_to_NCList(NC* ncp)
 int
 move_in_NCList(NC *ncp, int new_id)
 {
+    int stat = NC_NOERR;
+    NCLOCKGLOBAL();
     /* If no files in list, error. */
     if (!nc_filelist)
-        return NC_EINVAL;
+        {stat = NC_EINVAL; goto done;}
 
     /* If new slot is already taken, error. */
     if (nc_filelist[new_id])
-        return NC_EINVAL;
+        {stat = NC_EINVAL; goto done;}
 
     /* Move the file. */
     nc_filelist[ncp->ext_ncid >> ID_SHIFT] = NULL;
     nc_filelist[new_id] = ncp;
     ncp->ext_ncid = (new_id << ID_SHIFT);
-
-    return NC_NOERR;
+done:
+    NCUNLOCKGLOBAL();
+    return stat;
 }
 
 /**
@@ -145,8 +162,9 @@ void
 del_from_NCList(NC* ncp)
 {
     unsigned int ncid = ((unsigned int)ncp->ext_ncid) >> ID_SHIFT;
-    if(numfiles == 0 || ncid == 0 || nc_filelist == NULL) return;
-    if(nc_filelist[ncid] != ncp) return;
+    NCLOCKGLOBAL();
+    if(numfiles == 0 || ncid == 0 || nc_filelist == NULL) goto done;
+    if(nc_filelist[ncid] != ncp) goto done;
 
     nc_filelist[ncid] = NULL;
     numfiles--;
@@ -154,6 +172,8 @@ del_from_NCList(NC* ncp)
     /* If all files have been closed, release the filelist memory. */
     if (numfiles == 0)
         free_NCList();
+done:
+    NCUNLOCKGLOBAL();
 }
 
 /**
@@ -176,11 +196,13 @@ find_in_NCList(int ext_ncid)
 
     /* If we have a filelist, there will be an entry, possibly NULL,
      * for this ncid. */
+    NCLOCKGLOBAL();
     if (nc_filelist)
     {
         assert(numfiles);
         f = nc_filelist[ncid];
     }
+    NCUNLOCKGLOBAL();
 
     /* For classic files, ext_ncid must be a multiple of
      * (1<<ID_SHIFT). That is, the group part of the ext_ncid (the
@@ -207,9 +229,8 @@ find_in_NCList_by_name(const char* path)
 {
     int i;
     NC* f = NULL;
-    if(nc_filelist == NULL)
-        return NULL;
-    for(i=1; i < NCFILELISTLENGTH; i++) {
+    NCLOCKGLOBAL();
+    for(i=1; nc_filelist != NULL && i < NCFILELISTLENGTH; i++) {
         if(nc_filelist[i] != NULL) {
             if(strcmp(nc_filelist[i]->path,path)==0) {
                 f = nc_filelist[i];
@@ -217,6 +238,7 @@ find_in_NCList_by_name(const char* path)
             }
         }
     }
+    NCUNLOCKGLOBAL();
     return f;
 }
 
@@ -240,6 +262,8 @@ iterate_NCList(int index, NC** ncp)
     /* Walk from 0 ...; 0 return => stop */
     if(index < 0 || index >= NCFILELISTLENGTH)
         return NC_ERANGE;
-    if(ncp) *ncp = nc_filelist[index];
+    NCLOCKGLOBAL();
+    if(ncp) *ncp = (nc_filelist == NULL ? NULL : nc_filelist[index]);
+    NCUNLOCKGLOBAL();
     return NC_NOERR;
 }
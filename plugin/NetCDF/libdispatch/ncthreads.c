@@ -0,0 +1,329 @@
+/* Copyright 2018, UCAR/Unidata and OPeNDAP, Inc.
+   See the COPYRIGHT file for more information. */
+
+#include "config.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#include "netcdf.h"
+#include "ncthreads.h"
+
+/* Thin wrappers over the native primitives */
+#ifdef _WIN32
+typedef CRITICAL_SECTION NCTmutex;
+typedef CONDITION_VARIABLE NCTcond;
+typedef HANDLE NCTthread;
+#define NCT_mutex_init(m) (InitializeCriticalSection(m),0)
+#define NCT_mutex_destroy(m) DeleteCriticalSection(m)
+#define NCT_lock(m) EnterCriticalSection(m)
+#define NCT_unlock(m) LeaveCriticalSection(m)
+#define NCT_cond_init(c) (InitializeConditionVariable(c),0)
+#define NCT_cond_destroy(c)
+#define NCT_wait(c,m) SleepConditionVariableCS((c),(m),INFINITE)
+#define NCT_broadcast(c) WakeAllConditionVariable(c)
+#else
+typedef pthread_mutex_t NCTmutex;
+typedef pthread_cond_t NCTcond;
+typedef pthread_t NCTthread;
+#define NCT_mutex_init(m) pthread_mutex_init((m),NULL)
+#define NCT_mutex_destroy(m) pthread_mutex_destroy(m)
+#define NCT_lock(m) pthread_mutex_lock(m)
+#define NCT_unlock(m) pthread_mutex_unlock(m)
+#define NCT_cond_init(c) pthread_cond_init((c),NULL)
+#define NCT_cond_destroy(c) pthread_cond_destroy(c)
+#define NCT_wait(c,m) pthread_cond_wait((c),(m))
+#define NCT_broadcast(c) pthread_cond_broadcast(c)
+#endif
+
+struct NCthreadpool {
+    int nthreads;
+    int started;      /* number of workers actually running */
+    NCTthread* threads;
+    NCTmutex runlock; /* serializes callers of ncthreadpool_run */
+    NCTmutex lock;    /* protects everything below */
+    NCTcond wake;     /* signalled when a job is posted or on shutdown */
+    NCTcond done;     /* signalled when the last task of a job finishes */
+    int shutdown;
+    /* Current job */
+    NCtaskfcn fcn;
+    void* arg;
+    size_t ntasks;
+    size_t next;      /* next task to hand out */
+    size_t finished;  /* number of completed tasks */
+};
+
+/* Grab and run tasks of the current job until none are left;
+   called and returns with pool->lock held. */
+static void
+runtasks(NCthreadpool* pool)
+{
+    while(pool->next < pool->ntasks) {
+	size_t task = pool->next++;
+	NCtaskfcn fcn = pool->fcn;
+	void* arg = pool->arg;
+	NCT_unlock(&pool->lock);
+	fcn(arg,task);
+	NCT_lock(&pool->lock);
+	if(++pool->finished == pool->ntasks)
+	    NCT_broadcast(&pool->done);
+    }
+}
+
+#ifdef _WIN32
+static unsigned __stdcall
+worker(void* p)
+#else
+static void*
+worker(void* p)
+#endif
+{
+    NCthreadpool* pool = (NCthreadpool*)p;
+    NCT_lock(&pool->lock);
+    for(;;) {
+	while(!pool->shutdown && pool->next >= pool->ntasks)
+	    NCT_wait(&pool->wake,&pool->lock);
+	if(pool->shutdown) break;
+	runtasks(pool);
+    }
+    NCT_unlock(&pool->lock);
+    return 0;
+}
+
+int
+ncthreadpool_new(int nthreads, NCthreadpool** poolp)
+{
+    NCthreadpool* pool = NULL;
+    int i;
+
+    if(poolp == NULL || nthreads < 0) return NC_EINVAL;
+    if((pool = (NCthreadpool*)calloc(1,sizeof(NCthreadpool))) == NULL)
+	return NC_ENOMEM;
+    if(nthreads > 0
+       && (pool->threads = (NCTthread*)calloc((size_t)nthreads,sizeof(NCTthread))) == NULL) {
+	free(pool);
+	return NC_ENOMEM;
+    }
+    pool->nthreads = nthreads;
+    NCT_mutex_init(&pool->runlock);
+    NCT_mutex_init(&pool->lock);
+    NCT_cond_init(&pool->wake);
+    NCT_cond_init(&pool->done);
+    for(i=0;i<nthreads;i++) {
+#ifdef _WIN32
+	pool->threads[i] = (HANDLE)_beginthreadex(NULL,0,worker,pool,0,NULL);
+	if(pool->threads[i] == 0) break;
+#else
+	if(pthread_create(&pool->threads[i],NULL,worker,pool) != 0) break;
+#endif
+	pool->started++;
+    }
+    /* Running with fewer workers than asked for is not an error */
+    *poolp = pool;
+    return NC_NOERR;
+}
+
+void
+ncthreadpool_free(NCthreadpool* pool)
+{
+    int i;
+    if(pool == NULL) return;
+    NCT_lock(&pool->lock);
+    pool->shutdown = 1;
+    NCT_broadcast(&pool->wake);
+    NCT_unlock(&pool->lock);
+    for(i=0;i<pool->started;i++) {
+#ifdef _WIN32
+	WaitForSingleObject(pool->threads[i],INFINITE);
+	CloseHandle(pool->threads[i]);
+#else
+	pthread_join(pool->threads[i],NULL);
+#endif
+    }
+    NCT_cond_destroy(&pool->done);
+    NCT_cond_destroy(&pool->wake);
+    NCT_mutex_destroy(&pool->lock);
+    NCT_mutex_destroy(&pool->runlock);
+    free(pool->threads);
+    free(pool);
+}
+
+int
+ncthreadpool_size(const NCthreadpool* pool)
+{
+    return (pool == NULL ? 0 : pool->started);
+}
+
+int
+ncthreadpool_run(NCthreadpool* pool, size_t ntasks, NCtaskfcn fcn, void* arg)
+{
+    size_t i;
+
+    if(fcn == NULL) return NC_EINVAL;
+    if(ntasks == 0) return NC_NOERR;
+    if(pool == NULL || pool->started == 0 || ntasks == 1) {
+	for(i=0;i<ntasks;i++) fcn(arg,i);
+	return NC_NOERR;
+    }
+    NCT_lock(&pool->runlock);
+    NCT_lock(&pool->lock);
+    pool->fcn = fcn;
+    pool->arg = arg;
+    pool->finished = 0;
+    pool->next = 0;
+    pool->ntasks = ntasks;
+    NCT_broadcast(&pool->wake);
+    runtasks(pool); /* the caller works too */
+    while(pool->finished < pool->ntasks)
+	NCT_wait(&pool->done,&pool->lock);
+    pool->ntasks = 0;
+    pool->next = 0;
+    pool->fcn = NULL;
+    pool->arg = NULL;
+    NCT_unlock(&pool->lock);
+    NCT_unlock(&pool->runlock);
+    return NC_NOERR;
+}
+
+struct NCmutex {
+    NCTmutex mutex;
+};
+
+int
+ncmutex_new(NCmutex** mutexp)
+{
+    NCmutex* m = NULL;
+#ifndef _WIN32
+    pthread_mutexattr_t attr;
+#endif
+
+    if(mutexp == NULL) return NC_EINVAL;
+    if((m = (NCmutex*)calloc(1,sizeof(NCmutex))) == NULL)
+	return NC_ENOMEM;
+#ifdef _WIN32
+    /* Critical sections are always recursive */
+    InitializeCriticalSection(&m->mutex);
+#else
+    if(pthread_mutexattr_init(&attr) != 0
+       || pthread_mutexattr_settype(&attr,PTHREAD_MUTEX_RECURSIVE) != 0
+       || pthread_mutex_init(&m->mutex,&attr) != 0) {
+	free(m);
+	return NC_EINTERNAL;
+    }
+    pthread_mutexattr_destroy(&attr);
+#endif
+    *mutexp = m;
+    return NC_NOERR;
+}
+
+void
+ncmutex_free(NCmutex* m)
+{
+    if(m == NULL) return;
+    NCT_mutex_destroy(&m->mutex);
+    free(m);
+}
+
+void
+ncmutex_lock(NCmutex* m)
+{
+    if(m != NULL) NCT_lock(&m->mutex);
+}
+
+void
+ncmutex_unlock(NCmutex* m)
+{
+    if(m != NULL) NCT_unlock(&m->mutex);
+}
+
+/* Per-thread scratch buffers, freed by the thread exit callback */
+typedef struct NCTbuffer {
+    size_t size;
+    void* data;
+} NCTbuffer;
+
+#ifdef _WIN32
+#define NCT_CALLBACK WINAPI
+#else
+#define NCT_CALLBACK
+#endif
+
+static void NCT_CALLBACK
+freebuffer(void* p)
+{
+    NCTbuffer* b = (NCTbuffer*)p;
+    if(b == NULL) return;
+    free(b->data);
+    free(b);
+}
+
+#ifdef _WIN32
+static DWORD bufferkey = FLS_OUT_OF_INDEXES;
+static INIT_ONCE bufferonce = INIT_ONCE_STATIC_INIT;
+static BOOL CALLBACK
+createbufferkey(PINIT_ONCE once, PVOID param, PVOID* ctx)
+{
+    bufferkey = FlsAlloc(freebuffer);
+    return TRUE;
+}
+#define NCT_getbuffer() (InitOnceExecuteOnce(&bufferonce,createbufferkey,NULL,NULL), \
+                         bufferkey == FLS_OUT_OF_INDEXES ? NULL : (NCTbuffer*)FlsGetValue(bufferkey))
+#define NCT_setbuffer(b) FlsSetValue(bufferkey,(b))
+#else
+static pthread_key_t bufferkey;
+static int bufferkeyok = 0;
+static pthread_once_t bufferonce = PTHREAD_ONCE_INIT;
+static void
+createbufferkey(void)
+{
+    bufferkeyok = (pthread_key_create(&bufferkey,freebuffer) == 0);
+}
+#define NCT_getbuffer() (pthread_once(&bufferonce,createbufferkey), \
+                         bufferkeyok ? (NCTbuffer*)pthread_getspecific(bufferkey) : NULL)
+#define NCT_setbuffer(b) pthread_setspecific(bufferkey,(b))
+#endif
+
+void*
+ncthreadbuffer(size_t size)
+{
+    NCTbuffer* b = NCT_getbuffer();
+    if(b == NULL) {
+#ifdef _WIN32
+	if(bufferkey == FLS_OUT_OF_INDEXES) return NULL;
+#else
+	if(!bufferkeyok) return NULL;
+#endif
+	if((b = (NCTbuffer*)calloc(1,sizeof(NCTbuffer))) == NULL)
+	    return NULL;
+	NCT_setbuffer(b);
+    }
+    if(b->size < size || b->data == NULL) {
+	void* data = realloc(b->data,(size == 0 ? 1 : size));
+	if(data == NULL) return NULL;
+	b->data = data;
+	b->size = size;
+    }
+    return b->data;
+}
+
+int
+ncnumcpus(void)
+{
+    long n = 1;
+#ifdef _WIN32
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    n = (long)si.dwNumberOfProcessors;
+#elif defined(_SC_NPROCESSORS_ONLN)
+    n = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    return (n < 1 ? 1 : (int)n);
+}
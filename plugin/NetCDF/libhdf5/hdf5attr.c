@@ -225,8 +225,7 @@ NC4_HDF5_rename_att(int ncid, int varid, const char *name, const char *newname)
     }
 
     /* Copy the new name into our metadata. */
-    if(att->hdr.name) free(att->hdr.name);
-    if (!(att->hdr.name = strdup(norm_newname)))
+    if (!(att->hdr.name = nc4_arena_strdup(h5, norm_newname)))
         return NC_ENOMEM;
 
     att->dirty = NC_TRUE;
@@ -524,7 +523,7 @@ nc4_put_att(NC_GRP_INFO_T* grp, int varid, const char *name, nc_type file_type,
     if (new_att)
     {
         LOG((3, "adding attribute %s to the list...", norm_name));
-        if ((ret = nc4_att_list_add(attlist, norm_name, &att)))
+        if ((ret = nc4_att_list_add(h5, attlist, norm_name, &att)))
             BAIL(ret);
 
         /* Allocate storage for the HDF5 specific att info. */
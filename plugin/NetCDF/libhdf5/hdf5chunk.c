@@ -0,0 +1,1248 @@
+/* Copyright 2003-2026, University Corporation for Atmospheric
+ * Research. See the COPYRIGHT file for copying and redistribution
+ * conditions.
+ */
+/**
+ * @file
+ * @internal Threaded chunk filter pipeline for netCDF-4/HDF5
+ * variables.
+ *
+ * HDF5 runs the filter pipeline of a chunked dataset on the calling
+ * thread, one chunk at a time. For the filters whose encoding is
+ * fully specified (shuffle, deflate and fletcher32) the library can
+ * run the pipeline itself: whole chunks are encoded by a pool of
+ * worker threads and committed, in chunk order, with
+ * H5Dwrite_chunk(). The encoded bytes are identical to those HDF5
+ * would produce, so the resulting files cannot be told apart from
+ * files written through H5Dwrite(). Reads run the other way: the
+ * raw chunks are fetched with H5Dread_chunk() and decoded and
+ * scattered into the caller's buffer in parallel.
+ *
+ * Only the calling thread ever calls HDF5; the workers only touch
+ * memory and zlib.
+ */
+
+#include "config.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "hdf5internal.h"
+#include "hdf5err.h"
+#include "ncthreads.h"
+#include "netcdf.h"
+#include "netcdf_filter.h"
+
+#ifdef H5_HAVE_FILTER_DEFLATE
+#if defined(flagWIN32) || defined(flagPOSIX)
+#include <plugin/z/lib/zlib.h> /* built as a U++ package */
+#else
+#include <zlib.h>
+#endif
+#endif
+
+/** @internal Chunks encoded per pool run, per thread. Bounds the
+ * memory held by encoded chunks waiting to be committed. */
+#define CHUNKS_PER_THREAD 4
+
+/** @internal Size of the fletcher32 checksum appended to a chunk. */
+#define FLETCHER_LEN 4
+
+/** @internal A filter chain that can be run outside HDF5. */
+typedef struct NC_chunk_pipeline {
+    int nfilters;
+    struct NC_chunk_filter {
+        H5Z_filter_t id;
+        unsigned int flags;
+        unsigned int param; /**< shuffle: type size; deflate: level */
+    } filters[H5Z_MAX_NFILTERS];
+} NC_chunk_pipeline;
+
+/** @internal How a hyperslab maps onto the chunks of a dataset. */
+typedef struct NC_chunk_layout {
+    int ndims;
+    size_t esize;                    /**< Element size in bytes. */
+    size_t chunkbytes;               /**< Size of an unfiltered chunk. */
+    size_t nchunks;                  /**< Chunks touched by the hyperslab. */
+    hsize_t chunk[NC_MAX_VAR_DIMS];  /**< Chunk shape. */
+    hsize_t first[NC_MAX_VAR_DIMS];  /**< Index of the first chunk touched. */
+    hsize_t last[NC_MAX_VAR_DIMS];   /**< Index of the last chunk touched. */
+    NC_chunk_pipeline pipeline;
+} NC_chunk_layout;
+
+/** @internal One chunk of a threaded read or write. */
+typedef struct NC_io_chunk {
+    hsize_t* origin;     /**< Chunk origin, in elements. */
+    unsigned char* buf;  /**< Encoded chunk. */
+    size_t nbytes;       /**< Size of the encoded chunk. */
+    unsigned mask;       /**< Filters skipped, as for H5Dwrite_chunk(). */
+    int stat;
+} NC_io_chunk;
+
+/** @internal State shared by the tasks of a threaded read or write. */
+typedef struct NC_io_job {
+    const NC_chunk_layout* layout;
+    const hsize_t* fdims;      /**< Dataset extent. */
+    const hsize_t* start;      /**< Origin of the data in the dataset. */
+    const hsize_t* count;      /**< Shape of the data. */
+    unsigned char* data;
+    const unsigned char* fill; /**< One element; NULL means zeros. */
+    NC_io_chunk* chunks;
+} NC_io_job;
+
+/** @internal Pool shared by all files; rebuilt when the thread count
+ * changes. */
+static NCthreadpool* chunkpool = NULL;
+/** @internal Thread count chunkpool was built for. It may have started
+ * fewer workers. */
+static int chunkpool_nthreads = 0;
+
+/**
+ * @internal Get the worker pool, (re)creating it to match
+ * nc_set_chunk_threads().
+ *
+ * @return The pool, or NULL if threading is off.
+ */
+static NCthreadpool*
+getchunkpool(void)
+{
+    int nthreads = NC_getglobalstate()->chunkthreads;
+
+    if (nthreads <= 1)
+        return NULL;
+    if (chunkpool && chunkpool_nthreads != nthreads)
+    {
+        ncthreadpool_free(chunkpool);
+        chunkpool = NULL;
+    }
+    if (!chunkpool)
+    {
+        /* The calling thread works too */
+        if (ncthreadpool_new(nthreads - 1, &chunkpool))
+            chunkpool = NULL;
+        else
+            chunkpool_nthreads = nthreads;
+    }
+    if (chunkpool && ncthreadpool_size(chunkpool) == 0)
+        return NULL;
+    return chunkpool;
+}
+
+/**
+ * @internal Release the worker pool. Called when HDF5 is finalized.
+ */
+void
+NC4_hdf5_chunk_finalize(void)
+{
+    ncthreadpool_free(chunkpool);
+    chunkpool = NULL;
+    chunkpool_nthreads = 0;
+}
+
+/**
+ * @internal Get the filter chain of a dataset, if every filter in it
+ * can be run by the library.
+ *
+ * @param dcpl Dataset creation property list.
+ * @param pipeline Gets the chain.
+ *
+ * @return 1 if the chain can be run, 0 if not.
+ */
+static int
+get_pipeline(hid_t dcpl, NC_chunk_pipeline* pipeline)
+{
+    int i, n;
+
+    if ((n = H5Pget_nfilters(dcpl)) <= 0 || n > H5Z_MAX_NFILTERS)
+        return 0;
+    pipeline->nfilters = n;
+    for (i = 0; i < n; i++)
+    {
+        struct NC_chunk_filter* f = &pipeline->filters[i];
+        unsigned int cd[8];
+        size_t ncd = sizeof(cd)/sizeof(cd[0]);
+
+        f->id = H5Pget_filter2(dcpl, (unsigned)i, &f->flags, &ncd, cd, 0, NULL, NULL);
+        f->param = (ncd > 0 ? cd[0] : 0);
+        switch (f->id) {
+        case H5Z_FILTER_SHUFFLE:
+            if (ncd < 1 || f->param == 0) return 0;
+            break;
+        case H5Z_FILTER_FLETCHER32:
+            break;
+#ifdef H5_HAVE_FILTER_DEFLATE
+        case H5Z_FILTER_DEFLATE:
+            if (ncd < 1 || f->param > 9) return 0;
+            break;
+#endif
+        default:
+            return 0; /* szip, zstd, plugins: leave them to HDF5 */
+        }
+    }
+    return 1;
+}
+
+/**
+ * @internal The fletcher32 checksum, as computed by HDF5.
+ */
+static unsigned int
+fletcher32(const unsigned char* data, size_t nbytes)
+{
+    size_t len = nbytes / 2;
+    unsigned int sum1 = 0, sum2 = 0;
+
+    while (len)
+    {
+        size_t tlen = (len > 360 ? 360 : len);
+        len -= tlen;
+        do {
+            sum1 += (unsigned int)((((unsigned)data[0]) << 8) | ((unsigned)data[1]));
+            data += 2;
+            sum2 += sum1;
+        } while (--tlen);
+        sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+        sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+    }
+    if (nbytes % 2)
+    {
+        sum1 += (unsigned int)(((unsigned)*data) << 8);
+        sum2 += sum1;
+        sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+        sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+    }
+    sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+    sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+    return (sum2 << 16) | sum1;
+}
+
+/**
+ * @internal Byte shuffle nbytes of src into dst, as the HDF5 shuffle
+ * filter does.
+ */
+static void
+shuffle(const unsigned char* src, unsigned char* dst, size_t nbytes, size_t esize)
+{
+    size_t nelems = nbytes / esize;
+    size_t leftover = nbytes % esize;
+    size_t i, j;
+
+    for (i = 0; i < esize; i++)
+    {
+        const unsigned char* s = src + i;
+        unsigned char* d = dst + i * nelems;
+        for (j = 0; j < nelems; j++, s += esize)
+            *d++ = *s;
+    }
+    if (leftover)
+        memcpy(dst + (nbytes - leftover), src + (nbytes - leftover), leftover);
+}
+
+/**
+ * @internal Run a filter chain over a chunk, in the forward (write)
+ * direction.
+ *
+ * @param pipeline The filter chain.
+ * @param bufp Pointer to the malloc'd chunk; may be replaced.
+ * @param nbytesp Pointer to the size of the chunk; updated.
+ * @param maskp Gets the mask of optional filters that failed.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_ENOMEM Out of memory.
+ * @return ::NC_EFILTER A mandatory filter failed.
+ */
+static int
+encode_chunk(const NC_chunk_pipeline* pipeline, unsigned char** bufp,
+             size_t* nbytesp, unsigned* maskp)
+{
+    int i;
+
+    *maskp = 0;
+    for (i = 0; i < pipeline->nfilters; i++)
+    {
+        const struct NC_chunk_filter* f = &pipeline->filters[i];
+        unsigned char* src = *bufp;
+        unsigned char* dst = NULL;
+        size_t nbytes = *nbytesp;
+
+        switch (f->id) {
+        case H5Z_FILTER_SHUFFLE:
+            if (f->param <= 1 || nbytes / f->param <= 1)
+                continue; /* HDF5 leaves such chunks alone */
+            if ((dst = (unsigned char*)malloc(nbytes)) == NULL)
+                return NC_ENOMEM;
+            shuffle(src, dst, nbytes, f->param);
+            break;
+        case H5Z_FILTER_FLETCHER32: {
+            unsigned int sum = fletcher32(src, nbytes);
+            if ((dst = (unsigned char*)realloc(src, nbytes + FLETCHER_LEN)) == NULL)
+                return NC_ENOMEM;
+            dst[nbytes] = (unsigned char)(sum & 0xff);
+            dst[nbytes+1] = (unsigned char)((sum >> 8) & 0xff);
+            dst[nbytes+2] = (unsigned char)((sum >> 16) & 0xff);
+            dst[nbytes+3] = (unsigned char)((sum >> 24) & 0xff);
+            *bufp = dst;
+            *nbytesp = nbytes + FLETCHER_LEN;
+            } continue;
+#ifdef H5_HAVE_FILTER_DEFLATE
+        case H5Z_FILTER_DEFLATE: {
+            uLongf zlen = compressBound((uLong)nbytes);
+            if ((dst = (unsigned char*)malloc(zlen)) == NULL)
+                return NC_ENOMEM;
+            if (compress2(dst, &zlen, src, (uLong)nbytes, (int)f->param) != Z_OK)
+            {
+                free(dst);
+                if (!(f->flags & H5Z_FLAG_OPTIONAL))
+                    return NC_EFILTER;
+                /* Same as HDF5: skip the filter and flag it */
+                *maskp |= (1u << i);
+                continue;
+            }
+            nbytes = zlen;
+            } break;
+#endif
+        default:
+            return NC_EFILTER;
+        }
+        free(src);
+        *bufp = dst;
+        *nbytesp = nbytes;
+    }
+    return NC_NOERR;
+}
+
+/**
+ * @internal Undo shuffle(): gather the byte planes of src back into
+ * elements in dst.
+ */
+static void
+unshuffle(const unsigned char* src, unsigned char* dst, size_t nbytes, size_t esize)
+{
+    size_t nelems = nbytes / esize;
+    size_t leftover = nbytes % esize;
+    size_t i, j;
+
+    for (i = 0; i < esize; i++)
+    {
+        const unsigned char* s = src + i * nelems;
+        unsigned char* d = dst + i;
+        for (j = 0; j < nelems; j++, d += esize)
+            *d = *s++;
+    }
+    if (leftover)
+        memcpy(dst + (nbytes - leftover), src + (nbytes - leftover), leftover);
+}
+
+/**
+ * @internal Run a filter chain over a chunk, in the reverse (read)
+ * direction.
+ *
+ * @param pipeline The filter chain.
+ * @param mask Filters skipped when the chunk was written.
+ * @param chunkbytes Size of the decoded chunk.
+ * @param bufp Pointer to the malloc'd chunk; may be replaced.
+ * @param nbytesp Pointer to the size of the chunk; updated.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_ENOMEM Out of memory.
+ * @return ::NC_EHDFERR Corrupt chunk or checksum mismatch.
+ */
+static int
+decode_chunk(const NC_chunk_pipeline* pipeline, unsigned mask, size_t chunkbytes,
+             unsigned char** bufp, size_t* nbytesp)
+{
+    int i;
+
+    for (i = pipeline->nfilters - 1; i >= 0; i--)
+    {
+        const struct NC_chunk_filter* f = &pipeline->filters[i];
+        unsigned char* src = *bufp;
+        unsigned char* dst = NULL;
+        size_t nbytes = *nbytesp;
+
+        if (mask & (1u << i))
+            continue;
+        switch (f->id) {
+        case H5Z_FILTER_SHUFFLE:
+            if (f->param <= 1 || nbytes / f->param <= 1)
+                continue;
+            if ((dst = (unsigned char*)malloc(nbytes)) == NULL)
+                return NC_ENOMEM;
+            unshuffle(src, dst, nbytes, f->param);
+            break;
+        case H5Z_FILTER_FLETCHER32: {
+            unsigned int sum, stored;
+            if (nbytes < FLETCHER_LEN)
+                return NC_EHDFERR;
+            nbytes -= FLETCHER_LEN;
+            stored = (unsigned int)src[nbytes] | ((unsigned int)src[nbytes+1] << 8) |
+                     ((unsigned int)src[nbytes+2] << 16) | ((unsigned int)src[nbytes+3] << 24);
+            sum = fletcher32(src, nbytes);
+            /* Files from HDF5 1.6 have the sum with the bytes of each
+             * half swapped; HDF5 accepts both. */
+            if (stored != sum &&
+                stored != (((sum & 0x00ff00ffu) << 8) | ((sum >> 8) & 0x00ff00ffu)))
+                return NC_EHDFERR;
+            *nbytesp = nbytes;
+            } continue;
+#ifdef H5_HAVE_FILTER_DEFLATE
+        case H5Z_FILTER_DEFLATE: {
+            /* Later filters only ever add a few bytes */
+            uLongf zlen = (uLongf)(chunkbytes + (size_t)pipeline->nfilters * FLETCHER_LEN);
+            int zstat;
+            for (;;)
+            {
+                uLongf len = zlen;
+                if ((dst = (unsigned char*)malloc(len)) == NULL)
+                    return NC_ENOMEM;
+                if ((zstat = uncompress(dst, &len, src, (uLong)nbytes)) != Z_BUF_ERROR)
+                {
+                    zlen = len;
+                    break;
+                }
+                free(dst);
+                zlen *= 2;
+            }
+            if (zstat != Z_OK)
+            {
+                free(dst);
+                return NC_EHDFERR;
+            }
+            nbytes = zlen;
+            } break;
+#endif
+        default:
+            return NC_EFILTER;
+        }
+        free(src);
+        *bufp = dst;
+        *nbytesp = nbytes;
+    }
+    return (*nbytesp == chunkbytes ? NC_NOERR : NC_EHDFERR);
+}
+
+/**
+ * @internal Copy the box [lo,hi) of a hyperslab between two row-major
+ * arrays, each described by its origin and shape in the dataset.
+ */
+static void
+copy_box(int ndims, size_t esize, const hsize_t* lo, const hsize_t* hi,
+         const unsigned char* src, const hsize_t* sorg, const hsize_t* sdims,
+         unsigned char* dst, const hsize_t* dorg, const hsize_t* ddims)
+{
+    size_t sstride[NC_MAX_VAR_DIMS], dstride[NC_MAX_VAR_DIMS];
+    hsize_t idx[NC_MAX_VAR_DIMS];
+    size_t run, soff, doff;
+    int d, last = ndims - 1;
+
+    sstride[last] = dstride[last] = esize;
+    for (d = last - 1; d >= 0; d--)
+    {
+        sstride[d] = sstride[d+1] * (size_t)sdims[d+1];
+        dstride[d] = dstride[d+1] * (size_t)ddims[d+1];
+    }
+    run = (size_t)(hi[last] - lo[last]) * esize;
+    for (d = 0; d < ndims; d++)
+        idx[d] = lo[d];
+    for (;;)
+    {
+        soff = doff = 0;
+        for (d = 0; d < ndims; d++)
+        {
+            soff += (size_t)(idx[d] - sorg[d]) * sstride[d];
+            doff += (size_t)(idx[d] - dorg[d]) * dstride[d];
+        }
+        memcpy(dst + doff, src + soff, run);
+        /* Odometer over all but the innermost dimension */
+        for (d = last - 1; d >= 0; d--)
+        {
+            if (++idx[d] < hi[d])
+                break;
+            idx[d] = lo[d];
+        }
+        if (d < 0)
+            break;
+    }
+}
+
+/**
+ * @internal Replicate one element of esize bytes across a buffer.
+ */
+static void
+fill_pattern(unsigned char* buf, size_t nbytes, const unsigned char* fill,
+             size_t esize)
+{
+    size_t done;
+
+    if (fill == NULL)
+    {
+        memset(buf, 0, nbytes);
+        return;
+    }
+    if (nbytes < esize)
+        return;
+    memcpy(buf, fill, esize);
+    for (done = esize; done < nbytes; done *= 2)
+        memcpy(buf + done, buf, (nbytes - done < done ? nbytes - done : done));
+}
+
+/**
+ * @internal Get the element HDF5 fills unwritten parts of chunks
+ * with, as the native type.
+ *
+ * @return Malloc'd fill element, or NULL for zeros.
+ */
+static unsigned char*
+get_chunk_fill(hid_t dcpl, hid_t native_typeid, size_t esize)
+{
+    H5D_fill_value_t status;
+    H5D_fill_time_t fill_time;
+    unsigned char* fill;
+
+    if (H5Pget_fill_time(dcpl, &fill_time) < 0 || fill_time == H5D_FILL_TIME_NEVER)
+        return NULL;
+    if (H5Pfill_value_defined(dcpl, &status) < 0 || status == H5D_FILL_VALUE_UNDEFINED)
+        return NULL;
+    if ((fill = (unsigned char*)calloc(1, esize)) == NULL)
+        return NULL;
+    if (H5Pget_fill_value(dcpl, native_typeid, fill) < 0)
+    {
+        free(fill);
+        return NULL;
+    }
+    return fill;
+}
+
+/**
+ * @internal Decide whether a hyperslab of a variable can go through
+ * the threaded pipeline, and if so describe its chunks.
+ *
+ * @param var Pointer to var info.
+ * @param start Start of the hyperslab.
+ * @param count Shape of the hyperslab; no zero counts.
+ * @param dcplp Gets the dataset creation property list, which the
+ * caller must close if it is not negative.
+ * @param layout Gets the chunk layout.
+ * @param okp Set to 1 if the hyperslab can be handled.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EHDFERR HDF5 error.
+ */
+static int
+get_chunk_layout(NC_VAR_INFO_T* var, const hsize_t* start, const hsize_t* count,
+                 hid_t* dcplp, NC_chunk_layout* layout, int* okp)
+{
+    NC_HDF5_VAR_INFO_T* hdf5_var = (NC_HDF5_VAR_INFO_T*)var->format_var_info;
+    hid_t native_typeid = ((NC_HDF5_TYPE_INFO_T*)var->type_info->format_type_info)->native_hdf_typeid;
+    hid_t typeid = -1;
+    int d, retval = NC_NOERR;
+
+    *okp = 0;
+    *dcplp = -1;
+
+    /* Cheap tests first. */
+    if (var->ndims == 0 || var->storage != NC_CHUNKED ||
+        nclistlength((NClist*)var->filters) == 0)
+        return NC_NOERR;
+    if (var->type_info->nc_type_class == NC_STRING ||
+        var->type_info->nc_type_class == NC_VLEN ||
+        var->type_info->nc_type_class == NC_COMPOUND)
+        return NC_NOERR;
+
+    /* Count the chunks the hyperslab touches. */
+    layout->ndims = var->ndims;
+    layout->esize = var->type_info->size;
+    layout->chunkbytes = layout->esize;
+    layout->nchunks = 1;
+    if ((*dcplp = H5Dget_create_plist(hdf5_var->hdf_datasetid)) < 0)
+        BAIL(NC_EHDFERR);
+    if (H5Pget_chunk(*dcplp, var->ndims, layout->chunk) != var->ndims)
+        BAIL(NC_EHDFERR);
+    for (d = 0; d < var->ndims; d++)
+    {
+        if (count[d] == 0)
+            BAIL(NC_NOERR);
+        layout->first[d] = start[d] / layout->chunk[d];
+        layout->last[d] = (start[d] + count[d] - 1) / layout->chunk[d];
+        layout->nchunks *= (size_t)(layout->last[d] - layout->first[d] + 1);
+        layout->chunkbytes *= (size_t)layout->chunk[d];
+    }
+    if (layout->nchunks < 2)
+        BAIL(NC_NOERR);
+
+    /* Can the library run the pipeline, and are the stored bytes the
+     * native bytes? */
+    if (!get_pipeline(*dcplp, &layout->pipeline))
+        BAIL(NC_NOERR);
+    if ((typeid = H5Dget_type(hdf5_var->hdf_datasetid)) < 0)
+        BAIL(NC_EHDFERR);
+    if (H5Tequal(typeid, native_typeid) <= 0)
+        BAIL(NC_NOERR);
+    *okp = 1;
+
+exit:
+    if (typeid >= 0 && H5Tclose(typeid) < 0)
+        BAIL2(NC_EHDFERR);
+    return retval;
+}
+
+/**
+ * @internal Step to the next chunk index touched by a hyperslab.
+ *
+ * @return 0 once all chunks have been visited.
+ */
+static int
+next_chunk(const NC_chunk_layout* layout, hsize_t* idx)
+{
+    int d;
+
+    for (d = layout->ndims - 1; d >= 0; d--)
+    {
+        if (++idx[d] <= layout->last[d])
+            return 1;
+        idx[d] = layout->first[d];
+    }
+    return 0;
+}
+
+/**
+ * @internal Get the part of a chunk inside both the hyperslab and
+ * the dataset extent.
+ *
+ * @return 1 if that part is the whole of the chunk inside the extent.
+ */
+static int
+chunk_box(const NC_chunk_layout* layout, const hsize_t* origin, const hsize_t* fdims,
+          const hsize_t* start, const hsize_t* count, hsize_t* lo, hsize_t* hi)
+{
+    int d, covered = 1;
+
+    for (d = 0; d < layout->ndims; d++)
+    {
+        hsize_t e = origin[d] + layout->chunk[d];
+        if (e > fdims[d])
+            e = fdims[d];
+        if (origin[d] < start[d] || e > start[d] + count[d])
+            covered = 0;
+        lo[d] = (origin[d] < start[d] ? start[d] : origin[d]);
+        hi[d] = (e < start[d] + count[d] ? e : start[d] + count[d]);
+    }
+    return covered;
+}
+
+/**
+ * @internal Read or write a list of boxes of the hyperslab through
+ * HDF5's own pipeline.
+ */
+static int
+boxes_via_hdf5(NC_VAR_INFO_T* var, int write, size_t nboxes, const hsize_t* boxes,
+               const hsize_t* start, const hsize_t* count, void* data,
+               hid_t xfer_plistid)
+{
+    NC_HDF5_VAR_INFO_T* hdf5_var = (NC_HDF5_VAR_INFO_T*)var->format_var_info;
+    hid_t native_typeid = ((NC_HDF5_TYPE_INFO_T*)var->type_info->format_type_info)->native_hdf_typeid;
+    hid_t file_spaceid = -1, mem_spaceid = -1;
+    hsize_t memlo[NC_MAX_VAR_DIMS], n[NC_MAX_VAR_DIMS];
+    int ndims = var->ndims, d, retval = NC_NOERR;
+    size_t i;
+
+    if (nboxes == 0)
+        return NC_NOERR;
+    if ((file_spaceid = H5Dget_space(hdf5_var->hdf_datasetid)) < 0)
+        BAIL(NC_EHDFERR);
+    if ((mem_spaceid = H5Screate_simple(ndims, count, NULL)) < 0)
+        BAIL(NC_EHDFERR);
+    for (i = 0; i < nboxes; i++)
+    {
+        const hsize_t* lo = &boxes[2 * i * (size_t)ndims];
+        const hsize_t* hi = lo + ndims;
+        herr_t herr;
+        for (d = 0; d < ndims; d++)
+        {
+            n[d] = hi[d] - lo[d];
+            memlo[d] = lo[d] - start[d];
+        }
+        if (H5Sselect_hyperslab(file_spaceid, H5S_SELECT_SET, lo, NULL, n, NULL) < 0)
+            BAIL(NC_EHDFERR);
+        if (H5Sselect_hyperslab(mem_spaceid, H5S_SELECT_SET, memlo, NULL, n, NULL) < 0)
+            BAIL(NC_EHDFERR);
+        if (write)
+            herr = H5Dwrite(hdf5_var->hdf_datasetid, native_typeid, mem_spaceid,
+                            file_spaceid, xfer_plistid, data);
+        else
+            herr = H5Dread(hdf5_var->hdf_datasetid, native_typeid, mem_spaceid,
+                           file_spaceid, xfer_plistid, data);
+        if (herr < 0)
+            BAIL(NC_EHDFERR);
+        if (write)
+            NC4_HDF5_STATS(var->container->nc4_info)->writes++;
+        else
+            NC4_HDF5_STATS(var->container->nc4_info)->reads++;
+    }
+
+exit:
+    if (mem_spaceid >= 0 && H5Sclose(mem_spaceid) < 0)
+        BAIL2(NC_EHDFERR);
+    if (file_spaceid >= 0 && H5Sclose(file_spaceid) < 0)
+        BAIL2(NC_EHDFERR);
+    return retval;
+}
+
+/**
+ * @internal Task: gather one chunk out of the caller's data and run
+ * it through the filter chain.
+ */
+static void
+put_chunk_task(void* arg, size_t task)
+{
+    NC_io_job* job = (NC_io_job*)arg;
+    const NC_chunk_layout* layout = job->layout;
+    NC_io_chunk* pc = &job->chunks[task];
+    hsize_t hi[NC_MAX_VAR_DIMS];
+    int d, partial = 0;
+
+    if ((pc->buf = (unsigned char*)malloc(layout->chunkbytes)) == NULL)
+    {
+        pc->stat = NC_ENOMEM;
+        return;
+    }
+    for (d = 0; d < layout->ndims; d++)
+    {
+        hi[d] = pc->origin[d] + layout->chunk[d];
+        if (hi[d] > job->fdims[d])
+        {
+            hi[d] = job->fdims[d];
+            partial = 1;
+        }
+    }
+    /* The part of an edge chunk outside the dataset extent holds the
+     * fill value, just as HDF5 leaves it. */
+    if (partial)
+        fill_pattern(pc->buf, layout->chunkbytes, job->fill, layout->esize);
+    copy_box(layout->ndims, layout->esize, pc->origin, hi,
+             job->data, job->start, job->count,
+             pc->buf, pc->origin, layout->chunk);
+    pc->nbytes = layout->chunkbytes;
+    pc->stat = encode_chunk(&layout->pipeline, &pc->buf, &pc->nbytes, &pc->mask);
+}
+
+/**
+ * @internal Task: decode one chunk and scatter its part of the
+ * hyperslab into the caller's buffer.
+ */
+static void
+get_chunk_task(void* arg, size_t task)
+{
+    NC_io_job* job = (NC_io_job*)arg;
+    const NC_chunk_layout* layout = job->layout;
+    NC_io_chunk* gc = &job->chunks[task];
+    hsize_t lo[NC_MAX_VAR_DIMS], hi[NC_MAX_VAR_DIMS];
+
+    if ((gc->stat = decode_chunk(&layout->pipeline, gc->mask, layout->chunkbytes,
+                                 &gc->buf, &gc->nbytes)))
+        return;
+    (void)chunk_box(layout, gc->origin, job->fdims, job->start, job->count, lo, hi);
+    copy_box(layout->ndims, layout->esize, lo, hi,
+             gc->buf, gc->origin, layout->chunk,
+             job->data, job->start, job->count);
+}
+
+/**
+ * @internal Write a hyperslab of a chunked, filtered variable by
+ * encoding the chunks it fully covers in parallel and committing them
+ * with direct chunk writes. The remaining partially covered chunks are
+ * written through H5Dwrite().
+ *
+ * The caller must already have extended the dataset to hold the
+ * hyperslab, and converted the data to the file type.
+ *
+ * @param h5 Pointer to file info.
+ * @param var Pointer to var info.
+ * @param fdims Current dataset extent.
+ * @param start Start of the hyperslab (stride is always 1).
+ * @param count Shape of the hyperslab.
+ * @param data The data, in the file type, native byte order.
+ * @param xfer_plistid Transfer property list.
+ * @param donep Set to 1 if the data has been written, 0 if the caller
+ * must write it with H5Dwrite().
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EHDFERR HDF5 error.
+ * @return ::NC_ENOMEM Out of memory.
+ */
+int
+NC4_hdf5_put_chunks(NC_FILE_INFO_T* h5, NC_VAR_INFO_T* var, const hsize_t* fdims,
+                    const hsize_t* start, const hsize_t* count, const void* data,
+                    hid_t xfer_plistid, int* donep)
+{
+    NC_HDF5_VAR_INFO_T* hdf5_var = (NC_HDF5_VAR_INFO_T*)var->format_var_info;
+    hid_t native_typeid = ((NC_HDF5_TYPE_INFO_T*)var->type_info->format_type_info)->native_hdf_typeid;
+    hid_t dcpl = -1;
+    NCthreadpool* pool;
+    NC_chunk_layout layout;
+    NC_io_job job;
+    hsize_t idx[NC_MAX_VAR_DIMS], lo[NC_MAX_VAR_DIMS], hi[NC_MAX_VAR_DIMS];
+    hsize_t* origins = NULL; /* covered chunks, ndims each */
+    hsize_t* boxes = NULL;   /* partially covered parts, lo and hi each */
+    size_t ncovered = 0, nboxes = 0, batch = 0, b, i;
+    unsigned char* fill = NULL;
+    int ndims = var->ndims, d, ok, retval = NC_NOERR;
+
+    NC_UNUSED(h5);
+    *donep = 0;
+    memset(&job, 0, sizeof(job));
+
+    if ((pool = getchunkpool()) == NULL)
+        return NC_NOERR;
+    if ((retval = get_chunk_layout(var, start, count, &dcpl, &layout, &ok)) || !ok)
+        goto exit;
+
+    /* Sort the chunks into those whose part inside the extent is
+     * covered by the hyperslab, and the rest. */
+    if ((origins = (hsize_t*)malloc(layout.nchunks * (size_t)ndims * sizeof(hsize_t))) == NULL)
+        BAIL(NC_ENOMEM);
+    if ((boxes = (hsize_t*)malloc(2 * layout.nchunks * (size_t)ndims * sizeof(hsize_t))) == NULL)
+        BAIL(NC_ENOMEM);
+    for (d = 0; d < ndims; d++)
+        idx[d] = layout.first[d];
+    do {
+        hsize_t* origin = &origins[ncovered * (size_t)ndims];
+        for (d = 0; d < ndims; d++)
+            origin[d] = idx[d] * layout.chunk[d];
+        if (chunk_box(&layout, origin, fdims, start, count, lo, hi))
+            ncovered++;
+        else
+        {
+            memcpy(&boxes[2 * nboxes * (size_t)ndims], lo, (size_t)ndims * sizeof(hsize_t));
+            memcpy(&boxes[(2 * nboxes + 1) * (size_t)ndims], hi, (size_t)ndims * sizeof(hsize_t));
+            nboxes++;
+        }
+    } while (next_chunk(&layout, idx));
+    if (ncovered < 2)
+        BAIL(NC_NOERR);
+
+    job.layout = &layout;
+    job.fdims = fdims;
+    job.start = start;
+    job.count = count;
+    job.data = (unsigned char*)data;
+    job.fill = fill = get_chunk_fill(dcpl, native_typeid, layout.esize);
+
+    batch = (size_t)(ncthreadpool_size(pool) + 1) * CHUNKS_PER_THREAD;
+    if ((job.chunks = (NC_io_chunk*)calloc(batch, sizeof(NC_io_chunk))) == NULL)
+        BAIL(NC_ENOMEM);
+
+    /* Encode a batch in parallel, then commit it in chunk order. */
+    for (b = 0; b < ncovered; b += batch)
+    {
+        size_t nb = (ncovered - b < batch ? ncovered - b : batch);
+        for (i = 0; i < nb; i++)
+        {
+            memset(&job.chunks[i], 0, sizeof(NC_io_chunk));
+            job.chunks[i].origin = &origins[(b + i) * (size_t)ndims];
+        }
+        if ((retval = ncthreadpool_run(pool, nb, put_chunk_task, &job)))
+            BAIL(retval);
+        for (i = 0; i < nb; i++)
+        {
+            NC_io_chunk* pc = &job.chunks[i];
+            if (!retval && pc->stat)
+                retval = pc->stat;
+            if (!retval && H5Dwrite_chunk(hdf5_var->hdf_datasetid, xfer_plistid, pc->mask,
+                                          pc->origin, pc->nbytes, pc->buf) < 0)
+                retval = NC_EHDFERR;
+            if (!retval)
+            {
+                NC4_HDF5_STATS(h5)->writes++;
+                NC4_HDF5_STATS(h5)->chunks_written++;
+            }
+            nullfree(pc->buf);
+            pc->buf = NULL;
+        }
+        if (retval)
+            BAIL(retval);
+    }
+
+    /* Hand the partially covered chunks to HDF5. */
+    if ((retval = boxes_via_hdf5(var, 1, nboxes, boxes, start, count, (void*)data,
+                                 xfer_plistid)))
+        BAIL(retval);
+    *donep = 1;
+
+exit:
+    if (job.chunks)
+    {
+        for (i = 0; i < batch; i++)
+            nullfree(job.chunks[i].buf);
+        free(job.chunks);
+    }
+    nullfree(origins);
+    nullfree(boxes);
+    nullfree(fill);
+    if (dcpl >= 0 && H5Pclose(dcpl) < 0)
+        BAIL2(NC_EHDFERR);
+    return retval;
+}
+
+/**
+ * @internal Read a hyperslab of a chunked, filtered variable by
+ * fetching the raw chunks it touches with direct chunk reads,
+ * decoding them in parallel and scattering them into the caller's
+ * buffer. Chunks that were never written are read through H5Dread(),
+ * which supplies the fill value.
+ *
+ * @param h5 Pointer to file info.
+ * @param var Pointer to var info.
+ * @param fdims Current dataset extent.
+ * @param start Start of the hyperslab (stride is always 1).
+ * @param count Shape of the hyperslab, inside the extent.
+ * @param data Gets the data, in the file type, native byte order.
+ * @param xfer_plistid Transfer property list.
+ * @param donep Set to 1 if the data has been read, 0 if the caller
+ * must read it with H5Dread().
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EHDFERR HDF5 error, corrupt chunk or bad checksum.
+ * @return ::NC_ENOMEM Out of memory.
+ */
+int
+NC4_hdf5_get_chunks(NC_FILE_INFO_T* h5, NC_VAR_INFO_T* var, const hsize_t* fdims,
+                    const hsize_t* start, const hsize_t* count, void* data,
+                    hid_t xfer_plistid, int* donep)
+{
+    NC_HDF5_VAR_INFO_T* hdf5_var = (NC_HDF5_VAR_INFO_T*)var->format_var_info;
+    hid_t dcpl = -1;
+    NCthreadpool* pool;
+    NC_chunk_layout layout;
+    NC_io_job job;
+    hsize_t idx[NC_MAX_VAR_DIMS], lo[NC_MAX_VAR_DIMS], hi[NC_MAX_VAR_DIMS];
+    hsize_t* origins = NULL; /* one slot of ndims per batch entry */
+    hsize_t* boxes = NULL;   /* unallocated chunks, lo and hi each */
+    size_t nboxes = 0, batch = 0, nb = 0, i;
+    int ndims = var->ndims, d, ok, more, retval = NC_NOERR;
+
+    NC_UNUSED(h5);
+    *donep = 0;
+    memset(&job, 0, sizeof(job));
+
+    if ((pool = getchunkpool()) == NULL)
+        return NC_NOERR;
+    if ((retval = get_chunk_layout(var, start, count, &dcpl, &layout, &ok)) || !ok)
+        goto exit;
+
+    batch = (size_t)(ncthreadpool_size(pool) + 1) * CHUNKS_PER_THREAD;
+    if ((job.chunks = (NC_io_chunk*)calloc(batch, sizeof(NC_io_chunk))) == NULL)
+        BAIL(NC_ENOMEM);
+    if ((origins = (hsize_t*)malloc(batch * (size_t)ndims * sizeof(hsize_t))) == NULL)
+        BAIL(NC_ENOMEM);
+    if ((boxes = (hsize_t*)malloc(2 * layout.nchunks * (size_t)ndims * sizeof(hsize_t))) == NULL)
+        BAIL(NC_ENOMEM);
+    job.layout = &layout;
+    job.fdims = fdims;
+    job.start = start;
+    job.count = count;
+    job.data = (unsigned char*)data;
+
+    /* Fetch a batch of raw chunks, then decode it in parallel. */
+    for (d = 0; d < ndims; d++)
+        idx[d] = layout.first[d];
+    do {
+        NC_io_chunk* gc = &job.chunks[nb];
+        hsize_t nbytes = 0;
+
+        gc->origin = &origins[nb * (size_t)ndims];
+        for (d = 0; d < ndims; d++)
+            gc->origin[d] = idx[d] * layout.chunk[d];
+        more = next_chunk(&layout, idx);
+        if (H5Dget_chunk_storage_size(hdf5_var->hdf_datasetid, gc->origin, &nbytes) < 0 ||
+            nbytes == 0)
+        {
+            (void)chunk_box(&layout, gc->origin, fdims, start, count, lo, hi);
+            memcpy(&boxes[2 * nboxes * (size_t)ndims], lo, (size_t)ndims * sizeof(hsize_t));
+            memcpy(&boxes[(2 * nboxes + 1) * (size_t)ndims], hi, (size_t)ndims * sizeof(hsize_t));
+            nboxes++;
+        }
+        else
+        {
+            if ((gc->buf = (unsigned char*)malloc((size_t)nbytes)) == NULL)
+                BAIL(NC_ENOMEM);
+            gc->nbytes = (size_t)nbytes;
+            gc->mask = 0;
+            gc->stat = NC_NOERR;
+            if (H5Dread_chunk(hdf5_var->hdf_datasetid, xfer_plistid, gc->origin,
+                              &gc->mask, gc->buf) < 0)
+                BAIL(NC_EHDFERR);
+            NC4_HDF5_STATS(h5)->reads++;
+            NC4_HDF5_STATS(h5)->chunks_read++;
+            nb++;
+        }
+        if (nb == batch || (!more && nb > 0))
+        {
+            if ((retval = ncthreadpool_run(pool, nb, get_chunk_task, &job)))
+                BAIL(retval);
+            for (i = 0; i < nb; i++)
+            {
+                if (!retval && job.chunks[i].stat)
+                    retval = job.chunks[i].stat;
+                nullfree(job.chunks[i].buf);
+                job.chunks[i].buf = NULL;
+            }
+            nb = 0;
+            if (retval)
+                BAIL(retval);
+        }
+    } while (more);
+
+    /* Let HDF5 fill in the chunks that do not exist yet. */
+    if ((retval = boxes_via_hdf5(var, 0, nboxes, boxes, start, count, data,
+                                 xfer_plistid)))
+        BAIL(retval);
+    *donep = 1;
+
+exit:
+    if (job.chunks)
+    {
+        for (i = 0; i < batch; i++)
+            nullfree(job.chunks[i].buf);
+        free(job.chunks);
+    }
+    nullfree(origins);
+    nullfree(boxes);
+    if (dcpl >= 0 && H5Pclose(dcpl) < 0)
+        BAIL2(NC_EHDFERR);
+    return retval;
+}
+
+/**
+ * @internal Check that two datasets store their chunks the same
+ * way: same chunk shape, same filter chain with the same parameters
+ * and the same fill value.
+ *
+ * @return 1 if the stored chunks of one are valid chunks of the
+ * other, 0 if not, negative on HDF5 error.
+ */
+static int
+same_chunk_storage(hid_t dcpl_in, hid_t dcpl_out, hid_t typeid, int ndims)
+{
+    hsize_t chunk_in[NC_MAX_VAR_DIMS], chunk_out[NC_MAX_VAR_DIMS];
+    H5D_fill_value_t def_in, def_out;
+    size_t esize;
+    unsigned char *fill_in = NULL, *fill_out = NULL;
+    int i, n, same = 0;
+
+    if (H5Pget_chunk(dcpl_in, ndims, chunk_in) != ndims ||
+        H5Pget_chunk(dcpl_out, ndims, chunk_out) != ndims)
+        return -1;
+    if (memcmp(chunk_in, chunk_out, (size_t)ndims * sizeof(hsize_t)))
+        return 0;
+
+    if ((n = H5Pget_nfilters(dcpl_in)) < 0 || n != H5Pget_nfilters(dcpl_out))
+        return (n < 0 ? -1 : 0);
+    for (i = 0; i < n; i++)
+    {
+        unsigned int flags_in, flags_out, cd_in[32], cd_out[32];
+        size_t ncd_in = sizeof(cd_in)/sizeof(cd_in[0]), ncd_out = ncd_in;
+        H5Z_filter_t id_in, id_out;
+
+        id_in = H5Pget_filter2(dcpl_in, (unsigned)i, &flags_in, &ncd_in, cd_in, 0, NULL, NULL);
+        id_out = H5Pget_filter2(dcpl_out, (unsigned)i, &flags_out, &ncd_out, cd_out, 0, NULL, NULL);
+        if (id_in < 0 || id_out < 0)
+            return -1;
+        if (id_in != id_out || flags_in != flags_out || ncd_in != ncd_out ||
+            ncd_in > sizeof(cd_in)/sizeof(cd_in[0]) ||
+            memcmp(cd_in, cd_out, ncd_in * sizeof(unsigned int)))
+            return 0;
+    }
+
+    /* Chunks that were never written are filled on read, so both
+     * sides have to agree on what they hold. */
+    if (H5Pfill_value_defined(dcpl_in, &def_in) < 0 ||
+        H5Pfill_value_defined(dcpl_out, &def_out) < 0)
+        return -1;
+    if ((def_in == H5D_FILL_VALUE_UNDEFINED) != (def_out == H5D_FILL_VALUE_UNDEFINED))
+        return 0;
+    if (def_in == H5D_FILL_VALUE_UNDEFINED)
+        return 1;
+    if ((esize = H5Tget_size(typeid)) == 0)
+        return -1;
+    if ((fill_in = (unsigned char*)calloc(2, esize)) == NULL)
+        return -1;
+    fill_out = fill_in + esize;
+    if (H5Pget_fill_value(dcpl_in, typeid, fill_in) >= 0 &&
+        H5Pget_fill_value(dcpl_out, typeid, fill_out) >= 0)
+        same = !memcmp(fill_in, fill_out, esize);
+    else
+        same = -1;
+    free(fill_in);
+    return same;
+}
+
+/**
+ * @internal Copy the data of a chunked variable to a variable of
+ * another file by moving its stored chunks with H5Dread_chunk() and
+ * H5Dwrite_chunk(), without decompressing and recompressing them.
+ *
+ * This only happens when both variables have the same type in the
+ * file, the same shape, chunk sizes, filters and fill value. The
+ * unlimited dimensions of the output variable are extended to the
+ * size of the input variable. Chunks that were never written are
+ * not copied.
+ *
+ * @param ncid_in File ID to copy from.
+ * @param varid_in Variable ID to copy from.
+ * @param ncid_out File ID to copy to.
+ * @param varid_out Variable ID to copy to; nothing is done if any of
+ * its chunks has been written.
+ * @param donep Set to 1 if the data was copied, 0 if the caller has
+ * to copy it the usual way.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EBADID Bad ncid.
+ * @return ::NC_ENOTVAR Invalid variable ID.
+ * @return ::NC_ENOMEM Out of memory.
+ * @return ::NC_EHDFERR HDF5 error.
+ */
+int
+NC4_hdf5_copy_chunks(int ncid_in, int varid_in, int ncid_out, int varid_out,
+                     int* donep)
+{
+    NC_FILE_INFO_T *h5_in, *h5_out;
+    NC_VAR_INFO_T *var_in, *var_out;
+    hid_t dset_in, dset_out;
+    hid_t dcpl_in = -1, dcpl_out = -1, type_in = -1, type_out = -1;
+    hid_t space_in = -1, space_out = -1;
+    hsize_t fdims_in[NC_MAX_VAR_DIMS], fdims_out[NC_MAX_VAR_DIMS];
+    hsize_t maxdims_out[NC_MAX_VAR_DIMS];
+    hsize_t chunk[NC_MAX_VAR_DIMS], idx[NC_MAX_VAR_DIMS], origin[NC_MAX_VAR_DIMS];
+    unsigned char* buf = NULL;
+    size_t bufsize = 0;
+    int d, ndims, same, extend = 0;
+    int retval = NC_NOERR;
+
+    *donep = 0;
+    if ((retval = nc4_hdf5_find_grp_h5_var(ncid_in, varid_in, &h5_in, NULL, &var_in)))
+        return retval;
+    if ((retval = nc4_hdf5_find_grp_h5_var(ncid_out, varid_out, &h5_out, NULL, &var_out)))
+        return retval;
+
+    /* Cheap tests first. */
+    if (h5_in->parallel || h5_out->parallel || h5_out->no_write ||
+        (h5_out->flags & NC_INDEF) || !var_in->created || !var_out->created)
+        return NC_NOERR;
+    if ((ndims = var_in->ndims) == 0 || ndims != var_out->ndims ||
+        var_in->storage != NC_CHUNKED || var_out->storage != NC_CHUNKED)
+        return NC_NOERR;
+    /* The stored bytes of these refer to the global heap of the file. */
+    if (var_in->type_info->nc_type_class == NC_STRING ||
+        var_in->type_info->nc_type_class == NC_VLEN ||
+        var_out->type_info->nc_type_class == NC_STRING ||
+        var_out->type_info->nc_type_class == NC_VLEN)
+        return NC_NOERR;
+
+    dset_in = ((NC_HDF5_VAR_INFO_T*)var_in->format_var_info)->hdf_datasetid;
+    dset_out = ((NC_HDF5_VAR_INFO_T*)var_out->format_var_info)->hdf_datasetid;
+    if (!dset_in || !dset_out || H5Dget_storage_size(dset_out) != 0)
+        return NC_NOERR;
+
+    /* Same type in the file, same chunks and filters. */
+    if ((type_in = H5Dget_type(dset_in)) < 0 || (type_out = H5Dget_type(dset_out)) < 0)
+        BAIL(NC_EHDFERR);
+    if (H5Tequal(type_in, type_out) <= 0)
+        BAIL(NC_NOERR);
+    if ((dcpl_in = H5Dget_create_plist(dset_in)) < 0 ||
+        (dcpl_out = H5Dget_create_plist(dset_out)) < 0)
+        BAIL(NC_EHDFERR);
+    if ((same = same_chunk_storage(dcpl_in, dcpl_out, type_in, ndims)) < 0)
+        BAIL(NC_EHDFERR);
+    if (!same)
+        BAIL(NC_NOERR);
+    if (H5Pget_chunk(dcpl_in, ndims, chunk) != ndims)
+        BAIL(NC_EHDFERR);
+
+    /* Same shape, except for the unlimited dimensions of the output,
+     * which may have to grow. */
+    if ((space_in = H5Dget_space(dset_in)) < 0 || (space_out = H5Dget_space(dset_out)) < 0)
+        BAIL(NC_EHDFERR);
+    if (H5Sget_simple_extent_dims(space_in, fdims_in, NULL) != ndims ||
+        H5Sget_simple_extent_dims(space_out, fdims_out, maxdims_out) != ndims)
+        BAIL(NC_EHDFERR);
+    for (d = 0; d < ndims; d++)
+    {
+        if (fdims_in[d] == fdims_out[d])
+            continue;
+        if (maxdims_out[d] != H5S_UNLIMITED || fdims_in[d] < fdims_out[d])
+            BAIL(NC_NOERR);
+        extend = 1;
+    }
+
+    if (extend)
+    {
+        if (H5Dset_extent(dset_out, fdims_in) < 0)
+            BAIL(NC_EHDFERR);
+        for (d = 0; d < ndims; d++)
+            if (var_out->dim[d]->unlimited && fdims_in[d] != fdims_out[d])
+                var_out->dim[d]->extended = NC_TRUE;
+    }
+    var_out->written_to = NC_TRUE;
+    *donep = 1;
+
+    /* Move every stored chunk of the input. */
+    for (d = 0; d < ndims; d++)
+    {
+        if (fdims_in[d] == 0)
+            BAIL(NC_NOERR);
+        idx[d] = 0;
+    }
+    for (;;)
+    {
+        hsize_t nbytes = 0;
+        unsigned mask = 0;
+
+        for (d = 0; d < ndims; d++)
+            origin[d] = idx[d] * chunk[d];
+        if (H5Dget_chunk_storage_size(dset_in, origin, &nbytes) >= 0 && nbytes > 0)
+        {
+            if ((size_t)nbytes > bufsize)
+            {
+                unsigned char* p;
+                if ((p = (unsigned char*)realloc(buf, (size_t)nbytes)) == NULL)
+                    BAIL(NC_ENOMEM);
+                buf = p;
+                bufsize = (size_t)nbytes;
+            }
+            if (H5Dread_chunk(dset_in, H5P_DEFAULT, origin, &mask, buf) < 0)
+                BAIL(NC_EHDFERR);
+            if (H5Dwrite_chunk(dset_out, H5P_DEFAULT, mask, origin, (size_t)nbytes, buf) < 0)
+                BAIL(NC_EHDFERR);
+            /* Raw copies count the stored, possibly filtered, bytes. */
+            NC4_HDF5_STATS(h5_in)->reads++;
+            NC4_HDF5_STATS(h5_in)->chunks_read++;
+            NC4_HDF5_STATS(h5_in)->bytes_read += nbytes;
+            NC4_HDF5_STATS(h5_out)->writes++;
+            NC4_HDF5_STATS(h5_out)->chunks_written++;
+            NC4_HDF5_STATS(h5_out)->bytes_written += nbytes;
+        }
+        for (d = ndims - 1; d >= 0; d--)
+        {
+            if (++idx[d] * chunk[d] < fdims_in[d])
+                break;
+            idx[d] = 0;
+        }
+        if (d < 0)
+            break;
+    }
+
+exit:
+    nullfree(buf);
+    if (space_in >= 0 && H5Sclose(space_in) < 0)
+        BAIL2(NC_EHDFERR);
+    if (space_out >= 0 && H5Sclose(space_out) < 0)
+        BAIL2(NC_EHDFERR);
+    if (dcpl_in >= 0 && H5Pclose(dcpl_in) < 0)
+        BAIL2(NC_EHDFERR);
+    if (dcpl_out >= 0 && H5Pclose(dcpl_out) < 0)
+        BAIL2(NC_EHDFERR);
+    if (type_in >= 0 && H5Tclose(type_in) < 0)
+        BAIL2(NC_EHDFERR);
+    if (type_out >= 0 && H5Tclose(type_out) < 0)
+        BAIL2(NC_EHDFERR);
+    return retval;
+}
@@ -301,9 +301,9 @@ NC4_create(const char* path, int cmode, size_t initialsz, int basepe,
     LOG((1, "%s: path %s cmode 0x%x parameters %p",
          __func__, path, cmode, parameters));
 
-    /* If this is our first file, turn off HDF5 error messages. */
-    if (!nc4_hdf5_initialized)
-        nc4_hdf5_initialize();
+    /* If this is our first file, start HDF5. */
+    if ((res = NC_HDF5_startup()))
+        return res;
 
 #ifdef LOGGING
     /* If nc logging level has changed, see if we need to turn on
@@ -267,8 +267,7 @@ HDF5_rename_dim(int ncid, int dimid, const char *name)
     /* Give the dimension its new name in metadata. UTF8 normalization
      * has been done. */
     assert(dim->hdr.name);
-    free(dim->hdr.name);
-    if (!(dim->hdr.name = strdup(norm_name)))
+    if (!(dim->hdr.name = nc4_arena_strdup(h5, norm_name)))
         return NC_ENOMEM;
     LOG((3, "dim is now named %s", dim->hdr.name));
 
@@ -125,15 +125,39 @@ int
 NC_HDF5_initialize(void)
 {
     HDF5_dispatch_table = &HDF5_dispatcher;
+    return NC_NOERR;
+}
+
+extern int nc_plugin_path_initialize(void);
+
+static int hdf5_once = NC_ONCE_INIT;
+
+static int
+hdf5_startup(void)
+{
     if (!nc4_hdf5_initialized)
         nc4_hdf5_initialize();
-
+    nc_plugin_path_initialize();
 #ifdef NETCDF_ENABLE_BYTERANGE
     (void)H5FD_http_init();
 #endif
     return NC4_provenance_init();
 }
 
+/**
+ * @internal Start HDF5: turn off its error messages, set its plugin
+ * path and build the provenance. Starting HDF5 takes about a
+ * millisecond, so it is not done by nc_initialize() but by the first
+ * netCDF-4 open or create, and only once.
+ *
+ * @return ::NC_NOERR No error.
+ */
+int
+NC_HDF5_startup(void)
+{
+    return NC_once(&hdf5_once, hdf5_startup);
+}
+
 /**
  * @internal Finalize the HDF5 dispatch layer.
  *
@@ -143,9 +167,13 @@ NC_HDF5_initialize(void)
 int
 NC_HDF5_finalize(void)
 {
+    if (hdf5_once == NC_ONCE_INIT)
+        return NC_NOERR; /* never started */
 #ifdef NETCDF_ENABLE_BYTERANGE
     (void)H5FD_http_finalize();
 #endif
+    NC4_image_term();
     (void)nc4_hdf5_finalize();
+    hdf5_once = NC_ONCE_INIT;
     return NC_NOERR;
 }
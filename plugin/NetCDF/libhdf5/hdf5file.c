@@ -238,8 +238,10 @@ nc4_close_netcdf4_file(NC_FILE_INFO_T *h5, int abort, NC_memio *memio)
        then capture and return the final memory block else free it */
     if (h5->mem.inmemory)
     {
-        /* Pull out the final memory */
-        (void)NC4_extract_file_image(h5, abort);
+        /* Pull out the final memory. A copy on write image is only put
+           together if it is asked for */
+        if (!h5->mem.copyonwrite || (!abort && memio != NULL))
+            (void)NC4_extract_file_image(h5, abort);
         if (!abort && memio != NULL)
         {
             *memio = h5->mem.memio; /* capture it */
@@ -735,3 +737,58 @@ nc4_enddef_netcdf4_file(NC_FILE_INFO_T *h5)
     /* Sync all metadata and data to storage. */
     return sync_netcdf4_file(h5);
 }
+
+/**
+ * @internal Get the I/O statistics of a netCDF-4 file. Called by
+ * nc_inq_io_stats().
+ *
+ * @param ncid File and group ID.
+ * @param statsp Pointer that gets the statistics.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EBADID Bad ncid.
+ */
+int
+NC4_hdf5_inq_io_stats(int ncid, NC_io_stats *statsp)
+{
+    NC_FILE_INFO_T *h5;
+    NC_HDF5_FILE_INFO_T *hdf5_info;
+    double rate;
+    int retval;
+
+    if ((retval = nc4_find_grp_h5(ncid, NULL, &h5)))
+        return retval;
+    hdf5_info = (NC_HDF5_FILE_INFO_T *)h5->format_file_info;
+    *statsp = hdf5_info->stats;
+    statsp->mdc_hit_rate = -1;
+    if (H5Fget_mdc_hit_rate(hdf5_info->hdfid, &rate) >= 0)
+        statsp->mdc_hit_rate = rate;
+    return NC_NOERR;
+}
+
+/**
+ * @internal Set the I/O statistics of a netCDF-4 file to zero,
+ * including the HDF5 metadata cache hit rate. Called by
+ * nc_reset_io_stats().
+ *
+ * @param ncid File and group ID.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EBADID Bad ncid.
+ * @return ::NC_EHDFERR HDF5 error.
+ */
+int
+NC4_hdf5_reset_io_stats(int ncid)
+{
+    NC_FILE_INFO_T *h5;
+    NC_HDF5_FILE_INFO_T *hdf5_info;
+    int retval;
+
+    if ((retval = nc4_find_grp_h5(ncid, NULL, &h5)))
+        return retval;
+    hdf5_info = (NC_HDF5_FILE_INFO_T *)h5->format_file_info;
+    memset(&hdf5_info->stats, 0, sizeof(hdf5_info->stats));
+    if (H5Freset_mdc_hit_rate_stats(hdf5_info->hdfid) < 0)
+        return NC_EHDFERR;
+    return NC_NOERR;
+}
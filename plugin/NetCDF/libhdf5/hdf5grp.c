@@ -163,8 +163,7 @@ NC4_rename_grp(int grpid, const char *name)
 
     /* Give the group its new name in metadata. UTF8 normalization
      * has been done. */
-    free(grp->hdr.name);
-    if (!(grp->hdr.name = strdup(norm_name)))
+    if (!(grp->hdr.name = nc4_arena_strdup(h5, norm_name)))
         return NC_ENOMEM;
 
     /* Rebuild index. */
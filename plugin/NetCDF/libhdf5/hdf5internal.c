@@ -100,6 +100,7 @@ nc4_hdf5_finalize(void)
     /* Reclaim global resources */
     NC4_provenance_finalize();
     NC4_hdf5_filter_finalize();
+    NC4_hdf5_chunk_finalize();
     nc4_hdf5_initialized = 0;
 }
 
@@ -266,11 +267,16 @@ nc4_find_dim_len(NC_GRP_INFO_T *grp, int dimid, size_t **len)
     LOG((3, "%s: grp->name %s dimid %d", __func__, grp->hdr.name, dimid));
 
     /* If there are any groups, call this function recursively on
-     * them. */
+     * them. Groups not read yet may hold vars using this dim, so
+     * read them now. */
     for (size_t i = 0; i < ncindexsize(grp->children); i++)
-        if ((retval = nc4_find_dim_len((NC_GRP_INFO_T*)ncindexith(grp->children, i),
-                                       dimid, len)))
+    {
+        NC_GRP_INFO_T *child_grp = (NC_GRP_INFO_T*)ncindexith(grp->children, i);
+        if ((retval = nc4_read_grp(child_grp)))
+            return retval;
+        if ((retval = nc4_find_dim_len(child_grp, dimid, len)))
             return retval;
+    }
 
     /* For all variables in this group, find the ones that use this
      * dimension, and remember the max length. */
@@ -67,6 +67,7 @@ extern int NC4_open_image_file(NC_FILE_INFO_T* h5);
 
 /* Defined later in this file. */
 static int rec_read_metadata(NC_GRP_INFO_T *grp);
+static int read_grp_metadata(NC_GRP_INFO_T *grp);
 static int read_type(NC_GRP_INFO_T *grp, hid_t hdf_typeid, char *type_name);
 
 /**
@@ -862,6 +863,10 @@ nc4_open_file(const char *path, int mode, void* parameters, int ncid)
         nc4_info->mem.memio = *memio;
         /* Is the incoming memory locked? */
         nc4_info->mem.locked = (nc4_info->mem.memio.flags & NC_MEMIO_LOCKED) == NC_MEMIO_LOCKED;
+        /* Copy on write memory is never written or freed either */
+        nc4_info->mem.copyonwrite = (nc4_info->mem.memio.flags & NC_MEMIO_COPYONWRITE) == NC_MEMIO_COPYONWRITE;
+        if(nc4_info->mem.copyonwrite)
+            nc4_info->mem.locked = 1;
         /* As a safeguard, if not locked and not read-only,
            then we must take control of the incoming memory */
         if(!nc4_info->mem.locked && !nc4_info->no_write) {
@@ -908,12 +913,14 @@ nc4_open_file(const char *path, int mode, void* parameters, int ncid)
 		    {retval = NC_EURL; goto exit;}
 		ncurifree(h5->uri);
 		h5->uri = newuri;
-	        if((retval = NC_getactives3profile(h5->uri,&profile0)))
+		/* profile0 may be an .rc value, see NC_rclookup() */
+		NCLOCKGLOBAL();
+	        if((retval = NC_getactives3profile(h5->uri,&profile0)) == NC_NOERR
+   	           && (retval = NC_s3profilelookup(profile0,AWS_PROF_ACCESS_KEY_ID,&awsaccessid0)) == NC_NOERR)
+		    retval = NC_s3profilelookup(profile0,AWS_PROF_SECRET_ACCESS_KEY,&awssecretkey0);
+		NCUNLOCKGLOBAL();
+		if(retval)
 		    BAIL(retval);
-   	        if((retval = NC_s3profilelookup(profile0,AWS_PROF_ACCESS_KEY_ID,&awsaccessid0)))
-		    BAIL(retval);		
-		if((retval = NC_s3profilelookup(profile0,AWS_PROF_SECRET_ACCESS_KEY,&awssecretkey0)))
-		    BAIL(retval);		
 		if(s3.region == NULL)
 		    s3.region = strdup(AWS_GLOBAL_DEFAULT_REGION);
 	        if(awsaccessid0 == NULL || awssecretkey0 == NULL ) {
@@ -965,6 +972,14 @@ nc4_open_file(const char *path, int mode, void* parameters, int ncid)
 	  BAIL(NC_EHDFERR);
     }
 
+    /* Files opened read-only have the contents of their groups read
+     * when each group is first accessed; only the root group is read
+     * now. Files open for writing are read in full, since writing the
+     * metadata back walks all the groups. */
+    nc4_info->read_grp = read_grp_metadata;
+    if (!nc4_info->no_write || nc4_info->parallel)
+        nc4_info->read_grp = NULL;
+
     /* Now read in all the metadata. Some types and dimscale
      * information may be difficult to resolve here, if, for example, a
      * dataset of user-defined type is encountered before the
@@ -1032,6 +1047,8 @@ int
 NC4_open(const char *path, int mode, int basepe, size_t *chunksizehintp,
          void *parameters, const NC_Dispatch *dispatch, int ncid)
 {
+    int retval;
+
     assert(path && dispatch);
 
     LOG((1, "%s: path %s mode %d params %x",
@@ -1045,8 +1062,8 @@ NC4_open(const char *path, int mode, int basepe, size_t *chunksizehintp,
         return NC_EINVAL;
 
     /* If this is our first file, initialize HDF5. */
-    if (!nc4_hdf5_initialized)
-        nc4_hdf5_initialize();
+    if ((retval = NC_HDF5_startup()))
+        return retval;
 
 #ifdef LOGGING
     /* If nc logging level has changed, see if we need to turn on
@@ -2328,7 +2345,7 @@ att_read_callbk(hid_t loc_id, const char *att_name, const H5A_info_t *ainfo,
         return NC_NOERR;
 
     /* Add to the end of the list of atts for this var. */
-    if ((retval = nc4_att_list_add(list, att_name, &att)))
+    if ((retval = nc4_att_list_add(att_info->grp->nc4_info, list, att_name, &att)))
         BAIL(-1);
 
     /* Remember container */
@@ -2782,7 +2799,8 @@ exit:
  * are not immediately processed, but are deferred until all the other
  * links in the group are handled (so that vars in the child groups
  * are guaranteed to have types that they use in a parent group in
- * place).
+ * place). In files opened read-only the child groups are only added,
+ * and read_grp_metadata() reads them when they are first accessed.
  *
  * @param grp Pointer to a group.
  *
@@ -2894,6 +2912,14 @@ rec_read_metadata(NC_GRP_INFO_T *grp)
         if (!(child_grp->format_grp_info = calloc(1, sizeof(NC_HDF5_GRP_INFO_T))))
             return NC_ENOMEM;
 
+        /* Leave the child group's contents until it is first
+         * accessed, if the file allows it. */
+        if (grp->nc4_info->read_grp)
+        {
+            child_grp->lazy = NC_TRUE;
+            continue;
+        }
+
         /* Recursively read the child group's metadata. */
         if ((retval = rec_read_metadata(child_grp)))
             BAIL(retval);
@@ -2921,6 +2947,35 @@ exit:
     return retval;
 }
 
+/**
+ * @internal Read the contents of a group whose reading was deferred
+ * when the file was opened, and match the dimscales of its vars. Its
+ * child groups are again left unread. This is the read_grp function
+ * of files opened read-only, called through nc4_read_grp().
+ *
+ * The parent groups have always been read already, so the types and
+ * dims the group's vars may use from them are in place.
+ *
+ * @param grp Pointer to group info struct.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EHDFERR HDF5 error.
+ * @return ::NC_ENOMEM Out of memory.
+ */
+static int
+read_grp_metadata(NC_GRP_INFO_T *grp)
+{
+    int retval;
+
+    assert(grp && grp->lazy && grp->parent && !grp->parent->lazy);
+    LOG((3, "%s: grp->hdr.name %s", __func__, grp->hdr.name));
+
+    grp->lazy = NC_FALSE;
+    if ((retval = rec_read_metadata(grp)))
+        return retval;
+    return rec_match_dimscales(grp);
+}
+
 /**
  * Wrapper function for H5Fopen.
  * Converts the filename from ANSI to UTF-8 as needed before calling H5Fopen.
@@ -13,9 +13,13 @@
 #include "hdf5internal.h"
 #include "hdf5err.h" /* For BAIL2 */
 #include <math.h> /* For pow() used below. */
+#ifdef HAVE_STDINT_H
+#include <stdint.h>
+#endif
 
 #include "netcdf.h"
 #include "netcdf_filter.h"
+#include "ncutil.h"
 
 /** @internal Temp name used when renaming vars to preserve varid
  * order. */
@@ -1311,8 +1315,7 @@ NC4_rename_var(int ncid, int varid, const char *name)
     }
 
     /* Now change the name in our metadata. */
-    free(var->hdr.name);
-    if (!(var->hdr.name = strdup(name)))
+    if (!(var->hdr.name = nc4_arena_strdup(h5, name)))
         return NC_ENOMEM;
     LOG((3, "var is now %s", var->hdr.name));
 
@@ -1468,6 +1471,82 @@ log_dim_info(NC_VAR_INFO_T *var, hsize_t *fdims, hsize_t *fmaxdims,
 }
 #endif /* LOGGING */
 
+/**
+ * @internal Check whether a stride vector is all ones.
+ *
+ * @param stridep Array of strides, or NULL.
+ * @param ndims Number of dimensions.
+ *
+ * @return 1 if stridep is NULL or all ones, 0 otherwise.
+ */
+static int
+unit_stride(const ptrdiff_t *stridep, int ndims)
+{
+    int d;
+
+    if (stridep)
+        for (d = 0; d < ndims; d++)
+            if (stridep[d] != 1)
+                return 0;
+    return 1;
+}
+
+/**
+ * @internal Set n values of a type of fixed size to a fill value.
+ *
+ * Values of 1, 2, 4 or 8 bytes are stored by a loop the compiler
+ * vectorizes. Larger ones, like compounds, are copied once and then
+ * the part already filled is copied after itself, doubling it until
+ * n values are set, so that it takes a few large memcpy() calls.
+ *
+ * @param data Pointer to where the values go.
+ * @param fill Pointer to the fill value.
+ * @param size Size of the type in bytes.
+ * @param n Number of values.
+ */
+static void
+fill_fixed(void *data, const void *fill, size_t size, size_t n)
+{
+    size_t i, done;
+
+    if (n == 0)
+        return;
+    switch (size)
+    {
+    case 1:
+        memset(data, *(const unsigned char *)fill, n);
+        return;
+    case 2:
+    {
+        uint16_t v, *p = data;
+        memcpy(&v, fill, 2);
+        for (i = 0; i < n; i++)
+            p[i] = v;
+        return;
+    }
+    case 4:
+    {
+        uint32_t v, *p = data;
+        memcpy(&v, fill, 4);
+        for (i = 0; i < n; i++)
+            p[i] = v;
+        return;
+    }
+    case 8:
+    {
+        uint64_t v, *p = data;
+        memcpy(&v, fill, 8);
+        for (i = 0; i < n; i++)
+            p[i] = v;
+        return;
+    }
+    }
+    memcpy(data, fill, size);
+    for (done = 1; done < n; done *= 2)
+        memcpy((char *)data + done * size, data,
+               (done < n - done ? done : n - done) * size);
+}
+
 #ifdef USE_PARALLEL4
 /**
  * @internal Set the parallel access for a var (collective
@@ -1560,6 +1639,7 @@ NC4_put_vars(int ncid, int varid, const size_t *startp, const size_t *countp,
     void *bufr = NULL;
     int need_to_convert = 0;
     int zero_count = 0; /* true if a count is zero */
+    int chunks_written = 0;
     size_t len = 1;
 
     /* Find info for this file, group, and var. */
@@ -1799,20 +1879,44 @@ NC4_put_vars(int ncid, int varid, const size_t *startp, const size_t *countp,
     /* Do we need to convert the data? */
     if (need_to_convert)
     {
-        if ((retval = nc4_convert_type(data, bufr, mem_nc_type, var->type_info->hdr.id,
-                                       len, &range_error, var->fill_value,
-                                       (h5->cmode & NC_CLASSIC_MODEL), var->quantize_mode,
-				       var->nsd)))
+        unsigned long long t0 = NC_nanotime();
+        retval = nc4_convert_type(data, bufr, mem_nc_type, var->type_info->hdr.id,
+                                  len, &range_error, var->fill_value,
+                                  (h5->cmode & NC_CLASSIC_MODEL), var->quantize_mode,
+                                  var->nsd);
+        NC4_HDF5_STATS(h5)->convert_nsecs += NC_nanotime() - t0;
+        if (retval)
             BAIL(retval);
     }
 
+    /* If the chunks of a filtered variable can be compressed by
+     * worker threads, let them do it. */
+    if (var->ndims && !zero_count && unit_stride(stridep, var->ndims)
+#ifdef USE_PARALLEL4
+        && !h5->parallel
+#endif
+        )
+        if ((retval = NC4_hdf5_put_chunks(h5, var, fdims, start, count, bufr,
+                                          xfer_plistid, &chunks_written)))
+            BAIL(retval);
+
     /* Write the data. At last! */
     LOG((4, "about to H5Dwrite datasetid 0x%x mem_spaceid 0x%x "
          "file_spaceid 0x%x", hdf5_var->hdf_datasetid, mem_spaceid, file_spaceid));
-    if (H5Dwrite(hdf5_var->hdf_datasetid,
+    if (!chunks_written &&
+        H5Dwrite(hdf5_var->hdf_datasetid,
                  ((NC_HDF5_TYPE_INFO_T *)var->type_info->format_type_info)->native_hdf_typeid,
                  mem_spaceid, file_spaceid, xfer_plistid, bufr) < 0)
         BAIL(NC_EHDFERR);
+    if (!chunks_written)
+        NC4_HDF5_STATS(h5)->writes++;
+    if (!zero_count)
+    {
+        unsigned long long nbytes = var->type_info->size;
+        for (d2 = 0; d2 < var->ndims; d2++)
+            nbytes *= count[d2];
+        NC4_HDF5_STATS(h5)->bytes_written += nbytes;
+    }
 
     /* Remember that we have written to this var so that Fill Value
      * can't be set for it. */
@@ -1903,6 +2007,7 @@ NC4_get_vars(int ncid, int varid, const size_t *startp, const size_t *countp,
     int fixedlengthstring = 0;
     hsize_t fstring_len = 0;
     size_t fstring_count = 1;
+    int chunks_read = 0;
 
     /* Find info for this file, group, and var. */
     if ((retval = nc4_hdf5_find_grp_h5_var(ncid, varid, &h5, &grp, &var)))
@@ -2153,12 +2258,32 @@ NC4_get_vars(int ncid, int varid, const size_t *startp, const size_t *countp,
             BAIL(retval);
 #endif
 
+        /* If the chunks of a filtered variable can be decompressed by
+         * worker threads, let them do it. */
+        if (!scalar && !fixedlengthstring && unit_stride(stridep, var->ndims)
+#ifdef USE_PARALLEL4
+            && !h5->parallel
+#endif
+            )
+            if ((retval = NC4_hdf5_get_chunks(h5, var, fdims, start, count, bufr,
+                                              xfer_plistid, &chunks_read)))
+                BAIL(retval);
+
         /* Read this hyperslab into memory. */
         LOG((5, "About to H5Dread some data..."));
-        if (H5Dread(hdf5_var->hdf_datasetid,
+        if (!chunks_read &&
+            H5Dread(hdf5_var->hdf_datasetid,
                     ((NC_HDF5_TYPE_INFO_T *)var->type_info->format_type_info)->native_hdf_typeid,
                     mem_spaceid, file_spaceid, xfer_plistid, bufr) < 0)
             BAIL(NC_EHDFERR);
+        if (!chunks_read)
+            NC4_HDF5_STATS(h5)->reads++;
+        {
+            unsigned long long nbytes = var->type_info->size;
+            for (d2 = 0; d2 < var->ndims; d2++)
+                nbytes *= count[d2];
+            NC4_HDF5_STATS(h5)->bytes_read += nbytes;
+        }
     } /* endif ! no_read */
     else
     {
@@ -2235,26 +2360,31 @@ NC4_get_vars(int ncid, int varid, const size_t *startp, const size_t *countp,
         for (fill_len = 1, d2 = 0; d2 < var->ndims; d2++)
             fill_len *= (fill_value_size[d2] ? fill_value_size[d2] : 1);
 
-        /* Copy the fill value into the rest of the data buffer. */
+        /* Copy the fill value into the rest of the data buffer. Only
+         * types holding pointers (strings, VLENs) need a deep copy of
+         * each value. */
         filldata = (char *)bufr + real_data_size;
-        for (i = 0; i < fill_len; i++)
-        {
-
-	    {
-		/* Copy one instance of the fill_value */
-		if((retval = NC_copy_data(h5->controller,var->type_info->hdr.id,fillvalue,1,filldata)))
-		    BAIL(retval);
-	    }
-            filldata = (char *)filldata + file_type_size;
-	}        
+        if (!NC4_var_varsized(var))
+            fill_fixed(filldata, fillvalue, file_type_size, fill_len);
+        else
+            for (i = 0; i < fill_len; i++)
+            {
+                /* Copy one instance of the fill_value */
+                if((retval = NC_copy_data(h5->controller,var->type_info->hdr.id,fillvalue,1,filldata)))
+                    BAIL(retval);
+                filldata = (char *)filldata + file_type_size;
+            }
     }
 
     /* Convert data type if needed. */
     if (need_to_convert)
     {
-        if ((retval = nc4_convert_type(bufr, data, var->type_info->hdr.id, mem_nc_type,
-				       len, &range_error, var->fill_value,
-				       (h5->cmode & NC_CLASSIC_MODEL), var->quantize_mode, var->nsd)))
+        unsigned long long t0 = NC_nanotime();
+        retval = nc4_convert_type(bufr, data, var->type_info->hdr.id, mem_nc_type,
+                                  len, &range_error, var->fill_value,
+                                  (h5->cmode & NC_CLASSIC_MODEL), var->quantize_mode, var->nsd);
+        NC4_HDF5_STATS(h5)->convert_nsecs += NC_nanotime() - t0;
+        if (retval)
             BAIL(retval);
 
         /* For strict netcdf-3 rules, ignore erange errors between UBYTE
@@ -207,6 +207,11 @@ typedef struct {
                                 /* be open */
     int ref_count;		/* Reference counter on udata struct */
     NC_FILE_INFO_T* h5;
+    /* Copy on write images, see H5FD_cow below */
+    int cow;			/* Image opened with the H5FD_cow driver */
+    unsigned char*** cowdir;	/* Directory of tables of NC4_COW_DIRSIZE pages */
+    size_t cowdirlen;		/* Number of tables in cowdir */
+    size_t coweof;		/* Size of the file */
 } H5LT_file_image_ud_t;
 
 /* Unique id for file name */
@@ -715,6 +720,361 @@ out:
 
 /* End of callbacks definitions for file image operations */
 
+/* Copy on write images
+
+   An image opened for writing with NC_MEMIO_COPYONWRITE is not given
+   to the core driver, that would need its own copy of all of it, but
+   to the H5FD_cow driver below. Reads come from the caller's memory,
+   that is never written, and the first write to a page of
+   NC4_COW_PAGESIZE bytes gives the file a private copy of that page.
+   Many opens of the same image share it, and each one costs only the
+   pages it changed. The pages are kept in the udata, so that they
+   outlive H5Fclose() and NC4_extract_file_image() can put the final
+   image together.
+*/
+
+#if H5_VERSION_GE(1, 13, 2)
+#  ifndef H5FD_CLASS_VERSION
+#  define H5FD_CLASS_VERSION 0x00
+#  endif
+#endif
+
+#define NC4_COW_PAGESIZE ((size_t)4096)
+#define NC4_COW_DIRSIZE ((size_t)512) /* pages per table */
+/* A value out of the range of registered drivers */
+#define H5_VFD_NC4COW ((H5FD_class_value_t)(384))
+
+typedef struct H5FD_cow_t {
+    H5FD_t pub;			/* public stuff, must be first */
+    haddr_t eoa;		/* end of allocated region */
+    H5LT_file_image_ud_t* udata;	/* image and pages */
+} H5FD_cow_t;
+
+/* The driver info in the fapl */
+typedef struct H5FD_cow_fapl_t {
+    H5LT_file_image_ud_t* udata;
+} H5FD_cow_fapl_t;
+
+static hid_t H5FD_COW_g = 0;
+
+/* Return page n, or NULL if it was never written. With create, copy it
+   from the image, or zero it past the end of the image, on first use */
+static unsigned char*
+cow_page(H5LT_file_image_ud_t* udata, size_t n, int create)
+{
+    size_t d = n / NC4_COW_DIRSIZE;
+    unsigned char** table;
+    unsigned char* page;
+
+    if(d >= udata->cowdirlen) {
+	unsigned char*** newdir;
+	size_t newlen = udata->cowdirlen ? udata->cowdirlen : 16;
+	if(!create) return NULL;
+	while(newlen <= d) newlen *= 2;
+	newdir = (unsigned char***)realloc(udata->cowdir,newlen*sizeof(unsigned char**));
+	if(newdir == NULL) return NULL;
+	memset(newdir+udata->cowdirlen,0,(newlen-udata->cowdirlen)*sizeof(unsigned char**));
+	udata->cowdir = newdir;
+	udata->cowdirlen = newlen;
+    }
+    table = udata->cowdir[d];
+    if(table == NULL) {
+	if(!create) return NULL;
+	if((table = (unsigned char**)calloc(NC4_COW_DIRSIZE,sizeof(unsigned char*))) == NULL)
+	    return NULL;
+	udata->cowdir[d] = table;
+    }
+    page = table[n % NC4_COW_DIRSIZE];
+    if(page == NULL && create) {
+	size_t start = n * NC4_COW_PAGESIZE, len = 0;
+	if((page = (unsigned char*)malloc(NC4_COW_PAGESIZE)) == NULL)
+	    return NULL;
+	if(start < udata->app_image_size) {
+	    len = udata->app_image_size - start;
+	    if(len > NC4_COW_PAGESIZE) len = NC4_COW_PAGESIZE;
+	    memcpy(page,(unsigned char*)udata->app_image_ptr+start,len);
+	}
+	memset(page+len,0,NC4_COW_PAGESIZE-len);
+	table[n % NC4_COW_DIRSIZE] = page;
+    }
+    return page;
+}
+
+static void
+cow_free(H5LT_file_image_ud_t* udata)
+{
+    size_t d, i;
+    for(d=0;d<udata->cowdirlen;d++) {
+	if(udata->cowdir[d] == NULL) continue;
+	for(i=0;i<NC4_COW_DIRSIZE;i++)
+	    free(udata->cowdir[d][i]);
+	free(udata->cowdir[d]);
+    }
+    free(udata->cowdir);
+    udata->cowdir = NULL;
+    udata->cowdirlen = 0;
+}
+
+/* Put the image together: the caller's memory with the pages written */
+static void*
+cow_image(H5LT_file_image_ud_t* udata)
+{
+    size_t size = udata->coweof, len, n, npages;
+    unsigned char* image = (unsigned char*)malloc(size > 0 ? size : 1);
+    if(image == NULL) return NULL;
+    len = size < udata->app_image_size ? size : udata->app_image_size;
+    memcpy(image,udata->app_image_ptr,len);
+    memset(image+len,0,size-len);
+    npages = (size + NC4_COW_PAGESIZE - 1) / NC4_COW_PAGESIZE;
+    for(n=0;n<npages;n++) {
+	unsigned char* page = cow_page(udata,n,0);
+	if(page == NULL) continue;
+	len = size - n * NC4_COW_PAGESIZE;
+	if(len > NC4_COW_PAGESIZE) len = NC4_COW_PAGESIZE;
+	memcpy(image + n * NC4_COW_PAGESIZE,page,len);
+    }
+    return image;
+}
+
+static H5FD_t*
+H5FD_cow_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
+{
+    const H5FD_cow_fapl_t* fa = (const H5FD_cow_fapl_t*)H5Pget_driver_info(fapl_id);
+    H5FD_cow_t* file;
+
+    if(fa == NULL || fa->udata == NULL)
+	return NULL;
+    if((file = (H5FD_cow_t*)calloc(1,sizeof(H5FD_cow_t))) == NULL)
+	return NULL;
+    file->udata = fa->udata;
+    return (H5FD_t*)file;
+}
+
+static herr_t
+H5FD_cow_close(H5FD_t *_file)
+{
+    free(_file); /* the pages stay in the udata */
+    return SUCCEED;
+}
+
+static int
+H5FD_cow_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
+{
+    const H5FD_cow_t* f1 = (const H5FD_cow_t*)_f1;
+    const H5FD_cow_t* f2 = (const H5FD_cow_t*)_f2;
+    if(f1->udata < f2->udata) return -1;
+    if(f1->udata > f2->udata) return 1;
+    return 0;
+}
+
+static herr_t
+H5FD_cow_query(const H5FD_t *_f, unsigned long *flags)
+{
+    if(flags) {
+	*flags = 0;
+	*flags |= H5FD_FEAT_AGGREGATE_METADATA;
+	*flags |= H5FD_FEAT_ACCUMULATE_METADATA;
+	*flags |= H5FD_FEAT_DATA_SIEVE;
+	*flags |= H5FD_FEAT_AGGREGATE_SMALLDATA;
+#if H5FD_CLASS_VERSION > 0
+	*flags |= H5FD_FEAT_DEFAULT_VFD_COMPATIBLE;
+#endif
+    }
+    return SUCCEED;
+}
+
+static haddr_t
+H5FD_cow_get_eoa(const H5FD_t *_file, H5FD_mem_t type)
+{
+    return ((const H5FD_cow_t*)_file)->eoa;
+}
+
+static herr_t
+H5FD_cow_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr)
+{
+    ((H5FD_cow_t*)_file)->eoa = addr;
+    return SUCCEED;
+}
+
+static haddr_t
+H5FD_cow_get_eof(const H5FD_t *_file, H5FD_mem_t type)
+{
+    return (haddr_t)((const H5FD_cow_t*)_file)->udata->coweof;
+}
+
+static herr_t
+H5FD_cow_get_handle(H5FD_t *_file, hid_t fapl, void **file_handle)
+{
+    *file_handle = ((H5FD_cow_t*)_file)->udata;
+    return SUCCEED;
+}
+
+static herr_t
+H5FD_cow_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size_t size, void *buf)
+{
+    H5LT_file_image_ud_t* udata = ((H5FD_cow_t*)_file)->udata;
+    unsigned char* dst = (unsigned char*)buf;
+
+    if(HADDR_UNDEF == addr || addr + size < addr)
+	return FAIL;
+    while(size > 0) {
+	size_t offset = (size_t)(addr % NC4_COW_PAGESIZE);
+	size_t n = NC4_COW_PAGESIZE - offset;
+	unsigned char* page;
+	if(n > size) n = size;
+	if(addr >= udata->coweof)
+	    memset(dst,0,n); /* past the end of file */
+	else if((page = cow_page(udata,(size_t)(addr / NC4_COW_PAGESIZE),0)) != NULL)
+	    memcpy(dst,page+offset,n);
+	else if(addr + n <= udata->app_image_size)
+	    memcpy(dst,(unsigned char*)udata->app_image_ptr+addr,n);
+	else {
+	    size_t len = addr < udata->app_image_size ? (size_t)(udata->app_image_size - addr) : 0;
+	    memcpy(dst,(unsigned char*)udata->app_image_ptr+addr,len);
+	    memset(dst+len,0,n-len);
+	}
+	addr += n;
+	dst += n;
+	size -= n;
+    }
+    return SUCCEED;
+}
+
+static herr_t
+H5FD_cow_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size_t size, const void *buf)
+{
+    H5LT_file_image_ud_t* udata = ((H5FD_cow_t*)_file)->udata;
+    const unsigned char* src = (const unsigned char*)buf;
+
+    if(HADDR_UNDEF == addr || addr + size < addr)
+	return FAIL;
+    if(addr + size > udata->coweof)
+	udata->coweof = (size_t)(addr + size);
+    while(size > 0) {
+	size_t offset = (size_t)(addr % NC4_COW_PAGESIZE);
+	size_t n = NC4_COW_PAGESIZE - offset;
+	unsigned char* page = cow_page(udata,(size_t)(addr / NC4_COW_PAGESIZE),1);
+	if(page == NULL)
+	    return FAIL;
+	if(n > size) n = size;
+	memcpy(page+offset,src,n);
+	addr += n;
+	src += n;
+	size -= n;
+    }
+    return SUCCEED;
+}
+
+static herr_t
+H5FD_cow_flush(H5FD_t *_file, hid_t dxpl_id, hbool_t closing)
+{
+    return SUCCEED;
+}
+
+static herr_t
+H5FD_cow_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing)
+{
+    H5FD_cow_t* file = (H5FD_cow_t*)_file;
+    file->udata->coweof = (size_t)file->eoa;
+    return SUCCEED;
+}
+
+static const H5FD_class_t H5FD_cow_g = {
+#if H5FD_CLASS_VERSION > 0
+    H5FD_CLASS_VERSION,		/* struct version  */
+    H5_VFD_NC4COW,		/* value           */
+#endif
+    "nc4cow",			/* name         */
+    (haddr_t)(((size_t)-1)>>1),	/* maxaddr      */
+    H5F_CLOSE_WEAK,		/* fc_degree    */
+    NULL,			/* terminate    */
+    NULL,			/* sb_size      */
+    NULL,			/* sb_encode    */
+    NULL,			/* sb_decode    */
+    sizeof(H5FD_cow_fapl_t),	/* fapl_size    */
+    NULL,			/* fapl_get     */
+    NULL,			/* fapl_copy    */
+    NULL,			/* fapl_free    */
+    0,				/* dxpl_size    */
+    NULL,			/* dxpl_copy    */
+    NULL,			/* dxpl_free    */
+    H5FD_cow_open,		/* open         */
+    H5FD_cow_close,		/* close        */
+    H5FD_cow_cmp,		/* cmp          */
+    H5FD_cow_query,		/* query        */
+    NULL,			/* get_type_map */
+    NULL,			/* alloc        */
+    NULL,			/* free         */
+    H5FD_cow_get_eoa,		/* get_eoa      */
+    H5FD_cow_set_eoa,		/* set_eoa      */
+    H5FD_cow_get_eof,		/* get_eof      */
+    H5FD_cow_get_handle,	/* get_handle   */
+    H5FD_cow_read,		/* read         */
+    H5FD_cow_write,		/* write        */
+#if H5FD_CLASS_VERSION > 0
+    NULL,			/* read_vector     */
+    NULL,			/* write_vector    */
+    NULL,			/* read_selection  */
+    NULL,			/* write_selection */
+#endif
+    H5FD_cow_flush,		/* flush        */
+    H5FD_cow_truncate,		/* truncate     */
+    NULL,			/* lock         */
+    NULL,			/* unlock       */
+#if H5FD_CLASS_VERSION > 0
+    NULL,			/* del          */
+    NULL,			/* ctl	        */
+#endif
+    H5FD_FLMAP_DICHOTOMY	/* fl_map       */
+};
+
+/* Register the driver on first use */
+static hid_t
+H5FD_cow_init(void)
+{
+    if (H5I_VFL != H5Iget_type(H5FD_COW_g))
+        H5FD_COW_g = H5FDregister(&H5FD_cow_g);
+    return H5FD_COW_g;
+}
+
+/* Set the fapl to open the image of h5 with the H5FD_cow driver, and
+   return the udata that keeps the pages */
+static H5LT_file_image_ud_t*
+cow_udata(NC_FILE_INFO_T* h5, hid_t fapl)
+{
+    H5LT_file_image_ud_t* udata;
+    H5FD_cow_fapl_t fa;
+    hid_t driver;
+
+    if ((udata = (H5LT_file_image_ud_t *)calloc(1,sizeof(H5LT_file_image_ud_t))) == NULL)
+        return NULL;
+    udata->app_image_ptr = h5->mem.memio.memory;
+    udata->app_image_size = h5->mem.memio.size;
+    udata->flags = h5->mem.imageflags;
+    udata->ref_count = 1;
+    udata->h5 = h5;
+    udata->cow = 1;
+    udata->coweof = udata->app_image_size;
+
+    fa.udata = udata;
+    if ((driver = H5FD_cow_init()) < 0 || H5Pset_driver(fapl, driver, &fa) < 0) {
+        free(udata);
+        return NULL;
+    }
+    h5->mem.memio.memory = NULL; /* it stays the caller's */
+    h5->mem.memio.size = 0;
+    return udata;
+}
+
+/* Unregister the driver; called by NC_HDF5_finalize() */
+void
+NC4_image_term(void)
+{
+    if (H5FD_COW_g && (H5Iis_valid(H5FD_COW_g) > 0))
+        H5FDunregister(H5FD_COW_g);
+    H5FD_COW_g = 0;
+}
+
 hid_t
 NC4_image_init(NC_FILE_INFO_T* h5)
 {
@@ -750,6 +1110,13 @@ NC4_image_init(NC_FILE_INFO_T* h5)
     if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
         goto out;
 
+    if (h5->mem.copyonwrite && !create && (imageflags & H5LT_FILE_IMAGE_OPEN_RW)) {
+        /* Copy on write: the H5FD_cow driver reads the caller's memory */
+        if ((udata = cow_udata(h5, fapl)) == NULL)
+            goto out;
+        goto link;
+    }
+
     /* set allocation increment to a percentage of the supplied buffer size, or
      * a pre-defined minimum increment value, whichever is larger
      */
@@ -794,6 +1161,7 @@ NC4_image_init(NC_FILE_INFO_T* h5)
     if (H5Pset_file_image(fapl, udata->app_image_ptr, udata->app_image_size) < 0)
         goto out;
 
+link:
     /* Maintain a backward link */
     h5->mem.udata = (void*)udata;
     udata = NULL;
@@ -839,6 +1207,7 @@ NC4_image_finalize(void* _udata)
 {
     if(_udata != NULL) {
 	H5LT_file_image_ud_t *udata = (H5LT_file_image_ud_t*)_udata;
+	if(udata->cow) cow_free(udata);
         /* checks reference counts before deallocating udata */
 #if 0
         assert(udata->ref_count == 1 && udata->fapl_ref_count == 0 && udata->vfd_ref_count == 0);
@@ -865,6 +1234,14 @@ NC4_extract_file_image(NC_FILE_INFO_T* h5, int abort)
     } else {
         assert(udata != NULL);
 
+        if(udata->cow) {
+            /* Put together the caller's memory and the pages written */
+            h5->mem.memio.memory = cow_image(udata);
+            h5->mem.memio.size = udata->coweof;
+            cow_free(udata);
+            return (h5->mem.memio.memory == NULL ? NC_ENOMEM : NC_NOERR);
+        }
+
         /* Fill in h5->mem.memio from udata */
         h5->mem.memio.memory = udata->vfd_image_ptr;
         h5->mem.memio.size = udata->vfd_image_size;
@@ -72,6 +72,11 @@ EXTERNL int NC_s3sdkfinalize(void);
 int NC_initialized = 0;
 int NC_finalized = 1;
 
+#ifdef ENABLE_THREADSAFE
+/* Set while nc_initialize runs, to stop it from recursing */
+static int NC_initializing = 0;
+#endif
+
 #ifdef NETCDF_ENABLE_ATEXIT_FINALIZE
 /* Provide the void function to give to atexit() */
 static void
@@ -104,7 +109,19 @@ nc_initialize()
     int stat = NC_NOERR;
 
     if(NC_initialized) return NC_NOERR;
+#ifdef ENABLE_THREADSAFE
+    /* Other threads wait here until initialization is complete.
+       NC_initialized is only set at the end, so callers that test
+       it without the lock never see a half initialized library. */
+    NCLOCKLIBRARY();
+    if(NC_initialized || NC_initializing) {
+        NCUNLOCKLIBRARY();
+        return NC_NOERR;
+    }
+    NC_initializing = 1;
+#else
     NC_initialized = 1;
+#endif
     NC_finalized = 0;
 
     /* Do general initialization */
@@ -144,6 +161,11 @@ nc_initialize()
 #endif
 
 done:
+#ifdef ENABLE_THREADSAFE
+    NC_initialized = 1;
+    NC_initializing = 0;
+    NCUNLOCKLIBRARY();
+#endif
     return stat;
 }
 
@@ -172,6 +194,7 @@ nc_finalize(void)
     int stat = NC_NOERR;
     int failed = stat;
 
+    NCLOCKLIBRARY();
     if(NC_finalized) goto done;
     NC_initialized = 0;
     NC_finalized = 1;
@@ -215,6 +238,7 @@ nc_finalize(void)
     if((stat = NCDISPATCH_finalize())) failed = stat;
 
 done:
+    NCUNLOCKLIBRARY();
     if(failed) fprintf(stderr,"nc_finalize failed: %d\n",failed);
     return failed;
 }
@@ -41,7 +41,7 @@ free_NC_attr(NC_attr *attrp)
  * How much space will 'nelems' of 'type' take in
  *  external representation (as the values of an attribute)?
  */
-static size_t
+size_t
 ncx_len_NC_attrV(nc_type type, size_t nelems)
 {
 	switch(type) {
@@ -335,6 +335,23 @@ NC_attrarray0(NC3_INFO* ncp, int varid)
 }
 
 
+/* Attribute of ncap named name, of slen bytes, compared as is */
+static NC_attr **
+findattr(const NC_attrarray *ncap, const char *name, size_t slen)
+{
+	NC_attr **attrpp = (NC_attr **) ncap->value;
+	size_t attrid;
+
+	for(attrid = 0; attrid < ncap->nelems; attrid++, attrpp++)
+	{
+		/* nchars may be more than the length after a rename */
+		if(strlen((*attrpp)->name->cp) == slen &&
+			memcmp((*attrpp)->name->cp, name, slen) == 0)
+		        return attrpp;
+	}
+	return NULL;
+}
+
 /*
  * Step thru NC_ATTRIBUTE array, seeking match on name.
  *  return match or NULL if Not Found or out of memory.
@@ -343,7 +360,6 @@ NC_attr **
 NC_findattr(const NC_attrarray *ncap, const char *uname)
 {
 	NC_attr **attrpp = NULL;
-	size_t attrid;
 	size_t slen;
 	char *name = NULL;
 	int stat = NC_NOERR;
@@ -353,20 +369,18 @@ NC_findattr(const NC_attrarray *ncap, const char *uname)
 	if(ncap->nelems == 0)
 	    goto done;
 
+	/* Stored names are normalized, so uname only needs normalizing
+	   if it is not found as given and is not ASCII; see NC_findvar() */
+	slen = strlen(uname);
+	attrpp = findattr(ncap, uname, slen);
+	if(attrpp != NULL || nc_utf8_isascii((const unsigned char *)uname, slen))
+	    goto done;
+
 	/* normalized version of uname */
 	stat = nc_utf8_normalize((const unsigned char *)uname,(unsigned char**)&name);
 	if(stat != NC_NOERR)
 	    goto done; /* TODO: need better way to indicate no memory */
-	slen = strlen(name);
-
-	attrpp = (NC_attr **) ncap->value;
-	for(attrid = 0; attrid < ncap->nelems; attrid++, attrpp++)
-	{
-		if(strlen((*attrpp)->name->cp) == slen &&
-			strncmp((*attrpp)->name->cp, name, slen) == 0)
-		        goto done;
-	}
-	attrpp = NULL; /* not found */
+	attrpp = findattr(ncap, name, strlen(name));
 done:
         if(name) free(name);
         return (attrpp); /* Normal return */
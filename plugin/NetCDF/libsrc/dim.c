@@ -137,11 +137,16 @@ NC_finddim(const NC_dimarray *ncap, const char *uname, NC_dim **dimpp)
    assert(ncap != NULL);
    if(ncap->nelems == 0)
 	goto done;
-   /* normalized version of uname */
-  if(nc_utf8_normalize((const unsigned char *)uname,(unsigned char **)&name))
-	goto done;	 
-  if(NC_hashmapget(ncap->hashmap, name, strlen(name), &data) == 0)
-	goto done;
+   /* Only normalize uname if it is not stored as given and is not
+      ASCII; see NC_findvar() */
+  if(NC_hashmapget(ncap->hashmap, uname, strlen(uname), &data) == 0) {
+	if(nc_utf8_isascii((const unsigned char *)uname, strlen(uname)))
+	    goto done;
+	if(nc_utf8_normalize((const unsigned char *)uname,(unsigned char **)&name))
+	    goto done;
+	if(NC_hashmapget(ncap->hashmap, name, strlen(name), &data) == 0)
+	    goto done;
+  }
   dimid = (int)data;
   if(dimpp) *dimpp = ncap->value[dimid];
 
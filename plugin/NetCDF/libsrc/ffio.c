@@ -481,6 +481,8 @@ ncio_ffio_init(ncio *const nciop)
 	*((ncio_filesizefunc **)&nciop->filesize) = ncio_ffio_filesize; /* cast away const */
 	*((ncio_pad_lengthfunc **)&nciop->pad_length) = ncio_ffio_pad_length; /* cast away const */
 	*((ncio_closefunc **)&nciop->close) = ncio_ffio_close; /* cast away const */
+	*((ncio_getvfunc **)&nciop->getv) = NULL; /* cast away const */
+	*((ncio_getvfunc **)&nciop->putv) = NULL; /* cast away const */
 
 	ffp->pos = -1;
 	ffp->bf_offset = OFF_NONE;
@@ -527,6 +529,8 @@ ncio_ffio_new(const char *path, int ioflags)
 
 	nciop->ioflags = ioflags;
 	*((int *)&nciop->fd) = -1; /* cast away const */
+	nciop->concurrent = 0;
+	memset(&nciop->stats, 0, sizeof(nciop->stats));
 
 	nciop->path = (char *) ((char *)nciop + sz_ncio);
 	(void) strcpy((char *)nciop->path, path); /* cast away const */
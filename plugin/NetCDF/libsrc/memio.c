@@ -272,6 +272,7 @@ memio_create(const char* path, int ioflags,
     /* Allocate the memory for this file */
     memio->memory = (char*)malloc((size_t)memio->alloc);
     if(memio->memory == NULL) {status = NC_ENOMEM; goto unwind_open;}
+    memset(memio->memory,0,memio->size);
     memio->locked = 0;
 
 #ifdef DEBUG
@@ -352,9 +353,21 @@ memio_open(const char* path,
 	NC_memio* memparams = (NC_memio*)parameters;
         meminfo = *memparams;
         locked = fIsSet(meminfo.flags,NC_MEMIO_LOCKED);
+	if(fIsSet(meminfo.flags,NC_MEMIO_COPYONWRITE)) {
+	    /* Classic files are written in place, so writing one
+	       takes a private copy of the whole image */
+	    if(fIsSet(ioflags,NC_WRITE)) {
+		void* copy = malloc(meminfo.size);
+		if(copy == NULL) {status = NC_ENOMEM; goto unwind_open;}
+		memcpy(copy,meminfo.memory,meminfo.size);
+		meminfo.memory = copy;
+		locked = 0;
+	    } else
+		locked = 1;
+	}
 	/* As a safeguard, if !locked and NC_WRITE is set,
            then we must take control of the incoming memory */
-        if(!locked && fIsSet(ioflags,NC_WRITE)) {
+        else if(!locked && fIsSet(ioflags,NC_WRITE)) {
 	    memparams->memory = NULL;	    
 	}	
     } else { /* read the file into a chunk of memory*/
@@ -372,14 +385,20 @@ memio_open(const char* path,
     if(status != NC_NOERR)
 	{goto unwind_open;}
     memio->locked = locked;
+    if(diskless) { /* the whole file was read at once */
+	nciop->stats.reads = 1;
+	nciop->stats.bytes_read = meminfo.size;
+    }
 
     /* Initialize the memio memory */
     memio->memory = meminfo.memory;
 
     /* memio_new may have modified the allocated size, in which case,
-       reallocate the memory unless the memory is locked. */    
+       reallocate the memory unless the memory is locked or read only:
+       a read only file never grows, so keep the caller's memory
+       as it is rather than copying it to round its size up. */
     if(memio->alloc > meminfo.size) {
-	if(memio->locked)
+	if(memio->locked || !fIsSet(ioflags,NC_WRITE))
 	    memio->alloc = meminfo.size; /* force it back to what it was */
 	else {
 	   void* oldmem = memio->memory;
@@ -469,6 +488,10 @@ memio_pad_length(ncio* nciop, off_t length)
         /* Realloc the allocated memory to a multiple of the pagesize*/
 	size_t newsize = (size_t)len;
 	void* newmem = NULL;
+	/* Grow geometrically, so that a file written a record at a time
+	   is reallocated O(log n) times instead of once per record */
+	if(memio->alloc <= ((size_t)-1) / 2 && newsize < 2 * memio->alloc)
+	    newsize = 2 * memio->alloc;
 	/* Round to a multiple of pagesize */
 	if((newsize % pagesize) != 0)
 	    newsize += (pagesize - (newsize % pagesize));
@@ -484,8 +507,6 @@ memio_pad_length(ncio* nciop, off_t length)
 		return NC_EINMEMORY;
 	    }
         }
-	/* zero out the extra memory */
-        memset((void*)((char*)newmem+memio->alloc),0,(size_t)(newsize - memio->alloc));
 
 #ifdef DEBUG
 fprintf(stderr,"realloc: %lu/%lu -> %lu/%lu\n",
@@ -496,6 +517,10 @@ fprintf(stderr,"realloc: %lu/%lu -> %lu/%lu\n",
 	memio->alloc = newsize;
 	memio->modified = 1;
     }
+    /* zero out the extension; memory past size is zeroed only when
+       the file grows over it, not when it is allocated */
+    if(len > memio->size)
+        memset((void*)(memio->memory+memio->size),0,len - memio->size);
     memio->size = len;
     return NC_NOERR;
 }
@@ -549,8 +574,10 @@ guarantee(ncio* nciop, off_t endpoint0)
 	int status = memio_pad_length(nciop,endpoint0);
 	if(status != NC_NOERR) return status;
     }
-    if(memio->size < endpoint0)
+    if(memio->size < endpoint0) {
+	memset((void*)(memio->memory+memio->size),0,(size_t)endpoint0 - memio->size);
 	memio->size = (size_t)endpoint0;
+    }
     return NC_NOERR;
 }
 
@@ -567,6 +594,7 @@ memio_get(ncio* const nciop, off_t offset, size_t extent, int rflags, void** con
     memio = (NCMEMIO*)nciop->pvt;
     status = guarantee(nciop, offset+(off_t)extent);
     memio->locked++;
+    NCIO_STAT(nciop, cache_hits, 1);
     if(status != NC_NOERR) return status;
     if(vpp) *vpp = memio->memory+offset;
     return NC_NOERR;
@@ -661,6 +689,15 @@ memio_extract(ncio* const nciop, size_t* sizep, void** memoryp)
     if(sizep) *sizep = memio->size;
 
     if(memoryp && memio->memory != NULL) {
+	/* Give back the slack left by geometric growth; shrinking
+	   in place does not copy the memory */
+	if(!memio->locked && memio->size > 0 && memio->alloc - memio->size >= pagesize) {
+	    void* newmem = realloc(memio->memory,memio->size);
+	    if(newmem != NULL) {
+		memio->memory = newmem;
+		memio->alloc = memio->size;
+	    }
+	}
 	*memoryp = memio->memory;
 	memio->memory = NULL; /* make sure it does not get free'd */
     }
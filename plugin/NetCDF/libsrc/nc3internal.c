@@ -37,14 +37,35 @@
 /* Internal function; breaks ncio abstraction */
 extern int memio_extract(ncio* const nciop, size_t* sizep, void** memoryp);
 
+/*
+ * Free the dims, attrs and vars. Those of a file opened read only are
+ * in nc3->arena, but for the hash maps.
+ */
 static void
-free_NC3INFO(NC3_INFO *nc3)
+free_NC_header(NC3_INFO *nc3)
 {
-	if(nc3 == NULL)
+	if(nc3->arena != NULL)
+	{
+		NC_hashmapfree(nc3->dims.hashmap);
+		NC_hashmapfree(nc3->vars.hashmap);
+		(void) memset(&nc3->dims, 0, sizeof(nc3->dims));
+		(void) memset(&nc3->attrs, 0, sizeof(nc3->attrs));
+		(void) memset(&nc3->vars, 0, sizeof(nc3->vars));
+		NC3_arena_free(nc3->arena);
+		nc3->arena = NULL;
 		return;
+	}
 	free_NC_dimarrayV(&nc3->dims);
 	free_NC_attrarrayV(&nc3->attrs);
 	free_NC_vararrayV(&nc3->vars);
+}
+
+static void
+free_NC3INFO(NC3_INFO *nc3)
+{
+	if(nc3 == NULL)
+		return;
+	free_NC_header(nc3);
 	free(nc3);
 }
 
@@ -340,20 +361,15 @@ fprintf(stderr, "    REC %d %s: %ld\n", ii, (*vpp)->name->cp, (long)index);
 
 
 /*
- * Read just the numrecs member.
- * (A relatively expensive way to do things.)
+ * Read numrecs from the file into *nrecsp, leaving ncp alone.
  */
-int
-read_numrecs(NC3_INFO *ncp)
+static int
+fetch_numrecs(NC3_INFO *ncp, size_t *nrecsp)
 {
 	int status = NC_NOERR;
 	const void *xp = NULL;
-	size_t new_nrecs = 0;
-	size_t  old_nrecs = NC_get_numrecs(ncp);
 	size_t nc_numrecs_extent = NC_NUMRECS_EXTENT3; /* CDF-1 and CDF-2 */
 
-	assert(!NC_indef(ncp));
-
 	if (fIsSet(ncp->flags, NC_64BIT_DATA))
 		nc_numrecs_extent = NC_NUMRECS_EXTENT5; /* CDF-5 */
 
@@ -365,12 +381,30 @@ read_numrecs(NC3_INFO *ncp)
 	if (fIsSet(ncp->flags, NC_64BIT_DATA)) {
 	    unsigned long long tmp=0;
 	    status = ncx_get_uint64(&xp, &tmp);
-	    new_nrecs = (size_t)tmp;
+	    *nrecsp = (size_t)tmp;
         } else
-	    status = ncx_get_size_t(&xp, &new_nrecs);
+	    status = ncx_get_size_t(&xp, nrecsp);
 
 	(void) ncio_rel(ncp->nciop, NC_NUMRECS_OFFSET, 0);
 
+	return status;
+}
+
+/*
+ * Read just the numrecs member.
+ * (A relatively expensive way to do things.)
+ */
+int
+read_numrecs(NC3_INFO *ncp)
+{
+	int status = NC_NOERR;
+	size_t new_nrecs = 0;
+	size_t  old_nrecs = NC_get_numrecs(ncp);
+
+	assert(!NC_indef(ncp));
+
+	status = fetch_numrecs(ncp, &new_nrecs);
+
 	if(status == NC_NOERR && old_nrecs != new_nrecs)
 	{
 		NC_set_numrecs(ncp, new_nrecs);
@@ -414,12 +448,53 @@ write_numrecs(NC3_INFO *ncp)
 	(void) ncio_rel(ncp->nciop, NC_NUMRECS_OFFSET, RGN_MODIFIED);
 
 	if(status == NC_NOERR)
+	{
 		fClr(ncp->state, NC_NDIRTY);
+		ncp->synced_numrecs = NC_get_numrecs(ncp);
+		if(ncp->nsync_nsecs != 0)
+			ncp->synced_nsecs = NC_nanotime();
+	}
 
 	return status;
 }
 
 
+/*
+ * Called by NCvnrecs() before numrecs grows. Writes it if
+ * nc_set_numrecs_sync() asks for it now: nsync_recs records were
+ * added, or nsync_nsecs passed, since it was last written.
+ *
+ * The count written leaves out the record about to be added, so when
+ * each record is written whole before the next, it only counts whole
+ * records. And these are handed to the system before the count, so
+ * that whatever the file holds if the program dies, numrecs never
+ * counts records that were not written.
+ */
+int
+NC_numrecs_sync(NC3_INFO *ncp)
+{
+	int status;
+
+	if(ncp->nsync_recs == 0 && ncp->nsync_nsecs == 0)
+		return NC_NOERR;
+	if(ncp->nsync_recs == 0
+	   || NC_get_numrecs(ncp) - ncp->synced_numrecs < ncp->nsync_recs)
+	{
+		if(ncp->nsync_nsecs == 0
+		   || NC_nanotime() - ncp->synced_nsecs < ncp->nsync_nsecs)
+			return NC_NOERR;
+	}
+
+	status = ncio_sync(ncp->nciop);
+	if(status != NC_NOERR)
+		return status;
+	status = write_numrecs(ncp);
+	if(status != NC_NOERR)
+		return status;
+	return ncio_sync(ncp->nciop);
+}
+
+
 /*
  * Read in the header
  * It is expensive.
@@ -429,9 +504,7 @@ read_NC(NC3_INFO *ncp)
 {
 	int status = NC_NOERR;
 
-	free_NC_dimarrayV(&ncp->dims);
-	free_NC_attrarrayV(&ncp->attrs);
-	free_NC_vararrayV(&ncp->vars);
+	free_NC_header(ncp);
 
 	status = nc_get_NC(ncp);
 
@@ -455,7 +528,10 @@ write_NC(NC3_INFO *ncp)
 	status = ncx_put_NC(ncp, NULL, 0, 0);
 
 	if(status == NC_NOERR)
+	{
 		fClr(ncp->state, NC_NDIRTY | NC_HDIRTY);
+		ncp->synced_numrecs = NC_get_numrecs(ncp);
+	}
 
 	return status;
 }
@@ -1176,7 +1252,13 @@ NC3_open(const char *path, int ioflags, int basepe, size_t *chunksizehintp,
             goto unwind_alloc;
         }
 
-        status = ncio_open(path, ioflags, 0, 0, &nc3->chunk, parameters,
+	if(nc->fd >= 0) {
+	    /* nc_open already has the file open; the ncio takes the descriptor */
+	    status = ncio_openfd(path, nc->fd, ioflags, 0, 0, &nc3->chunk,
+			       &nc3->nciop, NULL);
+	    nc->fd = -1;
+	} else
+	    status = ncio_open(path, ioflags, 0, 0, &nc3->chunk, parameters,
 			       &nc3->nciop, NULL);
 	if(status)
 		goto unwind_alloc;
@@ -1198,6 +1280,7 @@ NC3_open(const char *path, int ioflags, int basepe, size_t *chunksizehintp,
 	status = nc_get_NC(nc3);
 	if(status != NC_NOERR)
 		goto unwind_ioc;
+	nc3->synced_numrecs = NC_get_numrecs(nc3);
 
 	if(chunksizehintp != NULL)
 		*chunksizehintp = nc3->chunk;
@@ -1205,6 +1288,9 @@ NC3_open(const char *path, int ioflags, int basepe, size_t *chunksizehintp,
 	/* Link nc3 and nc */
         NC3_DATA_SET(nc,nc3);
 	nc->int_ncid = nc3->nciop->fd;
+	/* The header of a read-only file never changes either, but for
+	   numrecs, see NC3_refresh_numrecs() */
+	nc->concurrentreads = nc3->nciop->concurrent;
 
 	return NC_NOERR;
 
@@ -1607,6 +1693,135 @@ NC3_inq_format_extended(int ncid, int *formatp, int *modep)
    return NC_NOERR;
 }
 
+/**
+ * Get the I/O statistics of a classic file. Called by
+ * nc_inq_io_stats().
+ *
+ * \param ncid The ID of an open file.
+ * \param statsp Pointer that gets the statistics.
+ *
+ * \returns ::NC_NOERR No error.
+ * \returns ::NC_EBADID Bad ncid.
+ */
+int
+NC3_inq_io_stats(int ncid, NC_io_stats *statsp)
+{
+   int status;
+   NC *nc;
+   NC3_INFO* nc3;
+
+   status = NC_check_id(ncid, &nc);
+   if(status != NC_NOERR)
+      return status;
+   nc3 = NC3_DATA(nc);
+   *statsp = nc3->nciop->stats;
+   statsp->mdc_hit_rate = -1;
+   return NC_NOERR;
+}
+
+/**
+ * Set the I/O statistics of a classic file to zero. Called by
+ * nc_reset_io_stats().
+ *
+ * \param ncid The ID of an open file.
+ *
+ * \returns ::NC_NOERR No error.
+ * \returns ::NC_EBADID Bad ncid.
+ */
+int
+NC3_reset_io_stats(int ncid)
+{
+   int status;
+   NC *nc;
+   NC3_INFO* nc3;
+
+   status = NC_check_id(ncid, &nc);
+   if(status != NC_NOERR)
+      return status;
+   nc3 = NC3_DATA(nc);
+   memset(&nc3->nciop->stats, 0, sizeof(nc3->nciop->stats));
+   return NC_NOERR;
+}
+
+/**
+ * Set when the number of records of a classic file is written. Called
+ * by nc_set_numrecs_sync().
+ *
+ * \param ncid The ID of an open file.
+ * \param nrecs Write it after this many records are added, or 0.
+ * \param msecs Write it this many milliseconds after the last time, or 0.
+ *
+ * \returns ::NC_NOERR No error.
+ * \returns ::NC_EBADID Bad ncid.
+ * \returns ::NC_EPERM File is read only.
+ */
+int
+NC3_set_numrecs_sync(int ncid, size_t nrecs, int msecs)
+{
+   int status;
+   NC *nc;
+   NC3_INFO* nc3;
+
+   status = NC_check_id(ncid, &nc);
+   if(status != NC_NOERR)
+      return status;
+   nc3 = NC3_DATA(nc);
+   if(NC_readonly(nc3))
+      return NC_EPERM;
+   /* replaces writing numrecs at every change for NC_SHARE, until both
+      limits are set back to zero */
+   if(nrecs == 0 && msecs == 0 && fIsSet(nc3->nciop->ioflags, NC_SHARE))
+      fSet(nc3->state, NC_NSYNC);
+   else
+      fClr(nc3->state, NC_NSYNC);
+   nc3->nsync_recs = nrecs;
+   nc3->nsync_nsecs = (unsigned long long)msecs * 1000000ULL;
+   nc3->synced_nsecs = NC_nanotime();
+   return NC_NOERR;
+}
+
+/**
+ * Re-read the number of records of a classic file opened read only.
+ * Called by nc_refresh_numrecs().
+ *
+ * \param ncid The ID of an open file.
+ * \param numrecsp Pointer that gets the number of records, or NULL.
+ *
+ * \returns ::NC_NOERR No error.
+ * \returns ::NC_EBADID Bad ncid.
+ */
+int
+NC3_refresh_numrecs(int ncid, size_t *numrecsp)
+{
+   int status;
+   NC *nc;
+   NC3_INFO* nc3;
+
+   status = NC_check_id(ncid, &nc);
+   if(status != NC_NOERR)
+      return status;
+   nc3 = NC3_DATA(nc);
+   /* Data reads that take no lock may look at numrecs meanwhile, so
+      only numrecs is stored, atomically: they see the old or the new
+      count, both valid as records are only added by the writer. */
+   if(NC_readonly(nc3)) {
+      size_t nrecs;
+      /* Drop what the buffered ncio holds, the count included */
+      if(!nc3->nciop->concurrent) {
+         status = ncio_sync(nc3->nciop);
+         if(status != NC_NOERR)
+            return status;
+      }
+      status = fetch_numrecs(nc3, &nrecs);
+      if(status != NC_NOERR)
+         return status;
+      NC_set_numrecs(nc3, nrecs);
+   }
+   if(numrecsp != NULL)
+      *numrecsp = NC_get_numrecs(nc3);
+   return NC_NOERR;
+}
+
 /**
  * Determine name and size of netCDF type. This netCDF-4 function
  * proved so popular that a netCDF-classic version is provided. You're
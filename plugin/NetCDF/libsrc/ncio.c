@@ -8,6 +8,13 @@
 #endif
 
 #include <stdlib.h>
+#include <string.h>
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#ifdef _WIN32
+#include <io.h>
+#endif
 
 #include "netcdf.h"
 #include "ncio.h"
@@ -24,6 +31,7 @@
 /* Define known ncio packages */
 extern int posixio_create(const char*,int,size_t,off_t,size_t,size_t*,void*,ncio**,void** const);
 extern int posixio_open(const char*,int,off_t,size_t,size_t*,void*,ncio**,void** const);
+extern int posixio_openfd(const char*,int,int,off_t,size_t,size_t*,ncio**,void** const);
 
 extern int stdio_create(const char*,int,size_t,off_t,size_t,size_t*,void*,ncio**,void** const);
 extern int stdio_open(const char*,int,off_t,size_t,size_t*,void*,ncio**,void** const);
@@ -124,6 +132,22 @@ ncio_open(const char *path, int ioflags,
 #endif
 }
 
+/* Open path on fd, a descriptor open for reading that nc_open() used to
+   read the magic number; see ncio.h */
+int
+ncio_openfd(const char *path, int fd, int ioflags,
+            off_t igeto, size_t igetsz, size_t *sizehintp,
+            ncio** iopp, void** const mempp)
+{
+#ifndef USE_FFIO
+    if(!fIsSet(ioflags,NC_WRITE|NC_DISKLESS|NC_INMEMORY|NC_MMAP))
+        return posixio_openfd(path,fd,ioflags,igeto,igetsz,sizehintp,iopp,mempp);
+#endif
+    /* Other packages open the file themselves */
+    (void)close(fd);
+    return ncio_open(path,ioflags,igeto,igetsz,sizehintp,NULL,iopp,mempp);
+}
+
 /**************************************************/
 /* wrapper functions for the ncio dispatch table */
 
@@ -137,6 +161,7 @@ int
 ncio_get(ncio* const nciop, off_t offset, size_t extent,
 			int rflags, void **const vpp)
 {
+    NCIO_STAT(nciop, gets, 1);
     return nciop->get(nciop,offset,extent,rflags,vpp);
 }
 
@@ -164,6 +189,53 @@ ncio_pad_length(ncio* const nciop, off_t length)
     return nciop->pad_length(nciop,length);
 }
 
+/* Packages without getv() or putv() go through get() one run at a time */
+int
+ncio_getv(ncio* const nciop, size_t nruns, const off_t* offsets,
+          const size_t* lengths, void* buf)
+{
+    size_t i;
+    char* cp = (char*)buf;
+    if(nciop->getv != NULL) {
+        NCIO_STAT(nciop, gets, 1);
+        return nciop->getv(nciop,nruns,offsets,lengths,buf);
+    }
+    for(i = 0; i < nruns; i++) {
+        void* xp;
+        int status = ncio_get(nciop,offsets[i],lengths[i],0,&xp);
+        if(status != NC_NOERR)
+            return status;
+        memcpy(cp,xp,lengths[i]);
+        (void)ncio_rel(nciop,offsets[i],0);
+        cp += lengths[i];
+    }
+    return NC_NOERR;
+}
+
+int
+ncio_putv(ncio* const nciop, size_t nruns, const off_t* offsets,
+          const size_t* lengths, void* buf)
+{
+    size_t i;
+    const char* cp = (const char*)buf;
+    if(nciop->putv != NULL) {
+        /* Not a get: the package counts its writes and bytes_written */
+        return nciop->putv(nciop,nruns,offsets,lengths,buf);
+    }
+    for(i = 0; i < nruns; i++) {
+        void* xp;
+        int status = ncio_get(nciop,offsets[i],lengths[i],RGN_WRITE,&xp);
+        if(status != NC_NOERR)
+            return status;
+        memcpy(xp,cp,lengths[i]);
+        status = ncio_rel(nciop,offsets[i],RGN_MODIFIED);
+        if(status != NC_NOERR)
+            return status;
+        cp += lengths[i];
+    }
+    return NC_NOERR;
+}
+
 int
 ncio_close(ncio* const nciop, int doUnlink)
 {
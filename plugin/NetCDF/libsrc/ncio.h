@@ -10,6 +10,7 @@
 #include <stddef.h>	/* size_t */
 #include <sys/types.h>	/* off_t */
 #include "netcdf.h"
+#include "ncutil.h"	/* NC_nanotime() */
 
 /* Define internal use only flags to signal use of byte ranges and S3. */
 #define NC_HTTP  1
@@ -95,6 +96,19 @@ typedef int ncio_filesizefunc(ncio *nciop, off_t *filesizep);
 */
 typedef int ncio_closefunc(ncio *nciop, int doUnlink);
 
+/*
+ * Read (getv) or write (putv) the nruns regions (offsets[i], lengths[i])
+ * of the file, in increasing offset order and not overlapping, from or
+ * to buf, where they are packed one after the other. Regions past the
+ * end of the file read as zeros. Unlike get(), the data moves straight
+ * between the file and buf, so a strided hyperslab needs a few system
+ * calls instead of one per run. Packages that keep the file in memory
+ * leave them NULL.
+ */
+typedef int ncio_getvfunc(ncio *const nciop, size_t nruns,
+			const off_t *offsets, const size_t *lengths,
+			void *buf);
+
 /* Get around cplusplus "const xxx in class ncio without constructor" error */
 #if defined(__cplusplus)
 #define NCIO_CONST
@@ -134,6 +148,10 @@ struct ncio {
   
 	ncio_closefunc *NCIO_CONST close;
 
+	/* optional, see ncio_getvfunc */
+	ncio_getvfunc *NCIO_CONST getv;
+	ncio_getvfunc *NCIO_CONST putv;
+
 	/*
 	 * A copy of the 'path' argument passed in to ncio_open()
 	 * or ncio_create(). Used by ncabort() to remove (unlink)
@@ -141,12 +159,57 @@ struct ncio {
 	 */
 	const char *path;
 
+	/*
+	 * True if get() and rel() keep no state in the ncio, so
+	 * that several threads may read through it at the same time.
+	 */
+	int concurrent;
+
+	/*
+	 * I/O statistics, see nc_inq_io_stats().
+	 * Update them with NCIO_STAT().
+	 */
+	NC_io_stats stats;
+
 	/* implementation private stuff */
 	void *pvt;
 };
 
 #undef NCIO_CONST
 
+/*
+ * Add n to one of the counters in nciop->stats. When several threads
+ * may read through the ncio at once the addition is atomic.
+ */
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define NCIO_ATOMIC_ADD(p,n) _InterlockedExchangeAdd64((volatile __int64*)(p),(__int64)(n))
+#else
+#define NCIO_ATOMIC_ADD(p,n) __atomic_fetch_add((p),(unsigned long long)(n),__ATOMIC_RELAXED)
+#endif
+#define NCIO_STAT(nciop,field,n) \
+	((nciop)->concurrent ? (void)NCIO_ATOMIC_ADD(&(nciop)->stats.field,(n)) \
+	                     : (void)((nciop)->stats.field += (unsigned long long)(n)))
+
+/*
+ * Conversions of less than this many bytes are not timed, so that
+ * reading single values does not pay for the clock.
+ */
+#define NCIO_MIN_TIMED 4096
+
+/* Run stmt, a conversion of extent bytes, adding its time to
+   nciop->stats.convert_nsecs. */
+#define NCIO_TIMED(nciop,extent,stmt) \
+	do { \
+		if((extent) < NCIO_MIN_TIMED) { \
+			stmt; \
+		} else { \
+			const unsigned long long t0_ = NC_nanotime(); \
+			stmt; \
+			NCIO_STAT((nciop), convert_nsecs, NC_nanotime() - t0_); \
+		} \
+	} while(0)
+
 /* Define wrappers around the ncio dispatch table */
 
 extern int ncio_rel(ncio* const, off_t, int);
@@ -156,6 +219,8 @@ extern int ncio_sync(ncio* const);
 extern int ncio_filesize(ncio* const, off_t*);
 extern int ncio_pad_length(ncio* const, off_t);
 extern int ncio_close(ncio* const, int);
+extern int ncio_getv(ncio* const, size_t, const off_t*, const size_t*, void*);
+extern int ncio_putv(ncio* const, size_t, const off_t*, const size_t*, void*);
 
 extern int ncio_create(const char *path, int ioflags, size_t initialsz,
                        off_t igeto, size_t igetsz, size_t *sizehintp,
@@ -167,6 +232,14 @@ extern int ncio_open(const char *path, int ioflags,
 		     void* parameters, /* new */
                      ncio** nciopp, void** const mempp);
 
+/* Same as ncio_open(), for a file that nc_open() has already opened
+   read-only as fd to look at its magic number. The descriptor belongs
+   to the ncio from now on; it is closed if the ncio package opens the
+   file again itself (writable, diskless, mmap), or on failure. */
+extern int ncio_openfd(const char *path, int fd, int ioflags,
+                       off_t igeto, size_t igetsz, size_t *sizehintp,
+                       ncio** nciopp, void** const mempp);
+
 /* With the advent of diskless io, we need to provide
    for multiple ncio packages at the same time,
    so we have multiple versions of ncio_create.
@@ -38,6 +38,12 @@
 #include <unistd.h>
 #endif
 
+/* preadv() and pwritev(), for ncio_px_getv() and ncio_px_putv() */
+#if !defined(_WIN32) && !defined(__APPLE__)
+#include <sys/uio.h>
+#define PX_VECTORED 1
+#endif
+
 #ifndef NC_NOERR
 #define NC_NOERR 0
 #endif
@@ -52,6 +58,7 @@
 #include "ncio.h"
 #include "fbits.h"
 #include "rnd.h"
+#include "ncthreads.h"
 
 /* #define INSTRUMENT 1 */
 #if INSTRUMENT /* debugging */
@@ -94,6 +101,8 @@ static int ncio_px_filesize(ncio *nciop, off_t *filesizep);
 static int ncio_px_pad_length(ncio *nciop, off_t length);
 static int ncio_px_close(ncio *nciop, int doUnlink);
 static int ncio_spx_close(ncio *nciop, int doUnlink);
+extern int posixio_openfd(const char *path, int fd, int ioflags, off_t igeto, size_t igetsz,
+	size_t *sizehintp, ncio **nciopp, void **const igetvpp);
 
 
 /*
@@ -310,6 +319,8 @@ px_pgout(ncio *const nciop,
 	nextent = extent;
         nvp = vp;
 	while((partial = write(nciop->fd, nvp, nextent)) != -1) {
+	    NCIO_STAT(nciop, writes, 1);
+	    NCIO_STAT(nciop, bytes_written, partial);
 	    if(partial == nextent)
 		break;
 	    nvp += partial;
@@ -382,7 +393,10 @@ px_pgin(ncio *const nciop,
        (according to the comment below, at least). */
     do {
       nread = read(nciop->fd,vp,extent);
+      NCIO_STAT(nciop, reads, 1);
     } while (nread == -1 && errno == EINTR);
+    if(nread > 0)
+      NCIO_STAT(nciop, bytes_read, nread);
 
 
     if(nread != (ssize_t)extent) {
@@ -790,7 +804,16 @@ ncio_px_get(ncio *const nciop,
 		free(pxp->slave);
 		pxp->slave = NULL;
 	}
-	return px_get(nciop, pxp, offset, extent, rflags, vpp);
+	{
+		/* A request that reads nothing was served by the buffer */
+		const unsigned long long reads = nciop->stats.reads;
+		const int status = px_get(nciop, pxp, offset, extent, rflags, vpp);
+		if(nciop->stats.reads == reads)
+			NCIO_STAT(nciop, cache_hits, 1);
+		else
+			NCIO_STAT(nciop, cache_misses, 1);
+		return status;
+	}
 }
 
 
@@ -1084,6 +1107,177 @@ ncio_px_init2(ncio *const nciop, size_t *sizehintp, int isNew)
 }
 
 
+#ifdef PX_VECTORED
+/* Begin vectored */
+
+/* iovecs per preadv() or pwritev() call */
+#define PX_IOVMAX 256
+/* Runs of a getv() at most this many bytes apart are read in one call,
+   the bytes in between going to a scratch buffer */
+#define PX_MAXGAP 8192
+
+/* preadv() of niov iovecs starting at offset. As in px_pread(), bytes
+   past the end of the file are set to zero. iov is used up. */
+static int
+px_preadv(ncio *const nciop, struct iovec *iov, int niov, off_t offset)
+{
+	while(niov > 0)
+	{
+		ssize_t nread = preadv(nciop->fd, iov, niov, offset);
+		NCIO_STAT(nciop, reads, 1);
+		if(nread < 0)
+		{
+			if(errno == EINTR)
+				continue;
+			return errno;
+		}
+		if(nread == 0)
+		{
+			/* short file */
+			for(; niov > 0; iov++, niov--)
+				(void) memset(iov->iov_base, 0, iov->iov_len);
+			break;
+		}
+		NCIO_STAT(nciop, bytes_read, nread);
+		offset += (off_t)nread;
+		for(; niov > 0 && (size_t)nread >= iov->iov_len; iov++, niov--)
+			nread -= (ssize_t)iov->iov_len;
+		if(nread > 0)
+		{
+			iov->iov_base = (char *)iov->iov_base + nread;
+			iov->iov_len -= (size_t)nread;
+		}
+	}
+	return NC_NOERR;
+}
+
+/* pwritev() of niov iovecs starting at offset. iov is used up. */
+static int
+px_pwritev(ncio *const nciop, struct iovec *iov, int niov, off_t offset)
+{
+	while(niov > 0)
+	{
+		ssize_t nwritten = pwritev(nciop->fd, iov, niov, offset);
+		NCIO_STAT(nciop, writes, 1);
+		if(nwritten < 0)
+		{
+			if(errno == EINTR)
+				continue;
+			return errno;
+		}
+		NCIO_STAT(nciop, bytes_written, nwritten);
+		offset += (off_t)nwritten;
+		for(; niov > 0 && (size_t)nwritten >= iov->iov_len; iov++, niov--)
+			nwritten -= (ssize_t)iov->iov_len;
+		if(nwritten > 0)
+		{
+			iov->iov_base = (char *)iov->iov_base + nwritten;
+			iov->iov_len -= (size_t)nwritten;
+		}
+	}
+	return NC_NOERR;
+}
+
+/* Read the runs straight into buf, bypassing the buffer of the ncio_px
+   after writing it out if dirty. Runs close to each other are read by
+   one preadv(). Keeps no state, so it also serves read-only files
+   read concurrently (ncio_rpx_get()). */
+static int
+ncio_px_getv(ncio *const nciop, size_t nruns,
+		const off_t *offsets, const size_t *lengths, void *buf)
+{
+	ncio_px *const pxp = (ncio_px *)nciop->pvt;
+	struct iovec iov[PX_IOVMAX];
+	char gap[PX_MAXGAP];
+	char *cp = (char *)buf;
+	size_t i = 0;
+	int status;
+
+	if(fIsSet(pxp->bf_rflags, RGN_MODIFIED))
+	{
+		status = ncio_px_sync(nciop);
+		if(status != NC_NOERR)
+			return status;
+	}
+
+	while(i < nruns)
+	{
+		const off_t offset = offsets[i];
+		int niov = 0;
+		for(;;)
+		{
+			off_t end;
+			iov[niov].iov_base = cp;
+			iov[niov].iov_len = lengths[i];
+			niov++;
+			cp += lengths[i];
+			end = offsets[i] + (off_t)lengths[i];
+			if(++i == nruns || niov + 2 > PX_IOVMAX)
+				break;
+			if(offsets[i] < end || offsets[i] - end > PX_MAXGAP)
+				break;
+			if(offsets[i] > end)
+			{
+				iov[niov].iov_base = gap;
+				iov[niov].iov_len = (size_t)(offsets[i] - end);
+				niov++;
+			}
+		}
+		status = px_preadv(nciop, iov, niov, offset);
+		if(status != NC_NOERR)
+			return status;
+	}
+	return NC_NOERR;
+}
+
+/* Write the runs from buf straight to the file, a pwritev() per set
+   of adjacent runs, after writing out the buffer of the ncio_px and
+   dropping it, as it may hold old copies of them. */
+static int
+ncio_px_putv(ncio *const nciop, size_t nruns,
+		const off_t *offsets, const size_t *lengths, void *buf)
+{
+	ncio_px *const pxp = (ncio_px *)nciop->pvt;
+	struct iovec iov[PX_IOVMAX];
+	char *cp = (char *)buf;
+	size_t i = 0;
+	int status;
+
+	if(!fIsSet(nciop->ioflags, NC_WRITE))
+		return EPERM; /* attempt to write readonly file */
+	assert(pxp->bf_refcount <= 0);
+
+	status = ncio_px_sync(nciop);
+	if(status != NC_NOERR)
+		return status;
+	pxp->bf_offset = OFF_NONE;
+	pxp->bf_cnt = 0;
+	if(pxp->slave != NULL)
+		pxp->slave->bf_offset = OFF_NONE;
+
+	while(i < nruns)
+	{
+		const off_t offset = offsets[i];
+		int niov = 0;
+		do {
+			iov[niov].iov_base = cp;
+			iov[niov].iov_len = lengths[i];
+			niov++;
+			cp += lengths[i];
+			i++;
+		} while(i < nruns && niov < PX_IOVMAX
+			&& offsets[i] == offsets[i-1] + (off_t)lengths[i-1]);
+		status = px_pwritev(nciop, iov, niov, offset);
+		if(status != NC_NOERR)
+			return status;
+	}
+	return NC_NOERR;
+}
+
+/* End vectored */
+#endif /* PX_VECTORED */
+
+
 /* This is the first of a two-part initialization of the ncio struct.
    Here the rel, get, move, sync, and free function pointers are set
    to their POSIX non-NC_SHARE functions (ncio_px_*).
@@ -1102,6 +1296,13 @@ ncio_px_init(ncio *const nciop)
 	*((ncio_filesizefunc **)&nciop->filesize) = ncio_px_filesize; /* cast away const */
 	*((ncio_pad_lengthfunc **)&nciop->pad_length) = ncio_px_pad_length; /* cast away const */
 	*((ncio_closefunc **)&nciop->close) = ncio_px_close; /* cast away const */
+#ifdef PX_VECTORED
+	*((ncio_getvfunc **)&nciop->getv) = ncio_px_getv; /* cast away const */
+	*((ncio_getvfunc **)&nciop->putv) = ncio_px_putv; /* cast away const */
+#else
+	*((ncio_getvfunc **)&nciop->getv) = NULL; /* cast away const */
+	*((ncio_getvfunc **)&nciop->putv) = NULL; /* cast away const */
+#endif
 
 	pxp->blksz = 0;
 	pxp->pos = -1;
@@ -1246,6 +1447,7 @@ ncio_spx_get(ncio *const nciop,
 		pxp->bf_extent = extent;
 	}
 
+	NCIO_STAT(nciop, cache_misses, 1);
 	status = px_pgin(nciop, offset,
 		 extent,
 		 pxp->bf_base,
@@ -1479,6 +1681,8 @@ ncio_spx_init(ncio *const nciop)
 	*((ncio_filesizefunc **)&nciop->filesize) = ncio_px_filesize; /* cast away const */
 	*((ncio_pad_lengthfunc **)&nciop->pad_length) = ncio_px_pad_length; /* cast away const */
 	*((ncio_closefunc **)&nciop->close) = ncio_spx_close; /* cast away const */
+	*((ncio_getvfunc **)&nciop->getv) = NULL; /* cast away const */
+	*((ncio_getvfunc **)&nciop->putv) = NULL; /* cast away const */
 
 	pxp->pos = -1;
 	pxp->bf_offset = OFF_NONE;
@@ -1488,6 +1692,101 @@ ncio_spx_init(ncio *const nciop)
 }
 
 
+#ifdef ENABLE_THREADSAFE
+/* Begin concurrent read-only */
+
+/* Read extent bytes at offset without using or moving the file
+   position, so that several threads can read the same fd at once.
+   Bytes past the end of the file are set to zero. */
+static int
+px_pread(ncio *const nciop, off_t offset, size_t extent, void *const vp)
+{
+	const int fd = nciop->fd;
+	char *cp = (char *)vp;
+	while(extent > 0)
+	{
+#ifdef _WIN32
+		OVERLAPPED ov;
+		DWORD nread = 0;
+		DWORD n = (DWORD)(extent > 0x40000000 ? 0x40000000 : extent);
+		memset(&ov, 0, sizeof(ov));
+		ov.Offset = (DWORD)((uint64_t)offset & 0xFFFFFFFF);
+		ov.OffsetHigh = (DWORD)((uint64_t)offset >> 32);
+		NCIO_STAT(nciop, reads, 1);
+		if(!ReadFile((HANDLE)_get_osfhandle(fd), cp, n, &nread, &ov))
+		{
+			if(GetLastError() != ERROR_HANDLE_EOF)
+				return EIO;
+			nread = 0;
+		}
+#else
+		ssize_t nread = pread(fd, cp, extent, offset);
+		NCIO_STAT(nciop, reads, 1);
+		if(nread < 0)
+		{
+			if(errno == EINTR)
+				continue;
+			return errno;
+		}
+#endif
+		if(nread == 0)
+		{
+			/* short file: same as px_pgin */
+			(void) memset(cp, 0, extent);
+			break;
+		}
+		NCIO_STAT(nciop, bytes_read, nread);
+		cp += nread;
+		offset += (off_t)nread;
+		extent -= (size_t)nread;
+	}
+	return NC_NOERR;
+}
+
+/* In the thread-safe build, read-only files opened without NC_SHARE
+   never change, so every region is read straight from the file into a
+   scratch buffer private to the calling thread, and no state is kept
+   in the ncio_px. The
+   buffer is reused by the next get on the same thread, which is fine
+   because readers release each region before asking for the next.
+   As nothing is cached, records appended by another process are read
+   as soon as nc_refresh_numrecs() counts them. */
+static int
+ncio_rpx_get(ncio *const nciop,
+		off_t offset, size_t extent,
+		int rflags,
+		void **const vpp)
+{
+	void *buf;
+	int status;
+
+	if(fIsSet(rflags, RGN_WRITE))
+		return EPERM; /* attempt to write readonly file */
+
+	if((buf = ncthreadbuffer(extent)) == NULL)
+		return ENOMEM;
+	NCIO_STAT(nciop, cache_misses, 1);
+	if((status = px_pread(nciop, offset, extent, buf)) != NC_NOERR)
+		return status;
+	*vpp = buf;
+	return NC_NOERR;
+}
+
+/*ARGSUSED*/
+static int
+ncio_rpx_rel(ncio *const nciop, off_t offset, int rflags)
+{
+	NC_UNUSED(nciop);
+	NC_UNUSED(offset);
+	if(fIsSet(rflags, RGN_MODIFIED))
+		return EPERM; /* attempt to write readonly file */
+	return NC_NOERR;
+}
+
+/* End concurrent read-only */
+#endif /*ENABLE_THREADSAFE*/
+
+
 /* */
 
 /* This will call whatever free function is attached to the free
@@ -1543,6 +1842,8 @@ ncio_px_new(const char *path, int ioflags)
 
 	nciop->ioflags = ioflags;
 	*((int *)&nciop->fd) = -1; /* cast away const */
+	nciop->concurrent = 0;
+	memset(&nciop->stats, 0, sizeof(nciop->stats));
 
 	nciop->path = (char *) ((char *)nciop + sz_ncio);
 	(void) strcpy((char *)nciop->path, path); /* cast away const */
@@ -1741,30 +2042,56 @@ posixio_open(const char *path,
 	off_t igeto, size_t igetsz, size_t *sizehintp,
         void* parameters,
 	ncio **nciopp, void **const igetvpp)
+{
+	NC_UNUSED(parameters);
+	return posixio_openfd(path, -1, ioflags, igeto, igetsz, sizehintp,
+			      nciopp, igetvpp);
+}
+
+/*
+ * Same as posixio_open(), on the file descriptor fd if it is not -1.
+ * The descriptor, opened by nc_open() to read the magic number, is
+ * owned by the ncio from now on, and closed on failure.
+ */
+int
+posixio_openfd(const char *path,
+	int fd,
+	int ioflags,
+	off_t igeto, size_t igetsz, size_t *sizehintp,
+	ncio **nciopp, void **const igetvpp)
 {
 	ncio *nciop;
 	int oflags = fIsSet(ioflags, NC_WRITE) ? O_RDWR : O_RDONLY;
-	int fd = -1;
 	int status = 0;
-	NC_UNUSED(parameters);
 
 	if(path == NULL || *path == 0)
+	{
+		if(fd >= 0)
+			(void) close(fd);
 		return EINVAL;
+	}
 
 	nciop = ncio_px_new(path, ioflags);
 	if(nciop == NULL)
+	{
+		if(fd >= 0)
+			(void) close(fd);
 		return ENOMEM;
+	}
 
 #ifdef O_BINARY
 	/*#if _MSC_VER*/
 	fSet(oflags, O_BINARY);
 #endif
 
+	if(fd < 0)
+	{
 #ifdef vms
-	fd = NCopen3(path, oflags, 0, "ctx=stm");
+		fd = NCopen3(path, oflags, 0, "ctx=stm");
 #else
-	fd = NCopen3(path, oflags, 0);
+		fd = NCopen3(path, oflags, 0);
 #endif
+	}
 	if(fd < 0)
 	{
 		status = errno ? errno : ENOENT;
@@ -1795,6 +2122,18 @@ posixio_open(const char *path,
 	if(status != NC_NOERR)
 		goto unwind_open;
 
+#ifdef ENABLE_THREADSAFE
+	if(!fIsSet(nciop->ioflags, NC_WRITE) && !fIsSet(nciop->ioflags, NC_SHARE))
+	{
+		/* Nothing is ever written, so reads may run concurrently.
+		   Only where they can: without the buffer of the ncio_px,
+		   small reads cost a system call each. */
+		*((ncio_relfunc **)&nciop->rel) = ncio_rpx_rel; /* cast away const */
+		*((ncio_getfunc **)&nciop->get) = ncio_rpx_get; /* cast away const */
+		nciop->concurrent = 1;
+	}
+#endif
+
 	if(igetsz != 0)
 	{
 		status = nciop->get(nciop,
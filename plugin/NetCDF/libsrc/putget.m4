@@ -28,15 +28,16 @@ dnl
 #include "ncx.h"
 #include "fbits.h"
 #include "onstack.h"
+#include "ncthreads.h"
 
 #undef MIN  /* system may define MIN somewhere and complain */
 #define MIN(mm,nn) (((mm) < (nn)) ? (mm) : (nn))
 
 static int
-readNCv(const NC3_INFO* ncp, const NC_var* varp, const size_t* start,
+readNCv(const NC3_INFO* ncp, const NC_var* varp, off_t offset,
         const size_t nelems, void* value, const nc_type memtype);
 static int
-writeNCv(NC3_INFO* ncp, const NC_var* varp, const size_t* start,
+writeNCv(NC3_INFO* ncp, const NC_var* varp, off_t offset,
          const size_t nelems, const void* value, const nc_type memtype);
 
 
@@ -399,7 +400,10 @@ NCvnrecs(NC3_INFO* ncp, size_t numrecs)
 
 	if(numrecs > NC_get_numrecs(ncp))
 	{
-
+		/* The records so far may be due to be counted in the file */
+		status = NC_numrecs_sync(ncp);
+		if(status != NC_NOERR)
+			goto common_return;
 
 #if TOUCH_LAST
 		status = NCtouchlast(ncp,
@@ -623,10 +627,28 @@ NC_varoffset(const NC3_INFO* ncp, const NC_var *varp, const size_t *coord)
 	}
 }
 
+/*
+ * Bytes moved by each ncio_get() of the kernels below. Buffered ncios
+ * hand out at most ncp->chunk bytes. Those that keep no state (classic
+ * files opened read only) read any extent straight into a scratch
+ * buffer, so they are given blocks that still fit in L2 cache when
+ * converted: far fewer calls than chunk sized steps, and the data
+ * does not leave the cache between the read and the conversion.
+ */
+#define NC_CONVBLOCK 262144
+
+static size_t
+NCstepsize(const NC3_INFO* ncp)
+{
+	if(ncp->nciop->concurrent && ncp->chunk < NC_CONVBLOCK)
+		return NC_CONVBLOCK;
+	return ncp->chunk;
+}
+
 
 dnl
 dnl Output 'nelems' items of contiguous data of type "Type"
-dnl for variable 'varp' at 'start'.
+dnl for variable 'varp' at file offset 'offset'.
 dnl "Xtype" had better match 'varp->type'.
 dnl---
 dnl
@@ -636,13 +658,16 @@ define(`PUTNCVX',dnl
 `dnl
 static int
 putNCvx_$1_$2(NC3_INFO* ncp, const NC_var *varp,
-		 const size_t *start, size_t nelems, const $2 *value)
+		 off_t offset, size_t nelems, const $2 *value)
 {
-	off_t offset = NC_varoffset(ncp, varp, start);
+	const size_t step = NCstepsize(ncp);
 	size_t remaining = varp->xsz * nelems;
 	int status = NC_NOERR;
 	void *xp;
         void *fillp=NULL;
+#ifdef ERANGE_FILL
+        double fillv; /* no external type is wider */
+#endif
 
 	NC_UNUSED(fillp);
 
@@ -652,13 +677,13 @@ putNCvx_$1_$2(NC3_INFO* ncp, const NC_var *varp,
 	assert(value != NULL);
 
 #ifdef ERANGE_FILL
-        fillp = malloc(varp->xsz);
+        fillp = &fillv;
         status = NC3_inq_var_fill(varp, fillp);
 #endif
 
 	for(;;)
 	{
-		size_t extent = MIN(remaining, ncp->chunk);
+		size_t extent = MIN(remaining, step);
 		size_t nput = ncx_howmany(varp->type, extent);
 
 		int lstatus = ncio_get(ncp->nciop, offset, extent,
@@ -666,7 +691,7 @@ putNCvx_$1_$2(NC3_INFO* ncp, const NC_var *varp,
 		if(lstatus != NC_NOERR)
 			return lstatus;
 
-		lstatus = ncx_putn_$1_$2(&xp, nput, value ifelse(`$1',`char',,`,fillp'));
+		NCIO_TIMED(ncp->nciop, extent, lstatus = ncx_putn_$1_$2(&xp, nput, value ifelse(`$1',`char',,`,fillp')));
 		if(lstatus != NC_NOERR && status == NC_NOERR)
 		{
 			/* not fatal to the loop */
@@ -683,9 +708,6 @@ putNCvx_$1_$2(NC3_INFO* ncp, const NC_var *varp,
 		value += nput;
 
 	}
-#ifdef ERANGE_FILL
-        free(fillp);
-#endif
 
 	return status;
 }
@@ -810,9 +832,9 @@ define(`GETNCVX',dnl
 `dnl
 static int
 getNCvx_$1_$2(const NC3_INFO* ncp, const NC_var *varp,
-		 const size_t *start, size_t nelems, $2 *value)
+		 off_t offset, size_t nelems, $2 *value)
 {
-	off_t offset = NC_varoffset(ncp, varp, start);
+	const size_t step = NCstepsize(ncp);
 	size_t remaining = varp->xsz * nelems;
 	int status = NC_NOERR;
 	const void *xp;
@@ -824,7 +846,7 @@ getNCvx_$1_$2(const NC3_INFO* ncp, const NC_var *varp,
 
 	for(;;)
 	{
-		size_t extent = MIN(remaining, ncp->chunk);
+		size_t extent = MIN(remaining, step);
 		size_t nget = ncx_howmany(varp->type, extent);
 
 		int lstatus = ncio_get(ncp->nciop, offset, extent,
@@ -832,7 +854,7 @@ getNCvx_$1_$2(const NC3_INFO* ncp, const NC_var *varp,
 		if(lstatus != NC_NOERR)
 			return lstatus;
 
-		lstatus = ncx_getn_$1_$2(&xp, nget, value);
+		NCIO_TIMED(ncp->nciop, extent, lstatus = ncx_getn_$1_$2(&xp, nget, value));
 		if(lstatus != NC_NOERR && status == NC_NOERR)
 			status = lstatus;
 
@@ -1066,49 +1088,66 @@ set_upper(size_t *upp, /* modified on return */
 }
 
 
+/*
+ * Distance in the file, in bytes, between neighbours along each
+ * dimension of the variable: the offset of coord is varp->begin plus
+ * the sum of coord[i] * steps[i], as NC_varoffset() computes it.
+ */
+static void
+NCdimsteps(const NC3_INFO* ncp, const NC_var *varp,
+	off_t *steps) /* modified on return */
+{
+	size_t i;
+
+	for(i = 0; i < varp->ndims; i++)
+		steps[i] = (off_t)varp->xsz
+			* (i + 1 < varp->ndims ? varp->dsizes[i + 1] : 1);
+	if(IS_RECVAR(varp))
+		steps[0] = (off_t)ncp->recsize;
+}
+
+
 /*
  * The infamous and oft-discussed odometer code.
  *
  * 'start[]' is the starting coordinate.
  * 'upper[]' is the upper bound s.t. start[ii] < upper[ii].
  * 'coord[]' is the register, the current coordinate value.
- * For some ii,
- * upp == &upper[ii]
- * cdp == &coord[ii]
  *
- * Running this routine increments *cdp.
+ * Running this routine increments coord[ii].
  *
- * If after the increment, *cdp is equal to *upp
- * (and cdp is not the leftmost dimension),
- * *cdp is "zeroed" to the starting value and
+ * If after the increment, coord[ii] is equal to upper[ii]
+ * (and ii is not the leftmost dimension),
+ * coord[ii] is "zeroed" to the starting value and
  * we need to "carry", eg, increment one place to
  * the left.
  *
- * TODO: Some architectures hate recursion?
- * 	Reimplement non-recursively.
+ * 'offset' is the place of coord in the file. It is moved along
+ * with coord using the 'steps[]' of NCdimsteps(), so that the loops
+ * over a hyperslab do not compute it from scratch for every run.
+ * Returns the new offset.
  */
-static void
+static off_t
 odo1(const size_t *const start, const size_t *const upper,
 	size_t *const coord, /* modified on return */
-	const size_t *upp,
-	size_t *cdp)
+	const off_t *const steps,
+	size_t ii,
+	off_t offset)
 {
-	assert(coord <= cdp && cdp <= coord + NC_MAX_VAR_DIMS);
-	assert(upper <= upp && upp <= upper + NC_MAX_VAR_DIMS);
-	assert(upp - upper == cdp - coord);
-
-	assert(*cdp <= *upp);
+	assert(ii < NC_MAX_VAR_DIMS);
 
-	(*cdp)++;
-	if(cdp != coord && *cdp >= *upp)
+	for(;;)
 	{
-		*cdp = start[cdp - coord];
-		odo1(start, upper, coord, upp -1, cdp -1);
+		assert(coord[ii] <= upper[ii]);
+		coord[ii]++;
+		offset += steps[ii];
+		if(ii == 0 || coord[ii] < upper[ii])
+			return offset;
+		offset -= (off_t)(coord[ii] - start[ii]) * steps[ii];
+		coord[ii] = start[ii];
+		ii--;
 	}
 }
-#ifdef _CRAYC
-#pragma _CRI noinline odo1
-#endif
 
 
 dnl
@@ -1132,7 +1171,7 @@ ifelse($1, text,dnl
 #define CASE(nc1,nc2) (nc1*256+nc2)
 
 static int
-readNCv(const NC3_INFO* ncp, const NC_var* varp, const size_t* start,
+readNCv(const NC3_INFO* ncp, const NC_var* varp, off_t offset,
         const size_t nelems, void* value, const nc_type memtype)
 {
     int status = NC_NOERR;
@@ -1140,319 +1179,319 @@ readNCv(const NC3_INFO* ncp, const NC_var* varp, const size_t* start,
 
     case CASE(NC_CHAR,NC_CHAR):
     case CASE(NC_CHAR,NC_UBYTE):
-    return getNCvx_schar_schar(ncp,varp,start,nelems,(signed char*)value);
+    return getNCvx_schar_schar(ncp,varp,offset,nelems,(signed char*)value);
     break;
     case CASE(NC_BYTE,NC_BYTE):
-        return getNCvx_schar_schar(ncp,varp,start,nelems, (schar*)value);
+        return getNCvx_schar_schar(ncp,varp,offset,nelems, (schar*)value);
 	break;
     case CASE(NC_BYTE,NC_UBYTE):
         if (fIsSet(ncp->flags,NC_64BIT_DATA))
-            return getNCvx_schar_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+            return getNCvx_schar_uchar(ncp,varp,offset,nelems,(unsigned char*)value);
         else
             /* for CDF-1 and CDF-2, NC_BYTE is treated the same type as uchar memtype */
-            return getNCvx_uchar_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+            return getNCvx_uchar_uchar(ncp,varp,offset,nelems,(unsigned char*)value);
 	break;
     case CASE(NC_BYTE,NC_SHORT):
-        return getNCvx_schar_short(ncp,varp,start,nelems,(short*)value);
+        return getNCvx_schar_short(ncp,varp,offset,nelems,(short*)value);
 	break;
     case CASE(NC_BYTE,NC_INT):
-        return getNCvx_schar_int(ncp,varp,start,nelems,(int*)value);
+        return getNCvx_schar_int(ncp,varp,offset,nelems,(int*)value);
 	break;
     case CASE(NC_BYTE,NC_FLOAT):
-        return getNCvx_schar_float(ncp,varp,start,nelems,(float*)value);
+        return getNCvx_schar_float(ncp,varp,offset,nelems,(float*)value);
 	break;
     case CASE(NC_BYTE,NC_DOUBLE):
-        return getNCvx_schar_double(ncp,varp,start,nelems,(double *)value);
+        return getNCvx_schar_double(ncp,varp,offset,nelems,(double *)value);
 	break;
     case CASE(NC_BYTE,NC_INT64):
-        return getNCvx_schar_longlong(ncp,varp,start,nelems,(long long*)value);
+        return getNCvx_schar_longlong(ncp,varp,offset,nelems,(long long*)value);
 	break;
     case CASE(NC_BYTE,NC_UINT):
-        return getNCvx_schar_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return getNCvx_schar_uint(ncp,varp,offset,nelems,(unsigned int*)value);
 	break;
     case CASE(NC_BYTE,NC_UINT64):
-        return getNCvx_schar_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return getNCvx_schar_ulonglong(ncp,varp,offset,nelems,(unsigned long long*)value);
     	break;
     case CASE(NC_BYTE,NC_USHORT):
-        return getNCvx_schar_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return getNCvx_schar_ushort(ncp,varp,offset,nelems,(unsigned short*)value);
 	break;
     case CASE(NC_SHORT,NC_BYTE):
-        return getNCvx_short_schar(ncp,varp,start,nelems,(schar*)value);
+        return getNCvx_short_schar(ncp,varp,offset,nelems,(schar*)value);
 	break;
     case CASE(NC_SHORT,NC_UBYTE):
-        return getNCvx_short_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return getNCvx_short_uchar(ncp,varp,offset,nelems,(unsigned char*)value);
 	break;
     case CASE(NC_SHORT,NC_SHORT):
-        return getNCvx_short_short(ncp,varp,start,nelems,(short*)value);
+        return getNCvx_short_short(ncp,varp,offset,nelems,(short*)value);
 	break;
     case CASE(NC_SHORT,NC_INT):
-        return getNCvx_short_int(ncp,varp,start,nelems,(int*)value);
+        return getNCvx_short_int(ncp,varp,offset,nelems,(int*)value);
 	break;
    case CASE(NC_SHORT,NC_FLOAT):
-        return getNCvx_short_float(ncp,varp,start,nelems,(float*)value);
+        return getNCvx_short_float(ncp,varp,offset,nelems,(float*)value);
 	break;
     case CASE(NC_SHORT,NC_DOUBLE):
-        return getNCvx_short_double(ncp,varp,start,nelems,(double*)value);
+        return getNCvx_short_double(ncp,varp,offset,nelems,(double*)value);
 	break;
     case CASE(NC_SHORT,NC_INT64):
-        return getNCvx_short_longlong(ncp,varp,start,nelems,(long long*)value);
+        return getNCvx_short_longlong(ncp,varp,offset,nelems,(long long*)value);
    	break;
     case CASE(NC_SHORT,NC_UINT):
-        return getNCvx_short_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return getNCvx_short_uint(ncp,varp,offset,nelems,(unsigned int*)value);
     	break;
     case CASE(NC_SHORT,NC_UINT64):
-        return getNCvx_short_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return getNCvx_short_ulonglong(ncp,varp,offset,nelems,(unsigned long long*)value);
 	break;
     case CASE(NC_SHORT,NC_USHORT):
-        return getNCvx_short_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return getNCvx_short_ushort(ncp,varp,offset,nelems,(unsigned short*)value);
 	break;
 
     case CASE(NC_INT,NC_BYTE):
-        return getNCvx_int_schar(ncp,varp,start,nelems,(schar*)value);
+        return getNCvx_int_schar(ncp,varp,offset,nelems,(schar*)value);
 	break;
     case CASE(NC_INT,NC_UBYTE):
-        return getNCvx_int_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return getNCvx_int_uchar(ncp,varp,offset,nelems,(unsigned char*)value);
 	break;
     case CASE(NC_INT,NC_SHORT):
-        return getNCvx_int_short(ncp,varp,start,nelems,(short*)value);
+        return getNCvx_int_short(ncp,varp,offset,nelems,(short*)value);
 	break;
     case CASE(NC_INT,NC_INT):
-        return getNCvx_int_int(ncp,varp,start,nelems,(int*)value);
+        return getNCvx_int_int(ncp,varp,offset,nelems,(int*)value);
 	break;
     case CASE(NC_INT,NC_FLOAT):
-        return getNCvx_int_float(ncp,varp,start,nelems,(float*)value);
+        return getNCvx_int_float(ncp,varp,offset,nelems,(float*)value);
 	break;
     case CASE(NC_INT,NC_DOUBLE):
-        return getNCvx_int_double(ncp,varp,start,nelems,(double*)value);
+        return getNCvx_int_double(ncp,varp,offset,nelems,(double*)value);
 	break;
     case CASE(NC_INT,NC_INT64):
-        return getNCvx_int_longlong(ncp,varp,start,nelems,(long long*)value);
+        return getNCvx_int_longlong(ncp,varp,offset,nelems,(long long*)value);
 	break;
     case CASE(NC_INT,NC_UINT):
-        return getNCvx_int_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return getNCvx_int_uint(ncp,varp,offset,nelems,(unsigned int*)value);
 	break;
     case CASE(NC_INT,NC_UINT64):
-        return getNCvx_int_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return getNCvx_int_ulonglong(ncp,varp,offset,nelems,(unsigned long long*)value);
 	break;
     case CASE(NC_INT,NC_USHORT):
-        return getNCvx_int_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return getNCvx_int_ushort(ncp,varp,offset,nelems,(unsigned short*)value);
 	break;
 
     case CASE(NC_FLOAT,NC_BYTE):
-        return getNCvx_float_schar(ncp,varp,start,nelems,(schar*)value);
+        return getNCvx_float_schar(ncp,varp,offset,nelems,(schar*)value);
 	break;
     case CASE(NC_FLOAT,NC_UBYTE):
-        return getNCvx_float_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return getNCvx_float_uchar(ncp,varp,offset,nelems,(unsigned char*)value);
 	break;
     case CASE(NC_FLOAT,NC_SHORT):
-        return getNCvx_float_short(ncp,varp,start,nelems,(short*)value);
+        return getNCvx_float_short(ncp,varp,offset,nelems,(short*)value);
 	break;
     case CASE(NC_FLOAT,NC_INT):
-        return getNCvx_float_int(ncp,varp,start,nelems,(int*)value);
+        return getNCvx_float_int(ncp,varp,offset,nelems,(int*)value);
 	break;
     case CASE(NC_FLOAT,NC_FLOAT):
-        return getNCvx_float_float(ncp,varp,start,nelems,(float*)value);
+        return getNCvx_float_float(ncp,varp,offset,nelems,(float*)value);
 	break;
     case CASE(NC_FLOAT,NC_DOUBLE):
-        return getNCvx_float_double(ncp,varp,start,nelems,(double*)value);
+        return getNCvx_float_double(ncp,varp,offset,nelems,(double*)value);
 	break;
     case CASE(NC_FLOAT,NC_INT64):
-        return getNCvx_float_longlong(ncp,varp,start,nelems,(long long*)value);
+        return getNCvx_float_longlong(ncp,varp,offset,nelems,(long long*)value);
 	break;
     case CASE(NC_FLOAT,NC_UINT):
-        return getNCvx_float_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return getNCvx_float_uint(ncp,varp,offset,nelems,(unsigned int*)value);
 	break;
     case CASE(NC_FLOAT,NC_UINT64):
-        return getNCvx_float_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return getNCvx_float_ulonglong(ncp,varp,offset,nelems,(unsigned long long*)value);
 	break;
     case CASE(NC_FLOAT,NC_USHORT):
-        return getNCvx_float_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return getNCvx_float_ushort(ncp,varp,offset,nelems,(unsigned short*)value);
 	break;
 
     case CASE(NC_DOUBLE,NC_BYTE):
-        return getNCvx_double_schar(ncp,varp,start,nelems,(schar*)value);
+        return getNCvx_double_schar(ncp,varp,offset,nelems,(schar*)value);
 	break;
     case CASE(NC_DOUBLE,NC_UBYTE):
-        return getNCvx_double_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return getNCvx_double_uchar(ncp,varp,offset,nelems,(unsigned char*)value);
 	break;
     case CASE(NC_DOUBLE,NC_SHORT):
-        return getNCvx_double_short(ncp,varp,start,nelems,(short*)value);
+        return getNCvx_double_short(ncp,varp,offset,nelems,(short*)value);
 	break;
     case CASE(NC_DOUBLE,NC_INT):
-        return getNCvx_double_int(ncp,varp,start,nelems,(int*)value);
+        return getNCvx_double_int(ncp,varp,offset,nelems,(int*)value);
 	break;
     case CASE(NC_DOUBLE,NC_FLOAT):
-        return getNCvx_double_float(ncp,varp,start,nelems,(float*)value);
+        return getNCvx_double_float(ncp,varp,offset,nelems,(float*)value);
 	break;
     case CASE(NC_DOUBLE,NC_DOUBLE):
-        return getNCvx_double_double(ncp,varp,start,nelems,(double*)value);
+        return getNCvx_double_double(ncp,varp,offset,nelems,(double*)value);
 	break;
     case CASE(NC_DOUBLE,NC_INT64):
-        return getNCvx_double_longlong(ncp,varp,start,nelems,(long long*)value);
+        return getNCvx_double_longlong(ncp,varp,offset,nelems,(long long*)value);
 	break;
     case CASE(NC_DOUBLE,NC_UINT):
-        return getNCvx_double_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return getNCvx_double_uint(ncp,varp,offset,nelems,(unsigned int*)value);
 	break;
     case CASE(NC_DOUBLE,NC_UINT64):
-        return getNCvx_double_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return getNCvx_double_ulonglong(ncp,varp,offset,nelems,(unsigned long long*)value);
 	break;
     case CASE(NC_DOUBLE,NC_USHORT):
-        return getNCvx_double_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return getNCvx_double_ushort(ncp,varp,offset,nelems,(unsigned short*)value);
 	break;
 
     case CASE(NC_UBYTE,NC_UBYTE):
-        return getNCvx_uchar_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return getNCvx_uchar_uchar(ncp,varp,offset,nelems,(unsigned char*)value);
 	break;
     case CASE(NC_UBYTE,NC_BYTE):
-        return getNCvx_uchar_schar(ncp,varp,start,nelems,(schar*)value);
+        return getNCvx_uchar_schar(ncp,varp,offset,nelems,(schar*)value);
 	break;
     case CASE(NC_UBYTE,NC_SHORT):
-        return getNCvx_uchar_short(ncp,varp,start,nelems,(short*)value);
+        return getNCvx_uchar_short(ncp,varp,offset,nelems,(short*)value);
 	break;
     case CASE(NC_UBYTE,NC_INT):
-        return getNCvx_uchar_int(ncp,varp,start,nelems,(int*)value);
+        return getNCvx_uchar_int(ncp,varp,offset,nelems,(int*)value);
 	break;
     case CASE(NC_UBYTE,NC_FLOAT):
-        return getNCvx_uchar_float(ncp,varp,start,nelems,(float*)value);
+        return getNCvx_uchar_float(ncp,varp,offset,nelems,(float*)value);
 	break;
     case CASE(NC_UBYTE,NC_DOUBLE):
-        return getNCvx_uchar_double(ncp,varp,start,nelems,(double *)value);
+        return getNCvx_uchar_double(ncp,varp,offset,nelems,(double *)value);
 	break;
     case CASE(NC_UBYTE,NC_INT64):
-        return getNCvx_uchar_longlong(ncp,varp,start,nelems,(long long*)value);
+        return getNCvx_uchar_longlong(ncp,varp,offset,nelems,(long long*)value);
 	break;
     case CASE(NC_UBYTE,NC_UINT):
-        return getNCvx_uchar_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return getNCvx_uchar_uint(ncp,varp,offset,nelems,(unsigned int*)value);
 	break;
     case CASE(NC_UBYTE,NC_UINT64):
-        return getNCvx_uchar_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return getNCvx_uchar_ulonglong(ncp,varp,offset,nelems,(unsigned long long*)value);
 	break;
     case CASE(NC_UBYTE,NC_USHORT):
-        return getNCvx_uchar_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return getNCvx_uchar_ushort(ncp,varp,offset,nelems,(unsigned short*)value);
 	break;
 
     case CASE(NC_USHORT,NC_BYTE):
-        return getNCvx_ushort_schar(ncp,varp,start,nelems,(schar*)value);
+        return getNCvx_ushort_schar(ncp,varp,offset,nelems,(schar*)value);
 	break;
     case CASE(NC_USHORT,NC_UBYTE):
-        return getNCvx_ushort_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return getNCvx_ushort_uchar(ncp,varp,offset,nelems,(unsigned char*)value);
 	break;
     case CASE(NC_USHORT,NC_SHORT):
-        return getNCvx_ushort_short(ncp,varp,start,nelems,(short*)value);
+        return getNCvx_ushort_short(ncp,varp,offset,nelems,(short*)value);
 	break;
     case CASE(NC_USHORT,NC_INT):
-        return getNCvx_ushort_int(ncp,varp,start,nelems,(int*)value);
+        return getNCvx_ushort_int(ncp,varp,offset,nelems,(int*)value);
 	break;
     case CASE(NC_USHORT,NC_FLOAT):
-        return getNCvx_ushort_float(ncp,varp,start,nelems,(float*)value);
+        return getNCvx_ushort_float(ncp,varp,offset,nelems,(float*)value);
 	break;
     case CASE(NC_USHORT,NC_DOUBLE):
-        return getNCvx_ushort_double(ncp,varp,start,nelems,(double*)value);
+        return getNCvx_ushort_double(ncp,varp,offset,nelems,(double*)value);
 	break;
     case CASE(NC_USHORT,NC_INT64):
-        return getNCvx_ushort_longlong(ncp,varp,start,nelems,(long long*)value);
+        return getNCvx_ushort_longlong(ncp,varp,offset,nelems,(long long*)value);
 	break;
     case CASE(NC_USHORT,NC_UINT):
-        return getNCvx_ushort_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return getNCvx_ushort_uint(ncp,varp,offset,nelems,(unsigned int*)value);
 	break;
     case CASE(NC_USHORT,NC_UINT64):
-        return getNCvx_ushort_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return getNCvx_ushort_ulonglong(ncp,varp,offset,nelems,(unsigned long long*)value);
 	break;
     case CASE(NC_USHORT,NC_USHORT):
-        return getNCvx_ushort_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return getNCvx_ushort_ushort(ncp,varp,offset,nelems,(unsigned short*)value);
 	break;
 
     case CASE(NC_UINT,NC_BYTE):
-        return getNCvx_uint_schar(ncp,varp,start,nelems,(schar*)value);
+        return getNCvx_uint_schar(ncp,varp,offset,nelems,(schar*)value);
 	break;
     case CASE(NC_UINT,NC_UBYTE):
-        return getNCvx_uint_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return getNCvx_uint_uchar(ncp,varp,offset,nelems,(unsigned char*)value);
 	break;
     case CASE(NC_UINT,NC_SHORT):
-        return getNCvx_uint_short(ncp,varp,start,nelems,(short*)value);
+        return getNCvx_uint_short(ncp,varp,offset,nelems,(short*)value);
 	break;
     case CASE(NC_UINT,NC_INT):
-        return getNCvx_uint_int(ncp,varp,start,nelems,(int*)value);
+        return getNCvx_uint_int(ncp,varp,offset,nelems,(int*)value);
 	break;
     case CASE(NC_UINT,NC_FLOAT):
-        return getNCvx_uint_float(ncp,varp,start,nelems,(float*)value);
+        return getNCvx_uint_float(ncp,varp,offset,nelems,(float*)value);
 	break;
     case CASE(NC_UINT,NC_DOUBLE):
-        return getNCvx_uint_double(ncp,varp,start,nelems,(double*)value);
+        return getNCvx_uint_double(ncp,varp,offset,nelems,(double*)value);
 	break;
     case CASE(NC_UINT,NC_INT64):
-        return getNCvx_uint_longlong(ncp,varp,start,nelems,(long long*)value);
+        return getNCvx_uint_longlong(ncp,varp,offset,nelems,(long long*)value);
 	break;
     case CASE(NC_UINT,NC_UINT):
-        return getNCvx_uint_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return getNCvx_uint_uint(ncp,varp,offset,nelems,(unsigned int*)value);
 	break;
     case CASE(NC_UINT,NC_UINT64):
-        return getNCvx_uint_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return getNCvx_uint_ulonglong(ncp,varp,offset,nelems,(unsigned long long*)value);
 	break;
     case CASE(NC_UINT,NC_USHORT):
-        return getNCvx_uint_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return getNCvx_uint_ushort(ncp,varp,offset,nelems,(unsigned short*)value);
 	break;
 
     case CASE(NC_INT64,NC_BYTE):
-        return getNCvx_longlong_schar(ncp,varp,start,nelems,(schar*)value);
+        return getNCvx_longlong_schar(ncp,varp,offset,nelems,(schar*)value);
 	break;
     case CASE(NC_INT64,NC_UBYTE):
-        return getNCvx_longlong_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return getNCvx_longlong_uchar(ncp,varp,offset,nelems,(unsigned char*)value);
 	break;
     case CASE(NC_INT64,NC_SHORT):
-        return getNCvx_longlong_short(ncp,varp,start,nelems,(short*)value);
+        return getNCvx_longlong_short(ncp,varp,offset,nelems,(short*)value);
 	break;
     case CASE(NC_INT64,NC_INT):
-        return getNCvx_longlong_int(ncp,varp,start,nelems,(int*)value);
+        return getNCvx_longlong_int(ncp,varp,offset,nelems,(int*)value);
 	break;
     case CASE(NC_INT64,NC_FLOAT):
-        return getNCvx_longlong_float(ncp,varp,start,nelems,(float*)value);
+        return getNCvx_longlong_float(ncp,varp,offset,nelems,(float*)value);
 	break;
     case CASE(NC_INT64,NC_DOUBLE):
-        return getNCvx_longlong_double(ncp,varp,start,nelems,(double*)value);
+        return getNCvx_longlong_double(ncp,varp,offset,nelems,(double*)value);
 	break;
     case CASE(NC_INT64,NC_INT64):
-        return getNCvx_longlong_longlong(ncp,varp,start,nelems,(long long*)value);
+        return getNCvx_longlong_longlong(ncp,varp,offset,nelems,(long long*)value);
 	break;
     case CASE(NC_INT64,NC_UINT):
-        return getNCvx_longlong_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return getNCvx_longlong_uint(ncp,varp,offset,nelems,(unsigned int*)value);
 	break;
     case CASE(NC_INT64,NC_UINT64):
-        return getNCvx_longlong_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return getNCvx_longlong_ulonglong(ncp,varp,offset,nelems,(unsigned long long*)value);
 	break;
     case CASE(NC_INT64,NC_USHORT):
-        return getNCvx_longlong_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return getNCvx_longlong_ushort(ncp,varp,offset,nelems,(unsigned short*)value);
 	break;
 
     case CASE(NC_UINT64,NC_BYTE):
-        return getNCvx_ulonglong_schar(ncp,varp,start,nelems,(schar*)value);
+        return getNCvx_ulonglong_schar(ncp,varp,offset,nelems,(schar*)value);
 	break;
     case CASE(NC_UINT64,NC_UBYTE):
-        return getNCvx_ulonglong_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return getNCvx_ulonglong_uchar(ncp,varp,offset,nelems,(unsigned char*)value);
 	break;
     case CASE(NC_UINT64,NC_SHORT):
-        return getNCvx_ulonglong_short(ncp,varp,start,nelems,(short*)value);
+        return getNCvx_ulonglong_short(ncp,varp,offset,nelems,(short*)value);
 	break;
     case CASE(NC_UINT64,NC_INT):
-        return getNCvx_ulonglong_int(ncp,varp,start,nelems,(int*)value);
+        return getNCvx_ulonglong_int(ncp,varp,offset,nelems,(int*)value);
 	break;
     case CASE(NC_UINT64,NC_FLOAT):
-        return getNCvx_ulonglong_float(ncp,varp,start,nelems,(float*)value);
+        return getNCvx_ulonglong_float(ncp,varp,offset,nelems,(float*)value);
 	break;
     case CASE(NC_UINT64,NC_DOUBLE):
-        return getNCvx_ulonglong_double(ncp,varp,start,nelems,(double*)value);
+        return getNCvx_ulonglong_double(ncp,varp,offset,nelems,(double*)value);
 	break;
     case CASE(NC_UINT64,NC_INT64):
-        return getNCvx_ulonglong_longlong(ncp,varp,start,nelems,(long long*)value);
+        return getNCvx_ulonglong_longlong(ncp,varp,offset,nelems,(long long*)value);
 	break;
     case CASE(NC_UINT64,NC_UINT):
-        return getNCvx_ulonglong_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return getNCvx_ulonglong_uint(ncp,varp,offset,nelems,(unsigned int*)value);
 	break;
     case CASE(NC_UINT64,NC_UINT64):
-        return getNCvx_ulonglong_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return getNCvx_ulonglong_ulonglong(ncp,varp,offset,nelems,(unsigned long long*)value);
 	break;
     case CASE(NC_UINT64,NC_USHORT):
-        return getNCvx_ulonglong_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return getNCvx_ulonglong_ushort(ncp,varp,offset,nelems,(unsigned short*)value);
 	break;
 
     default:
@@ -1464,7 +1503,7 @@ readNCv(const NC3_INFO* ncp, const NC_var* varp, const size_t* start,
 
 
 static int
-writeNCv(NC3_INFO* ncp, const NC_var* varp, const size_t* start,
+writeNCv(NC3_INFO* ncp, const NC_var* varp, off_t offset,
          const size_t nelems, const void* value, const nc_type memtype)
 {
     int status = NC_NOERR;
@@ -1472,311 +1511,311 @@ writeNCv(NC3_INFO* ncp, const NC_var* varp, const size_t* start,
 
     case CASE(NC_CHAR,NC_CHAR):
     case CASE(NC_CHAR,NC_UBYTE):
-        return putNCvx_char_char(ncp,varp,start,nelems,(char*)value);
+        return putNCvx_char_char(ncp,varp,offset,nelems,(char*)value);
 	break;
     case CASE(NC_BYTE,NC_BYTE):
-        return putNCvx_schar_schar(ncp,varp,start,nelems,(schar*)value);
+        return putNCvx_schar_schar(ncp,varp,offset,nelems,(schar*)value);
 	break;
     case CASE(NC_BYTE,NC_UBYTE):
         if (fIsSet(ncp->flags,NC_64BIT_DATA))
-            return putNCvx_schar_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+            return putNCvx_schar_uchar(ncp,varp,offset,nelems,(unsigned char*)value);
         else
             /* for CDF-1 and CDF-2, NC_BYTE is treated the same type as uchar memtype */
-            return putNCvx_uchar_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+            return putNCvx_uchar_uchar(ncp,varp,offset,nelems,(unsigned char*)value);
 	break;
     case CASE(NC_BYTE,NC_SHORT):
-        return putNCvx_schar_short(ncp,varp,start,nelems,(short*)value);
+        return putNCvx_schar_short(ncp,varp,offset,nelems,(short*)value);
 	break;
     case CASE(NC_BYTE,NC_INT):
-        return putNCvx_schar_int(ncp,varp,start,nelems,(int*)value);
+        return putNCvx_schar_int(ncp,varp,offset,nelems,(int*)value);
 	break;
     case CASE(NC_BYTE,NC_FLOAT):
-        return putNCvx_schar_float(ncp,varp,start,nelems,(float*)value);
+        return putNCvx_schar_float(ncp,varp,offset,nelems,(float*)value);
 	break;
     case CASE(NC_BYTE,NC_DOUBLE):
-        return putNCvx_schar_double(ncp,varp,start,nelems,(double *)value);
+        return putNCvx_schar_double(ncp,varp,offset,nelems,(double *)value);
 	break;
     case CASE(NC_BYTE,NC_INT64):
-        return putNCvx_schar_longlong(ncp,varp,start,nelems,(long long*)value);
+        return putNCvx_schar_longlong(ncp,varp,offset,nelems,(long long*)value);
 	break;
     case CASE(NC_BYTE,NC_UINT):
-        return putNCvx_schar_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return putNCvx_schar_uint(ncp,varp,offset,nelems,(unsigned int*)value);
 	break;
     case CASE(NC_BYTE,NC_UINT64):
-        return putNCvx_schar_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return putNCvx_schar_ulonglong(ncp,varp,offset,nelems,(unsigned long long*)value);
 	break;
     case CASE(NC_BYTE,NC_USHORT):
-        return putNCvx_schar_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return putNCvx_schar_ushort(ncp,varp,offset,nelems,(unsigned short*)value);
 	break;
     case CASE(NC_SHORT,NC_BYTE):
-        return putNCvx_short_schar(ncp,varp,start,nelems,(schar*)value);
+        return putNCvx_short_schar(ncp,varp,offset,nelems,(schar*)value);
 	break;
     case CASE(NC_SHORT,NC_UBYTE):
-        return putNCvx_short_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return putNCvx_short_uchar(ncp,varp,offset,nelems,(unsigned char*)value);
 	break;
     case CASE(NC_SHORT,NC_SHORT):
-        return putNCvx_short_short(ncp,varp,start,nelems,(short*)value);
+        return putNCvx_short_short(ncp,varp,offset,nelems,(short*)value);
 	break;
     case CASE(NC_SHORT,NC_INT):
-        return putNCvx_short_int(ncp,varp,start,nelems,(int*)value);
+        return putNCvx_short_int(ncp,varp,offset,nelems,(int*)value);
 	break;
     case CASE(NC_SHORT,NC_FLOAT):
-        return putNCvx_short_float(ncp,varp,start,nelems,(float*)value);
+        return putNCvx_short_float(ncp,varp,offset,nelems,(float*)value);
 	break;
     case CASE(NC_SHORT,NC_DOUBLE):
-        return putNCvx_short_double(ncp,varp,start,nelems,(double*)value);
+        return putNCvx_short_double(ncp,varp,offset,nelems,(double*)value);
 	break;
     case CASE(NC_SHORT,NC_INT64):
-        return putNCvx_short_longlong(ncp,varp,start,nelems,(long long*)value);
+        return putNCvx_short_longlong(ncp,varp,offset,nelems,(long long*)value);
 	break;
     case CASE(NC_SHORT,NC_UINT):
-        return putNCvx_short_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return putNCvx_short_uint(ncp,varp,offset,nelems,(unsigned int*)value);
 	break;
     case CASE(NC_SHORT,NC_UINT64):
-        return putNCvx_short_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return putNCvx_short_ulonglong(ncp,varp,offset,nelems,(unsigned long long*)value);
 	break;
     case CASE(NC_SHORT,NC_USHORT):
-        return putNCvx_short_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return putNCvx_short_ushort(ncp,varp,offset,nelems,(unsigned short*)value);
 	break;
     case CASE(NC_INT,NC_BYTE):
-        return putNCvx_int_schar(ncp,varp,start,nelems,(schar*)value);
+        return putNCvx_int_schar(ncp,varp,offset,nelems,(schar*)value);
 	break;
     case CASE(NC_INT,NC_UBYTE):
-        return putNCvx_int_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return putNCvx_int_uchar(ncp,varp,offset,nelems,(unsigned char*)value);
 	break;
     case CASE(NC_INT,NC_SHORT):
-        return putNCvx_int_short(ncp,varp,start,nelems,(short*)value);
+        return putNCvx_int_short(ncp,varp,offset,nelems,(short*)value);
 	break;
     case CASE(NC_INT,NC_INT):
-        return putNCvx_int_int(ncp,varp,start,nelems,(int*)value);
+        return putNCvx_int_int(ncp,varp,offset,nelems,(int*)value);
 	break;
     case CASE(NC_INT,NC_FLOAT):
-        return putNCvx_int_float(ncp,varp,start,nelems,(float*)value);
+        return putNCvx_int_float(ncp,varp,offset,nelems,(float*)value);
 	break;
     case CASE(NC_INT,NC_DOUBLE):
-        return putNCvx_int_double(ncp,varp,start,nelems,(double*)value);
+        return putNCvx_int_double(ncp,varp,offset,nelems,(double*)value);
 	break;
     case CASE(NC_INT,NC_INT64):
-        return putNCvx_int_longlong(ncp,varp,start,nelems,(long long*)value);
+        return putNCvx_int_longlong(ncp,varp,offset,nelems,(long long*)value);
 	break;
     case CASE(NC_INT,NC_UINT):
-        return putNCvx_int_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return putNCvx_int_uint(ncp,varp,offset,nelems,(unsigned int*)value);
 	break;
     case CASE(NC_INT,NC_UINT64):
-        return putNCvx_int_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return putNCvx_int_ulonglong(ncp,varp,offset,nelems,(unsigned long long*)value);
 	break;
     case CASE(NC_INT,NC_USHORT):
-        return putNCvx_int_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return putNCvx_int_ushort(ncp,varp,offset,nelems,(unsigned short*)value);
 	break;
     case CASE(NC_FLOAT,NC_BYTE):
-        return putNCvx_float_schar(ncp,varp,start,nelems,(schar*)value);
+        return putNCvx_float_schar(ncp,varp,offset,nelems,(schar*)value);
 	break;
     case CASE(NC_FLOAT,NC_UBYTE):
-        return putNCvx_float_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return putNCvx_float_uchar(ncp,varp,offset,nelems,(unsigned char*)value);
 	break;
     case CASE(NC_FLOAT,NC_SHORT):
-        return putNCvx_float_short(ncp,varp,start,nelems,(short*)value);
+        return putNCvx_float_short(ncp,varp,offset,nelems,(short*)value);
 	break;
     case CASE(NC_FLOAT,NC_INT):
-        return putNCvx_float_int(ncp,varp,start,nelems,(int*)value);
+        return putNCvx_float_int(ncp,varp,offset,nelems,(int*)value);
 	break;
     case CASE(NC_FLOAT,NC_FLOAT):
-        return putNCvx_float_float(ncp,varp,start,nelems,(float*)value);
+        return putNCvx_float_float(ncp,varp,offset,nelems,(float*)value);
 	break;
     case CASE(NC_FLOAT,NC_DOUBLE):
-        return putNCvx_float_double(ncp,varp,start,nelems,(double*)value);
+        return putNCvx_float_double(ncp,varp,offset,nelems,(double*)value);
 	break;
     case CASE(NC_FLOAT,NC_INT64):
-        return putNCvx_float_longlong(ncp,varp,start,nelems,(long long*)value);
+        return putNCvx_float_longlong(ncp,varp,offset,nelems,(long long*)value);
 	break;
     case CASE(NC_FLOAT,NC_UINT):
-        return putNCvx_float_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return putNCvx_float_uint(ncp,varp,offset,nelems,(unsigned int*)value);
 	break;
     case CASE(NC_FLOAT,NC_UINT64):
-        return putNCvx_float_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return putNCvx_float_ulonglong(ncp,varp,offset,nelems,(unsigned long long*)value);
 	break;
     case CASE(NC_FLOAT,NC_USHORT):
-        return putNCvx_float_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return putNCvx_float_ushort(ncp,varp,offset,nelems,(unsigned short*)value);
 	break;
     case CASE(NC_DOUBLE,NC_BYTE):
-        return putNCvx_double_schar(ncp,varp,start,nelems,(schar*)value);
+        return putNCvx_double_schar(ncp,varp,offset,nelems,(schar*)value);
 	break;
     case CASE(NC_DOUBLE,NC_UBYTE):
-        return putNCvx_double_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return putNCvx_double_uchar(ncp,varp,offset,nelems,(unsigned char*)value);
 	break;
     case CASE(NC_DOUBLE,NC_SHORT):
-        return putNCvx_double_short(ncp,varp,start,nelems,(short*)value);
+        return putNCvx_double_short(ncp,varp,offset,nelems,(short*)value);
 	break;
     case CASE(NC_DOUBLE,NC_INT):
-        return putNCvx_double_int(ncp,varp,start,nelems,(int*)value);
+        return putNCvx_double_int(ncp,varp,offset,nelems,(int*)value);
 	break;
     case CASE(NC_DOUBLE,NC_FLOAT):
-        return putNCvx_double_float(ncp,varp,start,nelems,(float*)value);
+        return putNCvx_double_float(ncp,varp,offset,nelems,(float*)value);
 	break;
     case CASE(NC_DOUBLE,NC_DOUBLE):
-        return putNCvx_double_double(ncp,varp,start,nelems,(double*)value);
+        return putNCvx_double_double(ncp,varp,offset,nelems,(double*)value);
 	break;
     case CASE(NC_DOUBLE,NC_INT64):
-        return putNCvx_double_longlong(ncp,varp,start,nelems,(long long*)value);
+        return putNCvx_double_longlong(ncp,varp,offset,nelems,(long long*)value);
 	break;
     case CASE(NC_DOUBLE,NC_UINT):
-        return putNCvx_double_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return putNCvx_double_uint(ncp,varp,offset,nelems,(unsigned int*)value);
 	break;
     case CASE(NC_DOUBLE,NC_UINT64):
-        return putNCvx_double_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return putNCvx_double_ulonglong(ncp,varp,offset,nelems,(unsigned long long*)value);
 	break;
     case CASE(NC_DOUBLE,NC_USHORT):
-        return putNCvx_double_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return putNCvx_double_ushort(ncp,varp,offset,nelems,(unsigned short*)value);
 	break;
     case CASE(NC_UBYTE,NC_UBYTE):
-        return putNCvx_uchar_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return putNCvx_uchar_uchar(ncp,varp,offset,nelems,(unsigned char*)value);
 	break;
     case CASE(NC_UBYTE,NC_BYTE):
-        return putNCvx_uchar_schar(ncp,varp,start,nelems,(schar*)value);
+        return putNCvx_uchar_schar(ncp,varp,offset,nelems,(schar*)value);
 	break;
     case CASE(NC_UBYTE,NC_SHORT):
-        return putNCvx_uchar_short(ncp,varp,start,nelems,(short*)value);
+        return putNCvx_uchar_short(ncp,varp,offset,nelems,(short*)value);
 	break;
     case CASE(NC_UBYTE,NC_INT):
-        return putNCvx_uchar_int(ncp,varp,start,nelems,(int*)value);
+        return putNCvx_uchar_int(ncp,varp,offset,nelems,(int*)value);
 	break;
     case CASE(NC_UBYTE,NC_FLOAT):
-        return putNCvx_uchar_float(ncp,varp,start,nelems,(float*)value);
+        return putNCvx_uchar_float(ncp,varp,offset,nelems,(float*)value);
 	break;
     case CASE(NC_UBYTE,NC_DOUBLE):
-        return putNCvx_uchar_double(ncp,varp,start,nelems,(double *)value);
+        return putNCvx_uchar_double(ncp,varp,offset,nelems,(double *)value);
 	break;
     case CASE(NC_UBYTE,NC_INT64):
-        return putNCvx_uchar_longlong(ncp,varp,start,nelems,(long long*)value);
+        return putNCvx_uchar_longlong(ncp,varp,offset,nelems,(long long*)value);
 	break;
     case CASE(NC_UBYTE,NC_UINT):
-        return putNCvx_uchar_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return putNCvx_uchar_uint(ncp,varp,offset,nelems,(unsigned int*)value);
 	break;
     case CASE(NC_UBYTE,NC_UINT64):
-        return putNCvx_uchar_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return putNCvx_uchar_ulonglong(ncp,varp,offset,nelems,(unsigned long long*)value);
 	break;
     case CASE(NC_UBYTE,NC_USHORT):
-        return putNCvx_uchar_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return putNCvx_uchar_ushort(ncp,varp,offset,nelems,(unsigned short*)value);
 	break;
     case CASE(NC_USHORT,NC_BYTE):
-        return putNCvx_ushort_schar(ncp,varp,start,nelems,(schar*)value);
+        return putNCvx_ushort_schar(ncp,varp,offset,nelems,(schar*)value);
 	break;
     case CASE(NC_USHORT,NC_UBYTE):
-        return putNCvx_ushort_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return putNCvx_ushort_uchar(ncp,varp,offset,nelems,(unsigned char*)value);
 	break;
     case CASE(NC_USHORT,NC_SHORT):
-        return putNCvx_ushort_short(ncp,varp,start,nelems,(short*)value);
+        return putNCvx_ushort_short(ncp,varp,offset,nelems,(short*)value);
 	break;
     case CASE(NC_USHORT,NC_INT):
-        return putNCvx_ushort_int(ncp,varp,start,nelems,(int*)value);
+        return putNCvx_ushort_int(ncp,varp,offset,nelems,(int*)value);
 	break;
     case CASE(NC_USHORT,NC_FLOAT):
-        return putNCvx_ushort_float(ncp,varp,start,nelems,(float*)value);
+        return putNCvx_ushort_float(ncp,varp,offset,nelems,(float*)value);
 	break;
     case CASE(NC_USHORT,NC_DOUBLE):
-        return putNCvx_ushort_double(ncp,varp,start,nelems,(double*)value);
+        return putNCvx_ushort_double(ncp,varp,offset,nelems,(double*)value);
 	break;
     case CASE(NC_USHORT,NC_INT64):
-        return putNCvx_ushort_longlong(ncp,varp,start,nelems,(long long*)value);
+        return putNCvx_ushort_longlong(ncp,varp,offset,nelems,(long long*)value);
 	break;
     case CASE(NC_USHORT,NC_UINT):
-        return putNCvx_ushort_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return putNCvx_ushort_uint(ncp,varp,offset,nelems,(unsigned int*)value);
 	break;
     case CASE(NC_USHORT,NC_UINT64):
-        return putNCvx_ushort_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return putNCvx_ushort_ulonglong(ncp,varp,offset,nelems,(unsigned long long*)value);
 	break;
     case CASE(NC_USHORT,NC_USHORT):
-        return putNCvx_ushort_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return putNCvx_ushort_ushort(ncp,varp,offset,nelems,(unsigned short*)value);
 	break;
     case CASE(NC_UINT,NC_BYTE):
-        return putNCvx_uint_schar(ncp,varp,start,nelems,(schar*)value);
+        return putNCvx_uint_schar(ncp,varp,offset,nelems,(schar*)value);
 	break;
     case CASE(NC_UINT,NC_UBYTE):
-        return putNCvx_uint_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return putNCvx_uint_uchar(ncp,varp,offset,nelems,(unsigned char*)value);
 	break;
     case CASE(NC_UINT,NC_SHORT):
-        return putNCvx_uint_short(ncp,varp,start,nelems,(short*)value);
+        return putNCvx_uint_short(ncp,varp,offset,nelems,(short*)value);
 	break;
     case CASE(NC_UINT,NC_INT):
-        return putNCvx_uint_int(ncp,varp,start,nelems,(int*)value);
+        return putNCvx_uint_int(ncp,varp,offset,nelems,(int*)value);
 	break;
     case CASE(NC_UINT,NC_FLOAT):
-        return putNCvx_uint_float(ncp,varp,start,nelems,(float*)value);
+        return putNCvx_uint_float(ncp,varp,offset,nelems,(float*)value);
 	break;
     case CASE(NC_UINT,NC_DOUBLE):
-        return putNCvx_uint_double(ncp,varp,start,nelems,(double*)value);
+        return putNCvx_uint_double(ncp,varp,offset,nelems,(double*)value);
 	break;
     case CASE(NC_UINT,NC_INT64):
-        return putNCvx_uint_longlong(ncp,varp,start,nelems,(long long*)value);
+        return putNCvx_uint_longlong(ncp,varp,offset,nelems,(long long*)value);
 	break;
     case CASE(NC_UINT,NC_UINT):
-        return putNCvx_uint_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return putNCvx_uint_uint(ncp,varp,offset,nelems,(unsigned int*)value);
 	break;
     case CASE(NC_UINT,NC_UINT64):
-        return putNCvx_uint_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return putNCvx_uint_ulonglong(ncp,varp,offset,nelems,(unsigned long long*)value);
 	break;
     case CASE(NC_UINT,NC_USHORT):
-        return putNCvx_uint_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return putNCvx_uint_ushort(ncp,varp,offset,nelems,(unsigned short*)value);
 	break;
     case CASE(NC_INT64,NC_BYTE):
-        return putNCvx_longlong_schar(ncp,varp,start,nelems,(schar*)value);
+        return putNCvx_longlong_schar(ncp,varp,offset,nelems,(schar*)value);
 	break;
     case CASE(NC_INT64,NC_UBYTE):
-        return putNCvx_longlong_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return putNCvx_longlong_uchar(ncp,varp,offset,nelems,(unsigned char*)value);
 	break;
     case CASE(NC_INT64,NC_SHORT):
-        return putNCvx_longlong_short(ncp,varp,start,nelems,(short*)value);
+        return putNCvx_longlong_short(ncp,varp,offset,nelems,(short*)value);
 	break;
     case CASE(NC_INT64,NC_INT):
-        return putNCvx_longlong_int(ncp,varp,start,nelems,(int*)value);
+        return putNCvx_longlong_int(ncp,varp,offset,nelems,(int*)value);
 	break;
     case CASE(NC_INT64,NC_FLOAT):
-        return putNCvx_longlong_float(ncp,varp,start,nelems,(float*)value);
+        return putNCvx_longlong_float(ncp,varp,offset,nelems,(float*)value);
 	break;
     case CASE(NC_INT64,NC_DOUBLE):
-        return putNCvx_longlong_double(ncp,varp,start,nelems,(double*)value);
+        return putNCvx_longlong_double(ncp,varp,offset,nelems,(double*)value);
 	break;
     case CASE(NC_INT64,NC_INT64):
-        return putNCvx_longlong_longlong(ncp,varp,start,nelems,(long long*)value);
+        return putNCvx_longlong_longlong(ncp,varp,offset,nelems,(long long*)value);
 	break;
     case CASE(NC_INT64,NC_UINT):
-        return putNCvx_longlong_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return putNCvx_longlong_uint(ncp,varp,offset,nelems,(unsigned int*)value);
 	break;
     case CASE(NC_INT64,NC_UINT64):
-        return putNCvx_longlong_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return putNCvx_longlong_ulonglong(ncp,varp,offset,nelems,(unsigned long long*)value);
 	break;
     case CASE(NC_INT64,NC_USHORT):
-        return putNCvx_longlong_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return putNCvx_longlong_ushort(ncp,varp,offset,nelems,(unsigned short*)value);
 	break;
     case CASE(NC_UINT64,NC_BYTE):
-        return putNCvx_ulonglong_schar(ncp,varp,start,nelems,(schar*)value);
+        return putNCvx_ulonglong_schar(ncp,varp,offset,nelems,(schar*)value);
 	break;
     case CASE(NC_UINT64,NC_UBYTE):
-        return putNCvx_ulonglong_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return putNCvx_ulonglong_uchar(ncp,varp,offset,nelems,(unsigned char*)value);
 	break;
     case CASE(NC_UINT64,NC_SHORT):
-        return putNCvx_ulonglong_short(ncp,varp,start,nelems,(short*)value);
+        return putNCvx_ulonglong_short(ncp,varp,offset,nelems,(short*)value);
 	break;
     case CASE(NC_UINT64,NC_INT):
-        return putNCvx_ulonglong_int(ncp,varp,start,nelems,(int*)value);
+        return putNCvx_ulonglong_int(ncp,varp,offset,nelems,(int*)value);
 	break;
     case CASE(NC_UINT64,NC_FLOAT):
-        return putNCvx_ulonglong_float(ncp,varp,start,nelems,(float*)value);
+        return putNCvx_ulonglong_float(ncp,varp,offset,nelems,(float*)value);
 	break;
     case CASE(NC_UINT64,NC_DOUBLE):
-        return putNCvx_ulonglong_double(ncp,varp,start,nelems,(double*)value);
+        return putNCvx_ulonglong_double(ncp,varp,offset,nelems,(double*)value);
 	break;
     case CASE(NC_UINT64,NC_INT64):
-        return putNCvx_ulonglong_longlong(ncp,varp,start,nelems,(long long*)value);
+        return putNCvx_ulonglong_longlong(ncp,varp,offset,nelems,(long long*)value);
 	break;
     case CASE(NC_UINT64,NC_UINT):
-        return putNCvx_ulonglong_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return putNCvx_ulonglong_uint(ncp,varp,offset,nelems,(unsigned int*)value);
 	break;
     case CASE(NC_UINT64,NC_UINT64):
-        return putNCvx_ulonglong_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return putNCvx_ulonglong_ulonglong(ncp,varp,offset,nelems,(unsigned long long*)value);
 	break;
     case CASE(NC_UINT64,NC_USHORT):
-        return putNCvx_ulonglong_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return putNCvx_ulonglong_ushort(ncp,varp,offset,nelems,(unsigned short*)value);
 	break;
 
     default:
@@ -1786,6 +1825,203 @@ writeNCv(NC3_INFO* ncp, const NC_var* varp, const size_t* start,
     return status;
 }
 
+/* Begin vectored */
+
+/*
+ * Strided hyperslabs, made of many runs of iocount values, are read
+ * (written) a batch of runs at a time with one ncio_getv() (ncio_putv())
+ * between the file and a staging buffer, where ncio_get() would be called
+ * once per run. The conversions are the usual readNCv() and writeNCv(),
+ * given a copy of the NC3_INFO whose ncio hands out the staged runs.
+ */
+
+/* Runs longer than this are moved one by one, the calls cost little next to them */
+#define NCV_MAXRUN 65536
+/* Largest staging buffer, small enough that the runs read in are still
+   in cache when converted */
+#define NCV_STAGESIZE 262144
+/* Most runs in a batch */
+#define NCV_BATCH 256
+/* Runs closer than this are written through the ncio buffer instead,
+   that merges them in whole blocks */
+#define NCV_MINPUTSTEP 4096
+
+/* The staged runs. They all have the same length. */
+typedef struct NCstage {
+    size_t nruns;
+    const off_t* offsets;
+    size_t runlen;
+    char* base;
+    size_t cur;  /* run of the last get, gets come in increasing offset order */
+} NCstage;
+
+static int
+ncv_stage_get(ncio* const nciop, off_t offset, size_t extent,
+              int rflags, void** const vpp)
+{
+    NCstage* stage = (NCstage*)nciop->pvt;
+    const off_t runlen = (off_t)stage->runlen;
+    NC_UNUSED(rflags);
+    while(stage->cur < stage->nruns
+          && offset >= stage->offsets[stage->cur] + runlen)
+        stage->cur++;
+    if(stage->cur == stage->nruns || offset < stage->offsets[stage->cur]
+       || offset + (off_t)extent > stage->offsets[stage->cur] + runlen)
+        return NC_EINTERNAL;
+    *vpp = stage->base + stage->cur * stage->runlen
+           + (size_t)(offset - stage->offsets[stage->cur]);
+    return NC_NOERR;
+}
+
+static int
+ncv_stage_rel(ncio* const nciop, off_t offset, int rflags)
+{
+    NC_UNUSED(nciop);
+    NC_UNUSED(offset);
+    NC_UNUSED(rflags);
+    return NC_NOERR;
+}
+
+/*
+ * Number of runs of iocount values that make the hyperslab, as
+ * NCiocount() splits it at dimension ii, if they are to be moved with
+ * NCvv(), else 0.
+ */
+static size_t
+NCvruns(const NC3_INFO* ncp, const NC_var* varp, const size_t* start,
+        const size_t* edges, int ii, size_t iocount, int rw)
+{
+    const size_t runlen = iocount * varp->xsz;
+    size_t nruns = 1;
+    int i;
+
+    if((rw ? ncp->nciop->putv : ncp->nciop->getv) == NULL)
+        return 0;
+    if(runlen == 0 || runlen > NCV_MAXRUN)
+        return 0;
+    for(i = 0; i <= ii; i++)
+        nruns *= edges[i];
+    if(nruns < 2)
+        return 0;
+    if(rw)
+    {
+        /* Offset between the first two runs */
+        size_t next[NC_MAX_VAR_DIMS];
+        off_t step;
+        (void) memcpy(next, start, (size_t)varp->ndims * sizeof(size_t));
+        for(i = ii; i > 0 && next[i] + 1 == start[i] + edges[i]; i--)
+            next[i] = start[i];
+        next[i]++;
+        step = NC_varoffset(ncp, varp, next) - NC_varoffset(ncp, varp, start);
+        if(step < NCV_MINPUTSTEP)
+            return 0;
+    }
+    return nruns;
+}
+
+/*
+ * Read (rw == 0) or write the nruns runs of iocount values of the
+ * hyperslab, the first at coord, which is at offset in the file. Same
+ * arguments and error handling as the odometer loops of NC3_get_vara()
+ * and NC3_put_vara().
+ */
+static int
+NCvv(NC3_INFO* ncp, const NC_var* varp, const size_t* start,
+     const size_t* upper, size_t* coord, const off_t* steps, off_t offset,
+     size_t index, size_t iocount, size_t nruns, void* value0,
+     nc_type memtype, int rw)
+{
+    const size_t runlen = iocount * varp->xsz;
+    const size_t memlen = iocount * (size_t)nctypelen(memtype);
+    signed char* value = (signed char*)value0; /* legally allow ptr arithmetic */
+    size_t batch = MIN(NCV_STAGESIZE / runlen, NCV_BATCH);
+    off_t offsets[NCV_BATCH];
+    size_t lengths[NCV_BATCH];
+    NC3_INFO sncp = *ncp;
+    NCstage stage;
+    ncio sio;
+    size_t i;
+    int status = NC_NOERR;
+
+    if(batch > nruns)
+        batch = nruns;
+    stage.offsets = offsets;
+    stage.runlen = runlen;
+    /* nothing else uses the thread buffer until we are done */
+    stage.base = (char*)ncthreadbuffer(batch * runlen);
+    if(stage.base == NULL)
+        return NC_ENOMEM;
+    for(i = 0; i < batch; i++)
+        lengths[i] = runlen;
+
+    (void) memset(&sio, 0, sizeof(sio));
+    *((ncio_getfunc **)&sio.get) = ncv_stage_get; /* cast away const */
+    *((ncio_relfunc **)&sio.rel) = ncv_stage_rel; /* cast away const */
+    sio.ioflags = ncp->nciop->ioflags;
+    sio.pvt = &stage;
+    sncp.nciop = &sio;
+
+    while(nruns > 0)
+    {
+        const size_t n = MIN(batch, nruns);
+        int lstatus;
+
+        for(i = 0; i < n; i++)
+        {
+            offsets[i] = offset;
+            offset = odo1(start, upper, coord, steps, index, offset);
+        }
+        stage.nruns = n;
+        stage.cur = 0;
+
+        if(!rw)
+        {
+            lstatus = ncio_getv(ncp->nciop, n, offsets, lengths, stage.base);
+            if(lstatus != NC_NOERR)
+            {
+                status = lstatus;
+                break;
+            }
+        }
+        for(i = 0; i < n; i++)
+        {
+            lstatus = rw ? writeNCv(&sncp, varp, offsets[i], iocount, (void*)value, memtype)
+                         : readNCv(&sncp, varp, offsets[i], iocount, (void*)value, memtype);
+            if(lstatus != NC_NOERR)
+            {
+                if(lstatus != NC_ERANGE)
+                {
+                    status = lstatus;
+                    /* fatal for the loop */
+                    break;
+                }
+                /* else NC_ERANGE, not fatal for the loop */
+                if(status == NC_NOERR)
+                    status = lstatus;
+            }
+            value += memlen;
+        }
+        if(i < n)
+            break;
+        if(rw)
+        {
+            lstatus = ncio_putv(ncp->nciop, n, offsets, lengths, stage.base);
+            if(lstatus != NC_NOERR)
+            {
+                status = lstatus;
+                break;
+            }
+        }
+        nruns -= n;
+    }
+
+    if(sio.stats.convert_nsecs != 0)
+        NCIO_STAT(ncp->nciop, convert_nsecs, sio.stats.convert_nsecs);
+    return status;
+}
+
+/* End vectored */
+
 /**************************************************/
 
 int
@@ -1800,6 +2036,7 @@ NC3_get_vara(int ncid, int varid,
     NC_var *varp;
     int ii;
     size_t iocount;
+    size_t nruns;
     size_t memtypelen;
     signed char* value = (signed char*) value0; /* legally allow ptr arithmetic */
     const size_t* edges = edges0; /* so we can modify for special cases */
@@ -1850,7 +2087,8 @@ NC3_get_vara(int ncid, int varid,
 
     if(varp->ndims == 0) /* scalar variable */
     {
-        return( readNCv(nc3, varp, start, 1, (void*)value, memtype) );
+        return( readNCv(nc3, varp, NC_varoffset(nc3, varp, start), 1,
+                         (void*)value, memtype) );
     }
 
     if(IS_RECVAR(varp))
@@ -1860,7 +2098,8 @@ NC3_get_vara(int ncid, int varid,
         if(varp->ndims == 1 && nc3->recsize <= varp->len)
         {
             /* one dimensional && the only record variable  */
-            return( readNCv(nc3, varp, start, *edges, (void*)value, memtype) );
+            return( readNCv(nc3, varp, NC_varoffset(nc3, varp, start), *edges,
+                         (void*)value, memtype) );
         }
     }
 
@@ -1872,7 +2111,8 @@ NC3_get_vara(int ncid, int varid,
 
     if(ii == -1)
     {
-        return( readNCv(nc3, varp, start, iocount, (void*)value, memtype) );
+        return( readNCv(nc3, varp, NC_varoffset(nc3, varp, start), iocount,
+                         (void*)value, memtype) );
     }
 
     assert(ii >= 0);
@@ -1880,7 +2120,9 @@ NC3_get_vara(int ncid, int varid,
     { /* inline */
     ALLOC_ONSTACK(coord, size_t, varp->ndims);
     ALLOC_ONSTACK(upper, size_t, varp->ndims);
+    ALLOC_ONSTACK(steps, off_t, varp->ndims);
     const size_t index = (size_t)ii;
+    off_t offset;
 
     /* copy in starting indices */
     (void) memcpy(coord, start, varp->ndims * sizeof(size_t));
@@ -1888,10 +2130,19 @@ NC3_get_vara(int ncid, int varid,
     /* set up in maximum indices */
     set_upper(upper, start, edges, &upper[varp->ndims]);
 
+    /* the place of coord in the file, moved along by odo1() */
+    NCdimsteps(nc3, varp, steps);
+    offset = NC_varoffset(nc3, varp, coord);
+
+    nruns = NCvruns(nc3, varp, start, edges, ii, iocount, 0);
+    if(nruns != 0)
+        status = NCvv(nc3, varp, start, upper, coord, steps, offset, index,
+                      iocount, nruns, (void*)value, memtype, 0);
+
     /* ripple counter */
-    while(*coord < *upper)
+    while(nruns == 0 && *coord < *upper)
     {
-        const int lstatus = readNCv(nc3, varp, coord, iocount, (void*)value, memtype);
+        const int lstatus = readNCv(nc3, varp, offset, iocount, (void*)value, memtype);
 	if(lstatus != NC_NOERR)
         {
             if(lstatus != NC_ERANGE)
@@ -1905,9 +2156,10 @@ NC3_get_vara(int ncid, int varid,
                 status = lstatus;
         }
         value += (iocount * memtypelen);
-        odo1(start, upper, coord, &upper[index], &coord[index]);
+        offset = odo1(start, upper, coord, steps, index, offset);
     }
 
+    FREE_ONSTACK(steps);
     FREE_ONSTACK(upper);
     FREE_ONSTACK(coord);
     } /* end inline */
@@ -1927,6 +2179,7 @@ NC3_put_vara(int ncid, int varid,
     NC_var *varp;
     int ii;
     size_t iocount;
+    size_t nruns;
     size_t memtypelen;
     signed char* value = (signed char*) value0; /* legally allow ptr arithmetic */
     const size_t* edges = edges0; /* so we can modify for special cases */
@@ -1980,7 +2233,8 @@ NC3_put_vara(int ncid, int varid,
 
     if(varp->ndims == 0) /* scalar variable */
     {
-        return( writeNCv(nc3, varp, start, 1, (void*)value, memtype) );
+        return( writeNCv(nc3, varp, NC_varoffset(nc3, varp, start), 1,
+                         (void*)value, memtype) );
     }
 
     if(IS_RECVAR(varp))
@@ -1993,7 +2247,8 @@ NC3_put_vara(int ncid, int varid,
             && nc3->recsize <= varp->len)
         {
             /* one dimensional && the only record variable  */
-            return( writeNCv(nc3, varp, start, *edges, (void*)value, memtype) );
+            return( writeNCv(nc3, varp, NC_varoffset(nc3, varp, start), *edges,
+                         (void*)value, memtype) );
         }
     }
 
@@ -2005,7 +2260,8 @@ NC3_put_vara(int ncid, int varid,
 
     if(ii == -1)
     {
-        return( writeNCv(nc3, varp, start, iocount, (void*)value, memtype) );
+        return( writeNCv(nc3, varp, NC_varoffset(nc3, varp, start), iocount,
+                         (void*)value, memtype) );
     }
 
     assert(ii >= 0);
@@ -2013,7 +2269,9 @@ NC3_put_vara(int ncid, int varid,
     { /* inline */
     ALLOC_ONSTACK(coord, size_t, varp->ndims);
     ALLOC_ONSTACK(upper, size_t, varp->ndims);
+    ALLOC_ONSTACK(steps, off_t, varp->ndims);
     const size_t index = (size_t)ii;
+    off_t offset;
 
     /* copy in starting indices */
     (void) memcpy(coord, start, varp->ndims * sizeof(size_t));
@@ -2021,10 +2279,19 @@ NC3_put_vara(int ncid, int varid,
     /* set up in maximum indices */
     set_upper(upper, start, edges, &upper[varp->ndims]);
 
+    /* the place of coord in the file, moved along by odo1() */
+    NCdimsteps(nc3, varp, steps);
+    offset = NC_varoffset(nc3, varp, coord);
+
+    nruns = NCvruns(nc3, varp, start, edges, ii, iocount, 1);
+    if(nruns != 0)
+        status = NCvv(nc3, varp, start, upper, coord, steps, offset, index,
+                      iocount, nruns, (void*)value, memtype, 1);
+
     /* ripple counter */
-    while(*coord < *upper)
+    while(nruns == 0 && *coord < *upper)
     {
-        const int lstatus = writeNCv(nc3, varp, coord, iocount, (void*)value, memtype);
+        const int lstatus = writeNCv(nc3, varp, offset, iocount, (void*)value, memtype);
         if(lstatus != NC_NOERR)
         {
             if(lstatus != NC_ERANGE)
@@ -2038,9 +2305,10 @@ NC3_put_vara(int ncid, int varid,
                 status = lstatus;
         }
         value += (iocount * memtypelen);
-        odo1(start, upper, coord, &upper[index], &coord[index]);
+        offset = odo1(start, upper, coord, steps, index, offset);
     }
 
+    FREE_ONSTACK(steps);
     FREE_ONSTACK(upper);
     FREE_ONSTACK(coord);
     } /* end inline */
@@ -56,9 +56,92 @@ typedef struct v1hs {
 	void *base;	/* beginning of current buffer */
 	void *pos;	/* current position in buffer */
 	void *end;	/* end of current buffer = base + extent */
+	NC3_arena **arena; /* where objects read go, or NULL to malloc() them */
 } v1hs;
 
 
+/* Begin arena */
+
+/*
+ * The header of a file opened read only is never changed, nor are
+ * its objects freed one by one, so while reading it they are taken
+ * from a few large blocks, instead of a malloc() each, and freed all
+ * at once by NC3_arena_free(). The dims, attrs and vars of each array
+ * are contiguous.
+ */
+struct NC3_arena {
+	NC3_arena *next;	/* blocks allocated before */
+	size_t size;	/* bytes after the header */
+	size_t used;
+};
+
+/* Size of the first block; the next ones double, up to ARENA_MAXBLOCK */
+#define ARENA_BLOCK 16384
+#define ARENA_MAXBLOCK 4194304
+
+static void *
+arena_alloc(NC3_arena **arenap, size_t sz)
+{
+	const size_t hsz = M_RNDUP(sizeof(NC3_arena));
+	NC3_arena *ap = *arenap;
+	void *vp;
+
+	if(sz > SIZE_MAX - hsz - M_RND_UNIT)
+		return NULL;
+	sz = M_RNDUP(sz);
+	if(ap == NULL || ap->size - ap->used < sz)
+	{
+		size_t bsz = ARENA_BLOCK;
+		NC3_arena *np;
+
+		if(ap != NULL)
+			bsz = (ap->size < ARENA_MAXBLOCK / 2) ? 2 * ap->size : ARENA_MAXBLOCK;
+
+		if(sz > bsz / 4)
+		{
+			/* A block of its own, behind the current one */
+			np = (NC3_arena *)malloc(hsz + sz);
+			if(np == NULL)
+				return NULL;
+			np->size = np->used = sz;
+			if(ap == NULL)
+			{
+				np->next = NULL;
+				*arenap = np;
+			}
+			else
+			{
+				np->next = ap->next;
+				ap->next = np;
+			}
+			return (char *)np + hsz;
+		}
+		np = (NC3_arena *)malloc(hsz + bsz);
+		if(np == NULL)
+			return NULL;
+		np->next = ap;
+		np->size = bsz;
+		np->used = 0;
+		*arenap = ap = np;
+	}
+	vp = (char *)ap + hsz + ap->used;
+	ap->used += sz;
+	return vp;
+}
+
+void
+NC3_arena_free(NC3_arena *ap)
+{
+	while(ap != NULL)
+	{
+		NC3_arena *next = ap->next;
+		free(ap);
+		ap = next;
+	}
+}
+
+/* End arena */
+
 /*
  * Release the stream, invalidate buffer
  */
@@ -316,7 +399,21 @@ v1h_get_NC_string(v1hs *gsp, NC_string **ncstrpp)
 	if(status != NC_NOERR)
 		return status;
 
-	ncstrp = new_NC_string(nchars, NULL);
+	if(gsp->arena != NULL)
+	{
+		/* Same layout as new_NC_string() */
+		if (nchars > SIZE_MAX - M_RNDUP(sizeof(NC_string)) - 1)
+			return NC_ENOMEM;
+		ncstrp = (NC_string *)arena_alloc(gsp->arena,
+			M_RNDUP(sizeof(NC_string)) + nchars + 1);
+		if(ncstrp == NULL)
+			return NC_ENOMEM;
+		ncstrp->nchars = nchars;
+		ncstrp->cp = (char *)ncstrp + M_RNDUP(sizeof(NC_string));
+		ncstrp->cp[nchars] = 0;
+	}
+	else
+		ncstrp = new_NC_string(nchars, NULL);
 	if(ncstrp == NULL)
 	{
 		return NC_ENOMEM;
@@ -347,7 +444,8 @@ v1h_get_NC_string(v1hs *gsp, NC_string **ncstrpp)
 		char pad[X_ALIGN-1];
 		memset(pad, 0, X_ALIGN-1);
 		if (memcmp((char*)gsp->pos-padding, pad, padding) != 0) {
-			free_NC_string(ncstrp);
+			if(gsp->arena == NULL)
+				free_NC_string(ncstrp);
 			return NC_ENULLPAD;
 		}
 	}
@@ -358,7 +456,8 @@ v1h_get_NC_string(v1hs *gsp, NC_string **ncstrpp)
 	return NC_NOERR;
 
 unwind_alloc:
-	free_NC_string(ncstrp);
+	if(gsp->arena == NULL)
+		free_NC_string(ncstrp);
 	return status;
 }
 
@@ -401,9 +500,12 @@ v1h_put_NC_dim(v1hs *psp, const NC_dim *dimp)
     return NC_NOERR;
 }
 
-/* Read a NC_dim from the header */
+/*
+ * Read a NC_dim from the header.
+ * If not NULL, slot is the arena space for it.
+ */
 static int
-v1h_get_NC_dim(v1hs *gsp, NC_dim **dimpp)
+v1h_get_NC_dim(v1hs *gsp, NC_dim *slot, NC_dim **dimpp)
 {
 	int status;
 	NC_string *ncstrp;
@@ -413,7 +515,14 @@ v1h_get_NC_dim(v1hs *gsp, NC_dim **dimpp)
     if(status != NC_NOERR)
 		return status;
 
-	dimp = new_x_NC_dim(ncstrp);
+	if(slot != NULL)
+	{
+		dimp = slot;
+		dimp->name = ncstrp;
+		dimp->size = 0;
+	}
+	else
+		dimp = new_x_NC_dim(ncstrp);
 	if(dimp == NULL)
 	{
 		status = NC_ENOMEM;
@@ -423,7 +532,8 @@ v1h_get_NC_dim(v1hs *gsp, NC_dim **dimpp)
 	status = v1h_get_size_t(gsp, &dimp->size);
     if(status != NC_NOERR)
 	{
-		free_NC_dim(dimp); /* frees name */
+		if(slot == NULL)
+			free_NC_dim(dimp); /* frees name */
 		return status;
 	}
 
@@ -432,7 +542,8 @@ v1h_get_NC_dim(v1hs *gsp, NC_dim **dimpp)
     return NC_NOERR;
 
 unwind_name:
-	free_NC_string(ncstrp);
+	if(gsp->arena == NULL)
+		free_NC_string(ncstrp);
 	return status;
 }
 
@@ -522,6 +633,7 @@ v1h_get_NC_dimarray(v1hs *gsp, NC_dimarray *ncap)
 {
 	int status;
 	NCtype type = NC_UNSPECIFIED;
+	NC_dim *slots = NULL;
 
 	assert(gsp != NULL && gsp->pos != NULL);
 	assert(ncap != NULL);
@@ -543,7 +655,23 @@ v1h_get_NC_dimarray(v1hs *gsp, NC_dimarray *ncap)
 
 	if (ncap->nelems > SIZE_MAX / sizeof(NC_dim *))
 		return NC_ERANGE;
-	ncap->value = (NC_dim **) calloc(1,ncap->nelems * sizeof(NC_dim *));
+	if(gsp->arena != NULL)
+	{
+		if (ncap->nelems > SIZE_MAX / (sizeof(NC_dim *) + sizeof(NC_dim)))
+			return NC_ERANGE;
+		ncap->value = (NC_dim **) arena_alloc(gsp->arena,
+			ncap->nelems * sizeof(NC_dim *));
+		if(ncap->value != NULL)
+			slots = (NC_dim *) arena_alloc(gsp->arena,
+				ncap->nelems * sizeof(NC_dim));
+		if(slots == NULL)
+		{
+			ncap->value = NULL;
+			return NC_ENOMEM;
+		}
+	}
+	else
+		ncap->value = (NC_dim **) calloc(1,ncap->nelems * sizeof(NC_dim *));
 	if(ncap->value == NULL)
 		return NC_ENOMEM;
 	ncap->nalloc = ncap->nelems;
@@ -555,11 +683,14 @@ v1h_get_NC_dimarray(v1hs *gsp, NC_dimarray *ncap)
 		NC_dim *const *const end = &dpp[ncap->nelems];
 		for( /*NADA*/; dpp < end; dpp++)
 		{
-			status = v1h_get_NC_dim(gsp, dpp);
+			status = v1h_get_NC_dim(gsp,
+				slots != NULL ? &slots[dpp - ncap->value] : NULL, dpp);
 			if(status)
 			{
 				ncap->nelems = (size_t)(dpp - ncap->value);
-				free_NC_dimarrayV(ncap);
+				/* With an arena, it goes with the rest of the header */
+				if(gsp->arena == NULL)
+					free_NC_dimarrayV(ncap);
 				return status;
 			}
 			{
@@ -742,9 +873,12 @@ v1h_get_NC_attrV(v1hs *gsp, NC_attr *attrp)
 }
 
 
-/* Read a NC_attr from the header */
+/*
+ * Read a NC_attr from the header.
+ * If not NULL, slot is the arena space for it.
+ */
 static int
-v1h_get_NC_attr(v1hs *gsp, NC_attr **attrpp)
+v1h_get_NC_attr(v1hs *gsp, NC_attr *slot, NC_attr **attrpp)
 {
 	NC_string *strp;
 	int status;
@@ -764,7 +898,24 @@ v1h_get_NC_attr(v1hs *gsp, NC_attr **attrpp)
     if(status != NC_NOERR)
 		goto unwind_name;
 
-	attrp = new_x_NC_attr(strp, type, nelems);
+	if(slot != NULL)
+	{
+		/* As new_x_NC_attr() does, with the value in the arena */
+		attrp = slot;
+		attrp->xsz = ncx_len_NC_attrV(type, nelems);
+		attrp->name = strp;
+		attrp->type = type;
+		attrp->nelems = nelems;
+		attrp->xvalue = NULL;
+		if(attrp->xsz != 0)
+		{
+			attrp->xvalue = arena_alloc(gsp->arena, attrp->xsz);
+			if(attrp->xvalue == NULL)
+				attrp = NULL;
+		}
+	}
+	else
+		attrp = new_x_NC_attr(strp, type, nelems);
 	if(attrp == NULL)
 	{
 		status = NC_ENOMEM;
@@ -774,7 +925,8 @@ v1h_get_NC_attr(v1hs *gsp, NC_attr **attrpp)
 	status = v1h_get_NC_attrV(gsp, attrp);
         if(status != NC_NOERR)
 	{
-		free_NC_attr(attrp); /* frees strp */
+		if(slot == NULL)
+			free_NC_attr(attrp); /* frees strp */
 		return status;
 	}
 
@@ -783,7 +935,8 @@ v1h_get_NC_attr(v1hs *gsp, NC_attr **attrpp)
     return NC_NOERR;
 
 unwind_name:
-	free_NC_string(strp);
+	if(gsp->arena == NULL)
+		free_NC_string(strp);
 	return status;
 }
 
@@ -873,6 +1026,7 @@ v1h_get_NC_attrarray(v1hs *gsp, NC_attrarray *ncap)
 {
 	int status;
 	NCtype type = NC_UNSPECIFIED;
+	NC_attr *slots = NULL;
 
 	assert(gsp != NULL && gsp->pos != NULL);
 	assert(ncap != NULL);
@@ -891,7 +1045,23 @@ v1h_get_NC_attrarray(v1hs *gsp, NC_attrarray *ncap)
 	if(type != NC_ATTRIBUTE)
 		return EINVAL;
 
-	ncap->value = (NC_attr **) malloc(ncap->nelems * sizeof(NC_attr *));
+	if(gsp->arena != NULL)
+	{
+		if (ncap->nelems > SIZE_MAX / (sizeof(NC_attr *) + sizeof(NC_attr)))
+			return NC_ERANGE;
+		ncap->value = (NC_attr **) arena_alloc(gsp->arena,
+			ncap->nelems * sizeof(NC_attr *));
+		if(ncap->value != NULL)
+			slots = (NC_attr *) arena_alloc(gsp->arena,
+				ncap->nelems * sizeof(NC_attr));
+		if(slots == NULL)
+		{
+			ncap->value = NULL;
+			return NC_ENOMEM;
+		}
+	}
+	else
+		ncap->value = (NC_attr **) malloc(ncap->nelems * sizeof(NC_attr *));
 	if(ncap->value == NULL)
 		return NC_ENOMEM;
 	ncap->nalloc = ncap->nelems;
@@ -901,11 +1071,14 @@ v1h_get_NC_attrarray(v1hs *gsp, NC_attrarray *ncap)
 		NC_attr *const *const end = &app[ncap->nelems];
 		for( /*NADA*/; app < end; app++)
 		{
-			status = v1h_get_NC_attr(gsp, app);
+			status = v1h_get_NC_attr(gsp,
+				slots != NULL ? &slots[app - ncap->value] : NULL, app);
 			if(status)
 			{
 				ncap->nelems = (size_t)(app - ncap->value);
-				free_NC_attrarrayV(ncap);
+				/* With an arena, it goes with the rest of the header */
+				if(gsp->arena == NULL)
+					free_NC_attrarrayV(ncap);
 				return status;
 			}
 		}
@@ -1015,9 +1188,12 @@ v1h_put_NC_var(v1hs *psp, const NC_var *varp)
 }
 
 
-/* Read a NC_var from the header */
+/*
+ * Read a NC_var from the header.
+ * If not NULL, slot is the arena space for it.
+ */
 static int
-v1h_get_NC_var(v1hs *gsp, NC_var **varpp)
+v1h_get_NC_var(v1hs *gsp, NC_var *slot, NC_var **varpp)
 {
 	NC_string *strp;
 	int status;
@@ -1032,7 +1208,29 @@ v1h_get_NC_var(v1hs *gsp, NC_var **varpp)
     if(status != NC_NOERR)
 		goto unwind_name;
 
-	varp = new_x_NC_var(strp, ndims);
+	if(slot != NULL)
+	{
+		/* As new_x_NC_var() does with MALLOCHACK, in the arena */
+		const size_t o1 = M_RNDUP(ndims * sizeof(int));
+		const size_t o2 = M_RNDUP(ndims * sizeof(size_t));
+		void *vp = NULL;
+
+		varp = slot;
+		(void) memset(varp, 0, sizeof(NC_var));
+		varp->name = strp;
+		varp->ndims = ndims;
+		if(ndims != 0 && ndims < SIZE_MAX / 32
+		   && (vp = arena_alloc(gsp->arena, o1 + o2 + ndims * sizeof(off_t))) != NULL)
+		{
+			varp->dimids = (int *)vp;
+			varp->shape = (size_t *)((char *)vp + o1);
+			varp->dsizes = (off_t *)((char *)vp + o1 + o2);
+		}
+		else if(ndims != 0)
+			varp = NULL;
+	}
+	else
+		varp = new_x_NC_var(strp, ndims);
 	if(varp == NULL)
 	{
 		status = NC_ENOMEM;
@@ -1082,11 +1280,13 @@ v1h_get_NC_var(v1hs *gsp, NC_var **varpp)
     return NC_NOERR;
 
 unwind_alloc:
-	free_NC_var(varp); /* frees name */
+	if(slot == NULL)
+		free_NC_var(varp); /* frees name */
 	return status;
 
 unwind_name:
-	free_NC_string(strp);
+	if(gsp->arena == NULL)
+		free_NC_string(strp);
 	return status;
 }
 
@@ -1176,6 +1376,7 @@ v1h_get_NC_vararray(v1hs *gsp, NC_vararray *ncap)
 {
 	int status;
 	NCtype type = NC_UNSPECIFIED;
+	NC_var *slots = NULL;
 
 	assert(gsp != NULL && gsp->pos != NULL);
 	assert(ncap != NULL);
@@ -1197,7 +1398,25 @@ v1h_get_NC_vararray(v1hs *gsp, NC_vararray *ncap)
 	
 	if (ncap->nelems > SIZE_MAX / sizeof(NC_var *))
 		return NC_ERANGE;
-	ncap->value = (NC_var **) calloc(1,ncap->nelems * sizeof(NC_var *));
+	if(gsp->arena != NULL)
+	{
+		/* The vars are one array, walked in order when checking
+		   the header and computing offsets */
+		if (ncap->nelems > SIZE_MAX / (sizeof(NC_var *) + sizeof(NC_var)))
+			return NC_ERANGE;
+		ncap->value = (NC_var **) arena_alloc(gsp->arena,
+			ncap->nelems * sizeof(NC_var *));
+		if(ncap->value != NULL)
+			slots = (NC_var *) arena_alloc(gsp->arena,
+				ncap->nelems * sizeof(NC_var));
+		if(slots == NULL)
+		{
+			ncap->value = NULL;
+			return NC_ENOMEM;
+		}
+	}
+	else
+		ncap->value = (NC_var **) calloc(1,ncap->nelems * sizeof(NC_var *));
 	if(ncap->value == NULL)
 		return NC_ENOMEM;
 	ncap->nalloc = ncap->nelems;
@@ -1210,11 +1429,14 @@ v1h_get_NC_vararray(v1hs *gsp, NC_vararray *ncap)
 		NC_var *const *const end = &vpp[ncap->nelems];
 		for( /*NADA*/; vpp < end; vpp++)
 		{
-			status = v1h_get_NC_var(gsp, vpp);
+			status = v1h_get_NC_var(gsp,
+				slots != NULL ? &slots[vpp - ncap->value] : NULL, vpp);
 			if(status)
 			{
 				ncap->nelems = (size_t)(vpp - ncap->value);
-				free_NC_vararrayV(ncap);
+				/* With an arena, it goes with the rest of the header */
+				if(gsp->arena == NULL)
+					free_NC_vararrayV(ncap);
 				return status;
 			}
 			{
@@ -1347,6 +1569,7 @@ ncx_put_NC(const NC3_INFO* ncp, void **xpp, off_t offset, size_t extent)
 
 	ps.nciop = ncp->nciop;
 	ps.flags = RGN_WRITE;
+	ps.arena = NULL;
 
 	if (ncp->flags & NC_64BIT_DATA)
 	  ps.version = 5;
@@ -1451,6 +1674,9 @@ nc_get_NC(NC3_INFO* ncp)
 	gs.version = 0;
 	gs.base = NULL;
 	gs.pos = gs.base;
+	/* The header of a read only file is never changed */
+	assert(ncp->arena == NULL);
+	gs.arena = NC_readonly(ncp) ? &ncp->arena : NULL;
 
 	{
 		/*
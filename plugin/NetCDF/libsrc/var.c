@@ -381,12 +381,17 @@ NC_findvar(const NC_vararray *ncap, const char *uname, NC_var **varpp)
 	if(ncap->nelems == 0)
 	    goto done;
 
-	/* normalized version of uname */
-        if(nc_utf8_normalize((const unsigned char *)uname,(unsigned char **)&name))
-	    goto done;
-
-	if(NC_hashmapget(ncap->hashmap, name, strlen(name), &data) == 0)
-	    goto done;
+	/* Stored names are normalized, and a name stored as given is its
+	   own normal form, so only normalize uname if it is not found as
+	   is and could differ from its normal form (is not ASCII) */
+	if(NC_hashmapget(ncap->hashmap, uname, strlen(uname), &data) == 0) {
+	    if(nc_utf8_isascii((const unsigned char *)uname, strlen(uname)))
+		goto done;
+	    if(nc_utf8_normalize((const unsigned char *)uname,(unsigned char **)&name))
+		goto done;
+	    if(NC_hashmapget(ncap->hashmap, name, strlen(name), &data) == 0)
+		goto done;
+	}
 
 	hash_var_id = (int)data;
         if (varpp != NULL)
@@ -106,6 +106,59 @@ nc_get_chunk_cache(size_t *sizep, size_t *nelemsp, float *preemptionp)
     return NC_NOERR;
 }
 
+/**
+ * Set the number of threads used to run the filter pipeline
+ * (shuffle, deflate, fletcher32) of chunked netCDF-4/HDF5 variables.
+ *
+ * By default HDF5 compresses and decompresses chunks one at a time
+ * on the calling thread. When more than one thread is requested,
+ * writes and reads that cover whole chunks of a filtered variable
+ * are split into chunks, which are (de)compressed by a pool of
+ * worker threads and moved to and from the file with HDF5 direct
+ * chunk I/O. The bytes stored for each chunk are the same as those
+ * written by the HDF5 pipeline, so files are interchangeable.
+ *
+ * Variables using filters that the library cannot run itself
+ * (szip, zstd and other plugins), non-native byte order, strided
+ * access, variable length types and parallel I/O always use the
+ * HDF5 pipeline.
+ *
+ * @param nthreads Number of threads, including the calling one. 0
+ * or 1 disables the threaded pipeline.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EINVAL Negative nthreads.
+ * @ingroup datasets
+ */
+int
+nc_set_chunk_threads(int nthreads)
+{
+    NCglobalstate* gs = NC_getglobalstate();
+    if (nthreads < 0)
+        return NC_EINVAL;
+    gs->chunkthreads = nthreads;
+    return NC_NOERR;
+}
+
+/**
+ * Get the number of threads used to run the chunk filter pipeline,
+ * as set by nc_set_chunk_threads().
+ *
+ * @param nthreadsp Pointer that gets the number of threads. Ignored
+ * if NULL.
+ *
+ * @return ::NC_NOERR No error.
+ * @ingroup datasets
+ */
+int
+nc_get_chunk_threads(int *nthreadsp)
+{
+    NCglobalstate* gs = NC_getglobalstate();
+    if (nthreadsp)
+        *nthreadsp = gs->chunkthreads;
+    return NC_NOERR;
+}
+
 /**
  * @internal Set the chunk cache. This is like nc_set_chunk_cache()
  * but with integers instead of size_t, and with an integer preemption
@@ -15,7 +15,6 @@
 #include "nc4internal.h"
 #include "nc4dispatch.h"
 #include "nc.h"
-#include "ncudfplugins.h"
 
 /* If user-defined formats are in use, we need to declare their
  * dispatch tables. */
@@ -67,15 +66,13 @@ NC4_initialize(void)
 #endif
 #endif
 
-#if defined(USE_HDF5) || defined(NETCDF_ENABLE_NCZARR)
+    /* The plugin paths are set up when HDF5 is started, at the first
+       netCDF-4 open or create (NC_HDF5_startup()); the UDF plugins of
+       the rc files are loaded by the first open or create and the
+       reserved attribute table is sorted by its first lookup */
+#ifdef NETCDF_ENABLE_NCZARR
     nc_plugin_path_initialize();
 #endif
-
-    /* Load UDF plugins from RC file configuration */
-    if ((ret = NC_udf_load_plugins()))
-        return ret;
-
-    NC_initialize_reserved();
     return ret;
 }
 
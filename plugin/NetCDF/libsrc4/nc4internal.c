@@ -65,6 +65,7 @@ static NC_reservedatt NC_reserved[] = {
 static int NC4_move_in_NCList(NC* nc, int new_id);
 static int bincmp(const void* arg1, const void* arg2);
 static int sortcmp(const void* arg1, const void* arg2);
+static void arena_free(NC_FILE_INFO_T *h5);
 
 #if LOGGING
 /* This is the severity level of messages which will be logged. Use
@@ -176,6 +177,14 @@ nc4_check_name(const char *name, char *norm_name)
     if ((retval = NC_check_name(name)))
         return retval;
 
+    /* An ASCII name is its own normal form. NC_check_name() has
+     * already checked its length. */
+    if (nc_utf8_isascii((const unsigned char *)name, strlen(name)))
+    {
+        strcpy(norm_name, name);
+        return NC_NOERR;
+    }
+
     /* Normalize the name. */
     if ((retval = nc_utf8_normalize((const unsigned char *)name,
                                     (unsigned char **)&temp)))
@@ -375,6 +384,7 @@ nc4_nc4f_list_add(NC *nc, const char *path, int mode)
         nclistfree(h5->alldims);
         nclistfree(h5->alltypes);
         nclistfree(h5->allgroups);
+        arena_free(h5);
         free(h5);
         nc->dispatchdata = NULL;
         return retval;
@@ -456,6 +466,11 @@ nc4_find_nc_grp_h5(int ncid, NC **nc, NC_GRP_INFO_T **grp, NC_FILE_INFO_T **h5)
     if (!(my_grp = nclistget(my_h5->allgroups,index)))
         return NC_EBADID;
 
+    /* Read the group's contents, if the file was opened lazily and
+     * this is the first access to the group. */
+    if (my_grp->lazy && (retval = nc4_read_grp(my_grp)))
+        return retval;
+
     /* Return pointers to caller, if desired. */
     if (nc)
         *nc = my_nc;
@@ -467,6 +482,34 @@ nc4_find_nc_grp_h5(int ncid, NC **nc, NC_GRP_INFO_T **grp, NC_FILE_INFO_T **h5)
     return NC_NOERR;
 }
 
+/**
+ * @internal Read the contents (types, dims, vars and child groups) of
+ * a group whose reading was deferred when the file was opened. The
+ * reading is done by the format, through the read_grp function of the
+ * file. Nothing is done for groups which have been read already.
+ *
+ * @param grp Pointer to group info struct.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EHDFERR Error reading the group from the file.
+ */
+int
+nc4_read_grp(NC_GRP_INFO_T *grp)
+{
+    NC_FILE_INFO_T *h5;
+
+    assert(grp && grp->nc4_info);
+    if (!grp->lazy)
+        return NC_NOERR;
+    h5 = grp->nc4_info;
+    if (!h5->read_grp)
+        return NC_EINTERNAL;
+
+    /* The format clears grp->lazy before reading, so that lookups
+     * made while reading do not recurse. */
+    return h5->read_grp(grp);
+}
+
 /**
  * @internal Given an ncid and varid, get pointers to the group and var
  * metadata.
@@ -589,6 +632,7 @@ nc4_rec_find_named_type(NC_GRP_INFO_T *start_grp, char *name)
     for(size_t i=0;i<ncindexsize(start_grp->children);i++) {
         g = (NC_GRP_INFO_T*)ncindexith(start_grp->children,i);
         if(g == NULL) continue;
+        if(g->lazy && nc4_read_grp(g)) continue;
         if ((res = nc4_rec_find_named_type(g, name)))
             return res;
     }
@@ -718,6 +762,118 @@ nc4_find_nc_att(int ncid, int varid, const char *name, int attnum,
     return nc4_find_grp_att(grp, varid, name, attnum, att);
 }
 
+/**
+ * @internal A block of the arena of a file. The groups, vars, dims
+ * and atts of a file, their names and the dims of the vars are
+ * carved out of these blocks, which are freed all at once when the
+ * file is closed. Objects deleted or renamed before then leave their
+ * old space unused in the arena.
+ */
+struct NC4_arena
+{
+    struct NC4_arena *next; /**< Block allocated before. */
+    size_t size;            /**< Bytes after the header. */
+    size_t used;            /**< Bytes handed out. */
+};
+
+/** @internal Size of the first block; the next ones double, up to
+ * ARENA_MAXBLOCK. */
+#define ARENA_BLOCK 16384
+#define ARENA_MAXBLOCK 1048576
+/** @internal Alignment of what the arena hands out. */
+#define ARENA_ALIGN 8
+#define ARENA_RNDUP(x) (((x) + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1))
+
+/**
+ * @internal Get zeroed memory from the arena of a file.
+ *
+ * @param h5 Pointer to file info.
+ * @param size Bytes wanted.
+ *
+ * @return Pointer to the memory, or NULL if out of memory.
+ */
+static void *
+arena_alloc(NC_FILE_INFO_T *h5, size_t size)
+{
+    const size_t hsize = ARENA_RNDUP(sizeof(struct NC4_arena));
+    struct NC4_arena *ap = h5->arena;
+    void *p;
+
+    size = ARENA_RNDUP(size);
+    if (ap == NULL || ap->size - ap->used < size)
+    {
+        struct NC4_arena *np;
+        size_t bsize = ARENA_BLOCK;
+
+        if (ap)
+            bsize = ap->size < ARENA_MAXBLOCK / 2 ? 2 * ap->size : ARENA_MAXBLOCK;
+
+        if (size > bsize / 4)
+        {
+            /* A block of its own, behind the current one. */
+            if (!(np = calloc(1, hsize + size)))
+                return NULL;
+            np->size = np->used = size;
+            if (ap)
+            {
+                np->next = ap->next;
+                ap->next = np;
+            }
+            else
+                h5->arena = np;
+            return (char *)np + hsize;
+        }
+        if (!(np = calloc(1, hsize + bsize)))
+            return NULL;
+        np->next = ap;
+        np->size = bsize;
+        h5->arena = ap = np;
+    }
+    p = (char *)ap + hsize + ap->used;
+    ap->used += size;
+    return p;
+}
+
+/**
+ * @internal Free the arena of a file, and with it all the objects
+ * allocated from it.
+ *
+ * @param h5 Pointer to file info.
+ */
+static void
+arena_free(NC_FILE_INFO_T *h5)
+{
+    struct NC4_arena *ap = h5->arena;
+
+    while (ap)
+    {
+        struct NC4_arena *next = ap->next;
+        free(ap);
+        ap = next;
+    }
+    h5->arena = NULL;
+}
+
+/**
+ * @internal Copy a name into the arena of a file. Renames use this
+ * too, as names in the arena must not be freed.
+ *
+ * @param h5 Pointer to file info.
+ * @param name The name.
+ *
+ * @return Pointer to the copy, or NULL if out of memory.
+ */
+char *
+nc4_arena_strdup(NC_FILE_INFO_T *h5, const char *name)
+{
+    size_t len = strlen(name) + 1;
+    char *copy;
+
+    if ((copy = arena_alloc(h5, len)))
+        memcpy(copy, name, len);
+    return copy;
+}
+
 /**
  * @internal Add NC_OBJ to allXXX lists in a file
  *
@@ -761,7 +917,7 @@ nc4_var_list_add2(NC_GRP_INFO_T *grp, const char *name, NC_VAR_INFO_T **var)
     NCglobalstate* gs = NC_getglobalstate();
 
     /* Allocate storage for new variable. */
-    if (!(new_var = calloc(1, sizeof(NC_VAR_INFO_T))))
+    if (!(new_var = arena_alloc(grp->nc4_info, sizeof(NC_VAR_INFO_T))))
         return NC_ENOMEM;
     new_var->hdr.sort = NCVAR;
     new_var->container = grp;
@@ -775,11 +931,8 @@ nc4_var_list_add2(NC_GRP_INFO_T *grp, const char *name, NC_VAR_INFO_T **var)
 
     /* Now fill in the values in the var info structure. */
     new_var->hdr.id = (int)ncindexsize(grp->vars);
-    if (!(new_var->hdr.name = strdup(name))) {
-      if(new_var)
-        free(new_var);
+    if (!(new_var->hdr.name = nc4_arena_strdup(grp->nc4_info, name)))
       return NC_ENOMEM;
-    }
 
     /* Create an indexed list for the attributes. */
     new_var->att = ncindexnew(0);
@@ -815,9 +968,11 @@ nc4_var_set_ndims(NC_VAR_INFO_T *var, int ndims)
     /* Allocate space for dimension information. */
     if (ndims)
     {
-      if (!(var->dim = calloc((size_t)ndims, sizeof(NC_DIM_INFO_T *))))
+      NC_FILE_INFO_T *h5 = var->container->nc4_info;
+
+      if (!(var->dim = arena_alloc(h5, (size_t)ndims * sizeof(NC_DIM_INFO_T *))))
             return NC_ENOMEM;
-      if (!(var->dimids = calloc((size_t)ndims, sizeof(int))))
+      if (!(var->dimids = arena_alloc(h5, (size_t)ndims * sizeof(int))))
             return NC_ENOMEM;
 
         /* Initialize dimids to illegal values (-1). See the comment
@@ -876,7 +1031,7 @@ nc4_dim_list_add(NC_GRP_INFO_T *grp, const char *name, size_t len,
     assert(grp && name);
 
     /* Allocate memory for dim metadata. */
-    if (!(new_dim = calloc(1, sizeof(NC_DIM_INFO_T))))
+    if (!(new_dim = arena_alloc(grp->nc4_info, sizeof(NC_DIM_INFO_T))))
         return NC_ENOMEM;
 
     new_dim->hdr.sort = NCDIM;
@@ -888,12 +1043,8 @@ nc4_dim_list_add(NC_GRP_INFO_T *grp, const char *name, size_t len,
         new_dim->hdr.id = grp->nc4_info->next_dimid++;
 
     /* Remember the name and create a hash. */
-    if (!(new_dim->hdr.name = strdup(name))) {
-      if(new_dim)
-        free(new_dim);
-
+    if (!(new_dim->hdr.name = nc4_arena_strdup(grp->nc4_info, name)))
       return NC_ENOMEM;
-    }
 
     /* Is dimension unlimited? */
     new_dim->len = len;
@@ -917,6 +1068,7 @@ nc4_dim_list_add(NC_GRP_INFO_T *grp, const char *name, size_t len,
 /**
  * @internal Add to an attribute list.
  *
+ * @param h5 Pointer to the file info.
  * @param list NCindex of att info structs.
  * @param name name of the new attribute
  * @param att Pointer to pointer that gets the new att info
@@ -927,23 +1079,21 @@ nc4_dim_list_add(NC_GRP_INFO_T *grp, const char *name, size_t len,
  * @author Ed Hartnett
  */
 int
-nc4_att_list_add(NCindex *list, const char *name, NC_ATT_INFO_T **att)
+nc4_att_list_add(NC_FILE_INFO_T *h5, NCindex *list, const char *name,
+                 NC_ATT_INFO_T **att)
 {
     NC_ATT_INFO_T *new_att = NULL;
 
     LOG((3, "%s: name %s ", __func__, name));
 
-    if (!(new_att = calloc(1, sizeof(NC_ATT_INFO_T))))
+    if (!(new_att = arena_alloc(h5, sizeof(NC_ATT_INFO_T))))
         return NC_ENOMEM;
     new_att->hdr.sort = NCATT;
 
     /* Fill in the information we know. */
     new_att->hdr.id = (int)ncindexsize(list);
-    if (!(new_att->hdr.name = strdup(name))) {
-      if(new_att)
-        free(new_att);
+    if (!(new_att->hdr.name = nc4_arena_strdup(h5, name)))
       return NC_ENOMEM;
-    }
 
     /* Add object to list as specified by its number */
     ncindexadd(list, (NC_OBJ *)new_att);
@@ -980,7 +1130,7 @@ nc4_grp_list_add(NC_FILE_INFO_T *h5, NC_GRP_INFO_T *parent, char *name,
     LOG((3, "%s: name %s ", __func__, name));
 
     /* Get the memory to store this groups info. */
-    if (!(new_grp = calloc(1, sizeof(NC_GRP_INFO_T))))
+    if (!(new_grp = arena_alloc(h5, sizeof(NC_GRP_INFO_T))))
         return NC_ENOMEM;
 
     /* Fill in this group's information. */
@@ -993,11 +1143,8 @@ nc4_grp_list_add(NC_FILE_INFO_T *h5, NC_GRP_INFO_T *parent, char *name,
     assert(parent || !new_grp->hdr.id);
 
     /* Handle the group name. */
-    if (!(new_grp->hdr.name = strdup(name)))
-    {
-        free(new_grp);
+    if (!(new_grp->hdr.name = nc4_arena_strdup(h5, name)))
         return NC_ENOMEM;
-    }
 
     /* Set up new indexed lists for stuff this group can contain. */
     new_grp->children = ncindexnew(0);
@@ -1200,6 +1347,11 @@ nc4_field_list_add(NC_TYPE_INFO_T *parent, const char *name,
     field->hdr.id = (int)nclistlength(parent->u.c.field);
     nclistpush(parent->u.c.field,field);
 
+    /* The pointer members are found again when next needed. */
+    free(parent->ptrs);
+    parent->ptrs = NULL;
+    parent->nptrs = 0;
+
     return NC_NOERR;
 }
 
@@ -1308,6 +1460,7 @@ nc4_type_free(NC_TYPE_INFO_T *type)
                 field_free(field);
             }
             nclistfree(type->u.c.field);
+            free(type->ptrs);
         }
         break;
 
@@ -1353,10 +1506,8 @@ nc4_att_free(NC_ATT_INFO_T *att)
     assert(att);
     LOG((3, "%s: name %s ", __func__, att->hdr.name));
 
-    /* Free the name. */
-    if (att->hdr.name)
-        free(att->hdr.name);
-
+    /* The att and its name are in the arena of the file; only the
+     * data is freed here. */
     if (att->data) {
 	NC_OBJ* parent;
 	NC_FILE_INFO_T* h5 = NULL;
@@ -1373,7 +1524,6 @@ nc4_att_free(NC_ATT_INFO_T *att)
     }
 
 done:
-    free(att);
     return stat;
 }
 
@@ -1407,12 +1557,6 @@ var_free(NC_VAR_INFO_T *var)
     if (var->alt_name)
         free(var->alt_name);
 
-    if (var->dimids)
-        free(var->dimids);
-
-    if (var->dim)
-        free(var->dim);
-
     memset(&var->chunkcache,0,sizeof(struct ChunkCache));
 
     /* Delete any fill value allocation. */
@@ -1427,13 +1571,7 @@ var_free(NC_VAR_INFO_T *var)
         if ((retval = nc4_type_free(var->type_info)))
             return retval;
 
-    /* Do this last because debugging may need it */
-    if (var->hdr.name)
-        free(var->hdr.name);
-
-    /* Delete the var. */
-    free(var);
-
+    /* The var, its name and dims stay in the arena of the file. */
     return NC_NOERR;
 }
 
@@ -1475,11 +1613,7 @@ dim_free(NC_DIM_INFO_T *dim)
     assert(dim);
     LOG((4, "%s: deleting dim %s", __func__, dim->hdr.name));
 
-    /* Free memory allocated for names. */
-    if (dim->hdr.name)
-        free(dim->hdr.name);
-
-    free(dim);
+    /* The dim and its name stay in the arena of the file. */
     return NC_NOERR;
 }
 
@@ -1556,12 +1690,8 @@ nc4_rec_grp_del(NC_GRP_INFO_T *grp)
             return retval;
     ncindexfree(grp->type);
 
-    /* Free the name. */
-    free(grp->hdr.name);
-
-    /* Free up this group */
-    free(grp);
-
+    /* The group and its name stay in the arena of the file, freed with
+     * it by nc4_nc4f_list_del(). */
     return NC_NOERR;
 }
 
@@ -1698,6 +1828,9 @@ nc4_nc4f_list_del(NC_FILE_INFO_T *h5)
     nclistfree(h5->allgroups);
     nclistfree(h5->alltypes);
 
+    /* Free the groups, vars, dims and atts all at once. */
+    arena_free(h5);
+
     /* Free the NC_FILE_INFO_T struct. */
     nullfree(h5->hdr.name);
     free(h5);
@@ -1722,7 +1855,18 @@ int
 nc4_normalize_name(const char *name, char *norm_name)
 {
     char *temp_name;
-    int stat = nc_utf8_normalize((const unsigned char *)name,(unsigned char **)&temp_name);
+    size_t len = strlen(name);
+    int stat;
+
+    /* An ASCII name is its own normal form; no need to allocate it */
+    if (nc_utf8_isascii((const unsigned char *)name, len))
+    {
+        if (len > NC_MAX_NAME)
+            return NC_EMAXNAME;
+        memcpy(norm_name, name, len + 1);
+        return NC_NOERR;
+    }
+    stat = nc_utf8_normalize((const unsigned char *)name,(unsigned char **)&temp_name);
     if(stat != NC_NOERR)
         return stat;
     if (strlen(temp_name) > NC_MAX_NAME)
@@ -2050,6 +2194,7 @@ NC4_show_metadata(int ncid)
 const NC_reservedatt*
 NC_findreserved(const char* name)
 {
+    NC_initialize_reserved();
 #if 0
     int n = NRESERVED;
     int L = 0;
@@ -2101,9 +2246,19 @@ bincmp(const void* arg1, const void* arg2)
     return strcmp(name,ra->name);
 }
 
-void
-NC_initialize_reserved(void)
+static int
+sortreserved(void)
 {
     /* Guarantee the reserved attribute list is sorted */
     qsort((void*)NC_reserved,NRESERVED,sizeof(NC_reservedatt),sortcmp);
+    return NC_NOERR;
+}
+
+static int reserved_once = NC_ONCE_INIT;
+
+/* Sort the reserved attribute table, the first time it is called */
+void
+NC_initialize_reserved(void)
+{
+    (void)NC_once(&reserved_once,sortreserved);
 }
@@ -367,12 +367,16 @@ NC4_inq_varid(int ncid, const char *name, int *varidp)
     if ((retval = nc4_find_nc_grp_h5(ncid, &nc, &grp, NULL)))
         return retval;
 
-    /* Normalize name. */
-    if ((retval = nc4_normalize_name(name, norm_name)))
-        return retval;
-
-    /* Find var of this name. */
-    var = (NC_VAR_INFO_T*)ncindexlookup(grp->vars,norm_name);
+    /* Find var of this name. Stored names are normalized, and one
+     * that is stored as given is its own normal form, so normalize
+     * name only if it is not found as is. */
+    var = (NC_VAR_INFO_T*)ncindexlookup(grp->vars,name);
+    if(!var)
+    {
+        if ((retval = nc4_normalize_name(name, norm_name)))
+            return retval;
+        var = (NC_VAR_INFO_T*)ncindexlookup(grp->vars,norm_name);
+    }
     if(var)
     {
         *varidp = var->hdr.id;